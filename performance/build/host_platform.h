@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+// Describes the processors of the host: their model, how many there are, and their caches
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+struct host_platform
+{
+  std::string model;
+  int sockets;
+  int cores;
+  int logical_processors;
+
+  // cache_bytes[1], [2] and [3] hold the sizes of the level 1 data, level 2 and level 3 caches,
+  // or 0 if unknown
+  std::size_t cache_bytes[4];
+
+  host_platform(void)
+    : model("unknown"), sockets(0), cores(0), logical_processors(0)
+  {
+    for(int level = 0; level < 4; ++level)
+      cache_bytes[level] = 0;
+  }
+};
+
+
+// reads a sysfs cache size such as "32K"
+inline std::size_t parse_cache_size(const std::string &size)
+{
+  std::size_t result = std::strtoul(size.c_str(), 0, 10);
+
+  if(size.find('K') != std::string::npos) result <<= 10;
+  if(size.find('M') != std::string::npos) result <<= 20;
+
+  return result;
+}
+
+
+inline host_platform query_host_platform(void)
+{
+  host_platform result;
+
+#if defined(__linux__)
+  std::ifstream cpuinfo("/proc/cpuinfo");
+
+  std::set<int> physical_ids;
+  std::set<std::pair<int,int> > core_ids;
+  int physical_id = 0;
+
+  std::string line;
+  while(std::getline(cpuinfo, line))
+  {
+    std::string::size_type colon = line.find(':');
+    if(colon == std::string::npos) continue;
+
+    std::string key   = line.substr(0, line.find_last_not_of(" \t", colon - 1) + 1);
+    std::string value = colon + 2 <= line.size() ? line.substr(colon + 2) : std::string();
+
+    if(key == "processor")
+    {
+      ++result.logical_processors;
+    }
+    else if(key == "model name")
+    {
+      result.model = value;
+    }
+    else if(key == "physical id")
+    {
+      physical_id = std::atoi(value.c_str());
+      physical_ids.insert(physical_id);
+    }
+    else if(key == "core id")
+    {
+      core_ids.insert(std::make_pair(physical_id, std::atoi(value.c_str())));
+    }
+  }
+
+  if(result.logical_processors == 0)
+    result.logical_processors = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+
+  // without topology in /proc/cpuinfo, count each logical processor as a core of one socket
+  result.sockets = physical_ids.empty() ? 1 : static_cast<int>(physical_ids.size());
+  result.cores   = core_ids.empty() ? result.logical_processors : static_cast<int>(core_ids.size());
+
+  for(int index = 0; ; ++index)
+  {
+    std::ostringstream directory;
+    directory << "/sys/devices/system/cpu/cpu0/cache/index" << index << "/";
+
+    std::ifstream level_file((directory.str() + "level").c_str());
+    std::ifstream type_file((directory.str() + "type").c_str());
+    std::ifstream size_file((directory.str() + "size").c_str());
+
+    int level = 0;
+    std::string type, size;
+    if(!(level_file >> level) || !(type_file >> type) || !(size_file >> size)) break;
+
+    if(level < 1 || level > 3 || type == "Instruction") continue;
+
+    result.cache_bytes[level] = parse_cache_size(size);
+  }
+#endif
+
+  return result;
+}
+
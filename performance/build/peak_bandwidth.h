@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+// Measures the host's peak memory bandwidth the way the STREAM benchmark does: as the
+// best rate of the copy, scale, add and triad loops over arrays too large for the caches.
+// Those loops pay for the reads of write-allocation, which the bytes they are credited with
+// leave out, so memcpy and a copy with non-temporal stores, which avoid them as thrust::copy
+// of plain-old-data does, are timed too, and the peak is the best rate of them all
+
+#include <build/timer.h>
+#include <build/host_platform.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// the arrays begin on a cache line, and, like the arrays of the benchmarks, whose pages
+// are placed in parallel, are first touched by the threads which later stream them
+struct stream_arrays
+{
+  static const std::size_t alignment = 64;
+
+  std::ptrdiff_t n;
+  char *storage[3];
+  double *a, *b, *c;
+
+  stream_arrays(std::size_t n)
+    : n(static_cast<std::ptrdiff_t>(n))
+  {
+    a = allocate(0);
+    b = allocate(1);
+    c = allocate(2);
+
+    // the same schedule as the loops, so that each page is local to the thread using it
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for(std::ptrdiff_t i = 0; i < this->n; ++i)
+    {
+      a[i] = 1.0;
+      b[i] = 2.0;
+      c[i] = 0.0;
+    }
+  }
+
+  ~stream_arrays(void)
+  {
+    for(int i = 0; i < 3; ++i)
+      delete[] storage[i];
+  }
+
+  std::ptrdiff_t size(void) const
+  {
+    return n;
+  }
+
+  private:
+    double *allocate(int i)
+    {
+      storage[i] = new char[n * sizeof(double) + alignment];
+
+      std::size_t misalignment = reinterpret_cast<std::size_t>(storage[i]) % alignment;
+
+      return reinterpret_cast<double*>(storage[i] + (alignment - misalignment) % alignment);
+    }
+
+    // not copyable
+    stream_arrays(const stream_arrays &);
+    stream_arrays &operator=(const stream_arrays &);
+};
+
+
+// each loop returns the bytes it moved, counted as STREAM does: each element
+// it reads and each it writes once, ignoring the reads of write-allocation
+inline double stream_copy(stream_arrays &s)
+{
+  double *a = s.a, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+    c[i] = a[i];
+
+  return 2 * sizeof(double) * double(n);
+}
+
+inline double stream_scale(stream_arrays &s)
+{
+  double *b = s.b, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+  const double scalar = 3.0;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+    b[i] = scalar * c[i];
+
+  return 2 * sizeof(double) * double(n);
+}
+
+inline double stream_add(stream_arrays &s)
+{
+  double *a = s.a, *b = s.b, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+    c[i] = a[i] + b[i];
+
+  return 3 * sizeof(double) * double(n);
+}
+
+inline double stream_triad(stream_arrays &s)
+{
+  double *a = s.a, *b = s.b, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+  const double scalar = 3.0;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+    a[i] = b[i] + scalar * c[i];
+
+  return 3 * sizeof(double) * double(n);
+}
+
+// each thread copies the block of the arrays the static schedule gives it with memcpy
+inline double stream_memcpy(stream_arrays &s)
+{
+  double *a = s.a, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+
+#if defined(_OPENMP)
+#pragma omp parallel
+  {
+    const std::ptrdiff_t num_threads = omp_get_num_threads();
+    const std::ptrdiff_t thread      = omp_get_thread_num();
+
+    // the blocks of schedule(static), which are as even as they can be
+    const std::ptrdiff_t block = n / num_threads, remainder = n % num_threads;
+    const std::ptrdiff_t begin = thread * block + std::min(thread, remainder);
+    const std::ptrdiff_t end   = begin + block + (thread < remainder ? 1 : 0);
+
+    std::memcpy(c + begin, a + begin, (end - begin) * sizeof(double));
+  }
+#else
+  std::memcpy(c, a, n * sizeof(double));
+#endif
+
+  return 2 * sizeof(double) * double(n);
+}
+
+#if defined(__SSE2__)
+// a copy whose stores bypass the caches, so that it does not read what it overwrites
+inline double stream_nontemporal_copy(stream_arrays &s)
+{
+  double *a = s.a, *c = s.c;
+  const std::ptrdiff_t n = s.size();
+
+  // the arrays are aligned, so every pair of elements is too
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+  {
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+    for(std::ptrdiff_t i = 0; i < n / 2; ++i)
+      _mm_stream_pd(c + 2 * i, _mm_load_pd(a + 2 * i));
+
+    // the streaming stores of each thread are ordered before it leaves the loop
+    _mm_sfence();
+  }
+
+  if(n % 2)
+    c[n - 1] = a[n - 1];
+
+  return 2 * sizeof(double) * double(n);
+}
+#endif // __SSE2__
+
+
+// returns the peak bandwidth in bytes per second, the best rate of any loop in num_trials
+// runs of each. each array is at least four times the size of the largest cache, as STREAM
+// requires, and at least min_bytes. with OpenMP, the loops run on all of its threads;
+// otherwise they run on one, and the result underestimates the peak of a multicore host
+inline double measure_peak_bandwidth(std::size_t min_bytes = std::size_t(1) << 25, std::size_t num_trials = 5)
+{
+  host_platform host = query_host_platform();
+
+  std::size_t largest_cache = *std::max_element(host.cache_bytes + 1, host.cache_bytes + 4);
+  std::size_t bytes = std::max(min_bytes, 4 * largest_cache);
+
+  // touch the arrays before timing so page faults are not counted
+  stream_arrays s(bytes / sizeof(double));
+
+  double (*loops[])(stream_arrays &) =
+  {
+    stream_copy, stream_scale, stream_add, stream_triad, stream_memcpy,
+#if defined(__SSE2__)
+    stream_nontemporal_copy
+#endif
+  };
+
+  double peak = 0;
+  for(std::size_t loop = 0; loop < sizeof(loops) / sizeof(loops[0]); ++loop)
+  {
+    for(std::size_t trial = 0; trial < num_trials; ++trial)
+    {
+      timer t;
+      double moved = loops[loop](s);
+      double elapsed = t.elapsed();
+
+      if(elapsed > 0)
+        peak = std::max(peak, moved / elapsed);
+    }
+  }
+
+  return peak;
+}
+
@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+// Hardware performance counters of the host, read through perf_event_open on Linux.
+//
+// The counters are opened once, before the tests start any threads, and are inherited
+// by the threads the omp and tbb systems create later, so they count the work of all
+// threads. Counters the kernel refuses to open (e.g. because of perf_event_paranoid,
+// or inside a virtual machine) are left out of the results.
+
+#include <cstddef>
+#include <iostream>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+class perf_counters
+{
+  public:
+    enum counter
+    {
+      cycles = 0,
+      instructions,
+      llc_misses,
+      dtlb_misses,
+      branch_misses,
+      num_counters
+    };
+
+    perf_counters(void)
+    {
+      for(int i = 0; i < num_counters; ++i)
+      {
+        m_fd[i] = -1;
+        m_value[i] = 0;
+      }
+    }
+
+    ~perf_counters(void)
+    {
+      close();
+    }
+
+    // opens the counters the kernel allows
+    void open(void)
+    {
+#if defined(__linux__)
+      const unsigned int llc_read_miss  = PERF_COUNT_HW_CACHE_LL   | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      const unsigned int dtlb_read_miss = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+      m_fd[cycles]        = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+      m_fd[instructions]  = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+      m_fd[llc_misses]    = open_counter(PERF_TYPE_HW_CACHE, llc_read_miss);
+      m_fd[dtlb_misses]   = open_counter(PERF_TYPE_HW_CACHE, dtlb_read_miss);
+      m_fd[branch_misses] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+    }
+
+    void close(void)
+    {
+#if defined(__linux__)
+      for(int i = 0; i < num_counters; ++i)
+      {
+        if(m_fd[i] != -1) ::close(m_fd[i]);
+        m_fd[i] = -1;
+      }
+#endif
+    }
+
+    bool available(counter c) const
+    {
+      return m_fd[c] != -1;
+    }
+
+    // zeroes and starts the counters
+    void start(void)
+    {
+#if defined(__linux__)
+      for(int i = 0; i < num_counters; ++i)
+      {
+        if(m_fd[i] == -1) continue;
+
+        ioctl(m_fd[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+    }
+
+    // stops the counters and reads them
+    void stop(void)
+    {
+#if defined(__linux__)
+      for(int i = 0; i < num_counters; ++i)
+      {
+        if(m_fd[i] == -1) continue;
+
+        ioctl(m_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+
+        // value, time enabled, time running
+        unsigned long long data[3] = {0, 0, 0};
+
+        if(read(m_fd[i], data, sizeof(data)) != sizeof(data))
+        {
+          m_value[i] = 0;
+          continue;
+        }
+
+        // scale up counts of counters which were multiplexed with others
+        m_value[i] = (data[2] == 0) ? 0.0 : double(data[0]) * (double(data[1]) / double(data[2]));
+      }
+#endif
+    }
+
+    // the count of counter c between the last start() and stop()
+    double value(counter c) const
+    {
+      return m_value[c];
+    }
+
+  private:
+    int    m_fd[num_counters];
+    double m_value[num_counters];
+
+#if defined(__linux__)
+    static int open_counter(unsigned int type, unsigned long long config)
+    {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+
+      attr.size           = sizeof(attr);
+      attr.type           = type;
+      attr.config         = config;
+      attr.disabled       = 1;
+      attr.inherit        = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // this process and the threads it creates, on any cpu
+      return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    perf_counters(const perf_counters &);
+    perf_counters &operator=(const perf_counters &);
+};
+
+
+inline perf_counters &get_perf_counters(void)
+{
+  static perf_counters counters;
+  return counters;
+}
+
@@ -1,7 +1,14 @@
 #include <unittest/unittest.h>
 #include <build/timer.h>
+#include <build/host_platform.h>
+#include <build/timing_statistics.h>
+#include <build/perf_counters.h>
+#include <build/peak_bandwidth.h>
+#include <thrust/temporary_memory_monitor.h>
 #include <string>
 #include <algorithm>
+#include <cstdlib>
+#include <vector>
 
 
 //#include <cuda_runtime.h>
@@ -10,9 +17,17 @@
 #define RECORD_RESULT(name, value, units)   { std::cout << "  <result  name=\"" << name << "\"  value=\"" << value  << "\"  units=\"" << units << "\"/>" << std::endl; }
 #define RECORD_TIME()                       RECORD_RESULT("Time", best_time, "seconds")
 #define RECORD_RATE(name, value, units)     RECORD_RESULT(name, (double(value)/best_time), units)
-#define RECORD_BANDWIDTH(bytes)             RECORD_RATE("Bandwidth", double(bytes) / 1e9, "GBytes/s")
+#define RECORD_BANDWIDTH(bytes)             record_bandwidth(double(bytes), best_time)
 #define RECORD_THROUGHPUT(value)            RECORD_RATE("Throughput", double(value) / 1e9, "GOp/s")
 #define RECORD_SORTING_RATE(size)           RECORD_RATE("Sorting", double(size) / 1e6, "MKeys/s")
+#define RECORD_MIN_TIME()                   RECORD_RESULT("Min Time", statistics.min, "seconds")
+#define RECORD_MEDIAN_TIME()                RECORD_RESULT("Median Time", statistics.median, "seconds")
+#define RECORD_P90_TIME()                   RECORD_RESULT("P90 Time", statistics.p90, "seconds")
+#define RECORD_TIME_CV()                    RECORD_RESULT("Time CV", statistics.coefficient_of_variation, "")
+#define RECORD_TRIALS()                     RECORD_RESULT("Trials", statistics.num_trials, "")
+#define RECORD_TIME_STATISTICS()            { RECORD_MIN_TIME(); RECORD_MEDIAN_TIME(); RECORD_P90_TIME(); RECORD_TIME_CV(); RECORD_TRIALS(); }
+#define RECORD_PERF_COUNTERS()              record_perf_counters(counters, double(NUM_ITERATIONS) * double(statistics.num_trials))
+#define RECORD_TEMPORARY_MEMORY()           record_temporary_memory(temporary_memory)
 #define RECORD_VARIABLE(name, value)        { std::cout << "  <variable  name=\"" << name << "\"  value=\"" << value << "\"/>" << std::endl; }
 #define RECORD_TEST_STATUS(result, message) { std::cout << "  <status  result=\"" << result  << "\"  message=\"" << message << "\"/>" << std::endl; }
 #define RECORD_TEST_SUCCESS()               RECORD_TEST_STATUS("Success",  "")
@@ -23,6 +38,143 @@
 #define END_TESTSUITE()                     { std::cout << "</testsuite>" << std::endl; }
 
 
+// controls how many times each test is run
+struct perftest_options
+{
+  // untimed runs before the trials
+  size_t warmup_runs;
+
+  // each trial runs a test repeatedly for about trial_time seconds
+  double trial_time;
+
+  // trials are added until the standard error of their mean is within relative_error of it,
+  // and there are at least min_trials, or until max_trials or max_test_time seconds is reached
+  size_t min_trials;
+  size_t max_trials;
+  double relative_error;
+  double max_test_time;
+
+  // whether hardware performance counters are read around the trials
+  bool perf_counters;
+
+  // whether the temporary storage obtained by the first run is recorded,
+  // and whether that run is all there is, the trials being skipped
+  bool temporary_memory;
+  bool memory_only;
+
+  // the peak memory bandwidth in GBytes/s to which RECORD_BANDWIDTH compares a test's,
+  // or 0 if unknown, and whether to measure it when the program starts
+  double peak_bandwidth;
+  bool measure_peak_bandwidth;
+
+  perftest_options(void)
+    : warmup_runs(1), trial_time(0.1), min_trials(5), max_trials(100), relative_error(0.01), max_test_time(5.0),
+      perf_counters(THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA),
+      temporary_memory(true), memory_only(false),
+      peak_bandwidth(0), measure_peak_bandwidth(THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA)
+  {}
+};
+
+
+// the temporary storage one run of a test obtained
+struct temporary_memory_usage
+{
+  size_t peak_bytes;
+  size_t total_bytes;
+  size_t num_allocations;
+
+  temporary_memory_usage(void)
+    : peak_bytes(0), total_bytes(0), num_allocations(0)
+  {}
+
+  temporary_memory_usage(const thrust::temporary_memory_monitor &monitor)
+    : peak_bytes(monitor.peak_bytes_in_use()), total_bytes(monitor.total_bytes()), num_allocations(monitor.num_allocations())
+  {}
+};
+
+
+// records the counts of the available counters per timed run
+inline void record_perf_counters(const perf_counters &counters, double num_runs)
+{
+  if(num_runs <= 0) return;
+
+  if(counters.available(perf_counters::cycles))
+    RECORD_RESULT("Cycles", counters.value(perf_counters::cycles) / num_runs, "");
+  if(counters.available(perf_counters::instructions))
+    RECORD_RESULT("Instructions", counters.value(perf_counters::instructions) / num_runs, "");
+  if(counters.available(perf_counters::cycles) && counters.available(perf_counters::instructions) && counters.value(perf_counters::cycles) > 0)
+    RECORD_RESULT("IPC", counters.value(perf_counters::instructions) / counters.value(perf_counters::cycles), "instructions/cycle");
+  if(counters.available(perf_counters::llc_misses))
+    RECORD_RESULT("LLC Misses", counters.value(perf_counters::llc_misses) / num_runs, "");
+  if(counters.available(perf_counters::dtlb_misses))
+    RECORD_RESULT("dTLB Misses", counters.value(perf_counters::dtlb_misses) / num_runs, "");
+  if(counters.available(perf_counters::branch_misses))
+    RECORD_RESULT("Branch Misses", counters.value(perf_counters::branch_misses) / num_runs, "");
+}
+
+
+inline void record_temporary_memory(const temporary_memory_usage &usage)
+{
+  RECORD_RESULT("Peak Temporary Bytes", usage.peak_bytes, "bytes");
+  RECORD_RESULT("Total Temporary Bytes", usage.total_bytes, "bytes");
+  RECORD_RESULT("Temporary Allocations", usage.num_allocations, "");
+}
+
+
+inline perftest_options &get_perftest_options(void)
+{
+  static perftest_options options;
+  return options;
+}
+
+
+// records the bandwidth of a test which moved bytes in time seconds, and its fraction of
+// the peak bandwidth when that is known. bytes should model the least traffic the
+// algorithm needs, so that a fraction well below 1 reveals wasted traffic
+inline void record_bandwidth(double bytes, double time)
+{
+  double bandwidth = bytes / 1e9 / time;
+
+  RECORD_RESULT("Bandwidth", bandwidth, "GBytes/s");
+
+  const perftest_options &options = get_perftest_options();
+  if(options.peak_bandwidth > 0)
+    RECORD_RESULT("Peak Bandwidth Fraction", bandwidth / options.peak_bandwidth, "");
+}
+
+
+// the least traffic an algorithm needs: it reads each of its inputs once and writes
+// each of its outputs once, e.g.
+//   RECORD_BANDWIDTH(minimum_traffic().read<int>(n).write<int>(n));
+struct minimum_traffic
+{
+  double bytes;
+
+  minimum_traffic(void)
+    : bytes(0)
+  {}
+
+  template<typename T>
+  minimum_traffic &read(double num_elements)
+  {
+    bytes += sizeof(T) * num_elements;
+    return *this;
+  }
+
+  template<typename T>
+  minimum_traffic &write(double num_elements)
+  {
+    bytes += sizeof(T) * num_elements;
+    return *this;
+  }
+
+  operator double(void) const
+  {
+    return bytes;
+  }
+};
+
+
 #if defined(__GNUC__)  // GCC
 #define __HOST_COMPILER_NAME__ "GCC"
 # if defined(__GNUC_PATCHLEVEL__)
@@ -73,6 +225,7 @@ inline void RECORD_PLATFORM_INFO(void)
     std::cout << "    <property name=\"warp size\"" << " " << "value=\"" << deviceProp.warpSize << "\"/>" << std::endl;
     std::cout << "    <property name=\"max threads per block\"" << " " << "value=\"" << deviceProp.maxThreadsPerBlock << "\"/>" << std::endl;
     std::cout << "    <property name=\"clock rate\"" << " " << "value=\"" << (deviceProp.clockRate * 1e-6f) << "\"  units=\"GHz\"/>" << std::endl;
+    std::cout << "    <property name=\"peak bandwidth\"" << " " << "value=\"" << get_perftest_options().peak_bandwidth << "\"  units=\"GBytes/s\"/>" << std::endl;
     std::cout << "  </device>" << std::endl;
     std::cout << "  <compilation>" << std::endl;
     std::cout << "    <property name=\"CUDA_VERSION\" value=\"" << CUDA_VERSION << "\"/>" << std::endl;
@@ -81,15 +234,87 @@ inline void RECORD_PLATFORM_INFO(void)
     std::cout << "    <property name=\"__TIME__\" value=\"" << __TIME__ << "\"/>" << std::endl;
     std::cout << "  </compilation>" << std::endl;
     std::cout << "</platform>" << std::endl;
+#else
+    host_platform host = query_host_platform();
+
+    const char *system_name = (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP) ? "omp" : "tbb";
+
+    std::cout << "<platform>" << std::endl;
+    std::cout << "  <device name=\"" << host.model << "\">" << std::endl;
+    std::cout << "    <property name=\"device system\"" << " " << "value=\"" << system_name << "\"/>" << std::endl;
+    std::cout << "    <property name=\"sockets\"" << " " << "value=\"" << host.sockets << "\"/>" << std::endl;
+    std::cout << "    <property name=\"cores\"" << " " << "value=\"" << host.cores << "\"/>" << std::endl;
+    std::cout << "    <property name=\"logical processors\"" << " " << "value=\"" << host.logical_processors << "\"/>" << std::endl;
+    std::cout << "    <property name=\"L1 data cache\"" << " " << "value=\"" << host.cache_bytes[1] << "\"  units=\"bytes\"/>" << std::endl;
+    std::cout << "    <property name=\"L2 cache\"" << " " << "value=\"" << host.cache_bytes[2] << "\"  units=\"bytes\"/>" << std::endl;
+    std::cout << "    <property name=\"L3 cache\"" << " " << "value=\"" << host.cache_bytes[3] << "\"  units=\"bytes\"/>" << std::endl;
+    std::cout << "    <property name=\"peak bandwidth\"" << " " << "value=\"" << get_perftest_options().peak_bandwidth << "\"  units=\"GBytes/s\"/>" << std::endl;
+    std::cout << "  </device>" << std::endl;
+    std::cout << "  <compilation>" << std::endl;
+    std::cout << "    <property name=\"host compiler\" value=\"" << __HOST_COMPILER_NAME__ << " " << __HOST_COMPILER_VERSION__ << "\"/>" << std::endl;
+    std::cout << "    <property name=\"__DATE__\" value=\"" << __DATE__ << "\"/>" << std::endl;
+    std::cout << "    <property name=\"__TIME__\" value=\"" << __TIME__ << "\"/>" << std::endl;
+    std::cout << "  </compilation>" << std::endl;
+    std::cout << "</platform>" << std::endl;
 #endif
 }
 
 
+// returns the value following the option at argv[i]
+inline const char *option_value(int argc, char **argv, int &i)
+{
+  ++i;
+  if(i == argc)
+  {
+    std::cerr << "usage: " << argv[i - 1] << " value" << std::endl;
+    exit(-1);
+  }
+
+  return argv[i];
+}
+
+
 inline void PROCESS_ARGUMENTS(int argc, char **argv)
 {
+  perftest_options &options = get_perftest_options();
+
   for(int i = 1; i < argc; ++i)
   {
-    if(std::string(argv[i]) == "--device")
+    std::string option(argv[i]);
+
+    if(option == "--warmup")
+      options.warmup_runs = std::strtoul(option_value(argc, argv, i), 0, 10);
+    else if(option == "--trial-time")
+      options.trial_time = std::atof(option_value(argc, argv, i));
+    else if(option == "--min-trials")
+      options.min_trials = std::max<size_t>(1, std::strtoul(option_value(argc, argv, i), 0, 10));
+    else if(option == "--max-trials")
+      options.max_trials = std::max<size_t>(1, std::strtoul(option_value(argc, argv, i), 0, 10));
+    else if(option == "--relative-error")
+      options.relative_error = std::atof(option_value(argc, argv, i));
+    else if(option == "--max-test-time")
+      options.max_test_time = std::atof(option_value(argc, argv, i));
+    else if(option == "--perf-counters")
+      options.perf_counters = true;
+    else if(option == "--no-perf-counters")
+      options.perf_counters = false;
+    else if(option == "--temporary-memory")
+      options.temporary_memory = true;
+    else if(option == "--no-temporary-memory")
+      options.temporary_memory = false;
+    else if(option == "--memory-only")
+      options.temporary_memory = options.memory_only = true;
+    else if(option == "--peak-bandwidth")
+    {
+      options.peak_bandwidth = std::atof(option_value(argc, argv, i));
+      options.measure_peak_bandwidth = false;
+    }
+    else if(option == "--no-peak-bandwidth")
+    {
+      options.peak_bandwidth = 0;
+      options.measure_peak_bandwidth = false;
+    }
+    else if(option == "--device")
     {
       ++i;
       if(i == argc)
@@ -104,6 +329,11 @@ inline void PROCESS_ARGUMENTS(int argc, char **argv)
 #endif
     }
   }
-}
 
+  // open the counters before any test starts threads, so that they are inherited
+  if(options.perf_counters && !options.memory_only)
+    get_perf_counters().open();
 
+  if(options.measure_peak_bandwidth && !options.memory_only)
+    options.peak_bandwidth = measure_peak_bandwidth() / 1e9;
+}
@@ -49,13 +49,17 @@ def make_test_function(fname, TestVariablePairs, ftemplate):
             
     return ftemplate.substitute(fmap)
 
-def generate_functions(pname, TestVariables, INITIALIZE, TIME, FINALIZE):
+def generate_functions(pname, TestVariables, INITIALIZE, TIME, FINALIZE, TestFilter = None):
     ftemplate = make_test_function_template(INITIALIZE, TIME, FINALIZE)
 
     TestVariableNames  = [ pair[0] for pair in TestVariables]
     TestVariableRanges = [ pair[1] for pair in TestVariables]
 
     for n,values in enumerate(product(*TestVariableRanges)):
+        # skip combinations of variables the test filters out
+        if TestFilter is not None and not TestFilter(dict(zip(TestVariableNames, values))):
+            continue
+
         converted_values = []
         for v in values:
             v = str(v)
@@ -98,8 +102,8 @@ def make_test_program(pname, functions, PREAMBLE = ""):
 
     return "\n".join(parts)
 
-def generate_program(pname, TestVariables, PREAMBLE, INITIALIZE, TIME, FINALIZE):
-    functions = list(generate_functions(pname, TestVariables, INITIALIZE, TIME, FINALIZE))
+def generate_program(pname, TestVariables, PREAMBLE, INITIALIZE, TIME, FINALIZE, TestFilter = None):
+    functions = list(generate_functions(pname, TestVariables, INITIALIZE, TIME, FINALIZE, TestFilter))
     return make_test_program(pname, functions, PREAMBLE)
 
 
@@ -115,7 +119,7 @@ def process_test_file(filename):
     exec open(test_env_file)
     exec open(filename)
 
-    return generate_program(pname, TestVariables, PREAMBLE, INITIALIZE, TIME, FINALIZE)
+    return generate_program(pname, TestVariables, PREAMBLE, INITIALIZE, TIME, FINALIZE, TestFilter)
 
 
 def compile_test(input_name, output_name):
@@ -1,6 +1,8 @@
-from build import parse_testsuite_xml
+import os
 
-__all__ = ['plot_results','print_results']
+from build import parse_testsuite_xml, compare_testsuites
+
+__all__ = ['plot_results','print_results','scaling_results','print_scaling','plot_scaling','memory_results','print_memory','plot_memory','penalty_results','print_penalty','bandwidth_results','print_bandwidth','print_comparison']
 
 #TODO add print_results which outputs a CSV file
 
@@ -8,6 +10,9 @@ def full_label(name):
     known_labels = {'Throughput' : 'Throughput (GOp/s)',
                     'Sorting'    : 'Sorting Rate (MKey/s)',
                     'Bandwidth'  : 'Memory Bandwidth (GByte/s)',
+                    'Peak Bandwidth Fraction' : 'Fraction of Peak Memory Bandwidth',
+                    'Peak Temporary Bytes'  : 'Peak Temporary Storage (Bytes)',
+                    'Total Temporary Bytes' : 'Total Temporary Storage (Bytes)',
                     'InputSize'  : 'Input Size',
                     'KeyType'    : 'Key Type' }
 
@@ -129,3 +134,329 @@ def plot_results(input_file, series_key, x_axis, y_axis, plot='loglog', dpi=72,
         import os
         fname = os.path.splitext(input_file)[0] + '.' + format
         pylab.savefig(fname, dpi=dpi)
+
+
+def scaling_results(input_file, fixed_variables, y_axis='Time', threads='Threads'):
+    """Compute the speedup and parallel efficiency of the tests in an XML file
+
+    The tests which match fixed_variables are grouped by their variables other than
+    threads. Within each group, the speedup at p threads is the group's y_axis at one
+    thread divided by its y_axis at p threads, and the efficiency is speedup / p.
+
+    Returns a dictionary mapping each group's title to a sorted list of
+    (threads, speedup, efficiency) tuples
+
+    Example
+    -------
+    input_file = 'sort.xml'
+    fixed_variables = {'KeyType' : 'int', 'InputSize' : 2**24, 'Sort' : 'sort'}
+    """
+
+    TS = parse_testsuite_xml(input_file)
+
+    groups = {}
+    for testname,test in TS.tests.items():
+        if threads not in test.variables or y_axis not in test.results:
+            continue
+
+        if any(test.variables.get(k) != v for k,v in fixed_variables.items()):
+            continue
+
+        key = tuple(sorted((k,v) for k,v in test.variables.items() if k != threads and k not in fixed_variables))
+        groups.setdefault(key, {})[test.variables[threads]] = test.results[y_axis]
+
+    results = {}
+    for key,times in groups.items():
+        if 1 not in times:
+            continue
+
+        title = ' '.join([str(v) for k,v in key])
+        results[title] = [(p, times[1] / times[p], times[1] / times[p] / p) for p in sorted(times) if times[p] > 0]
+
+    return results
+
+
+def print_scaling(input_file, fixed_variables, y_axis='Time', title=None):
+    """Print the speedup and efficiency curves of scaling_results() as CSV"""
+
+    results = scaling_results(input_file, fixed_variables, y_axis)
+
+    print 'title,' + str(title)
+    for series_title,series_data in sorted(results.items()):
+        print ','.join( [series_title + ' threads']    + [str(t[0]) for t in series_data])
+        print ','.join( [series_title + ' speedup']    + [str(t[1]) for t in series_data])
+        print ','.join( [series_title + ' efficiency'] + [str(t[2]) for t in series_data])
+
+
+def plot_scaling(input_file, fixed_variables, y_axis='Time', dpi=72, title=None, format=None):
+    """Plot the speedup and efficiency curves of scaling_results()
+
+    if format is None then the figures are shown, otherwise they are
+    written to files named after input_file with the specified extension
+    """
+
+    results = scaling_results(input_file, fixed_variables, y_axis)
+
+    if not results:
+        print "no tests in '%s' to compute scaling from" % input_file
+        return
+
+    if title is None:
+        title = os.path.splitext(os.path.basename(input_file))[0] + ' ' + ' '.join([str(v) for k,v in sorted(fixed_variables.items())])
+
+    import pylab
+
+    for index,name in [(1,'Speedup'),(2,'Efficiency')]:
+        pylab.figure()
+        pylab.title(title)
+        pylab.xlabel('Threads')
+        pylab.ylabel(name)
+
+        for series_title,series_data in sorted(results.items()):
+            pylab.plot([t[0] for t in series_data], [t[index] for t in series_data], marker='o', label=series_title)
+
+        if len(results) >= 2:
+            pylab.legend(loc=0)
+
+        if format is not None:
+            fname = '_'.join([os.path.splitext(input_file)[0]] + [str(v).replace(' ', '_') for k,v in sorted(fixed_variables.items())] + [name.lower()]) + '.' + format
+            pylab.savefig(fname, dpi=dpi)
+
+    if format is None:
+        pylab.show()
+
+
+def memory_results(input_file, fixed_variables, y_axis='Peak Temporary Bytes', x_axis='InputSize'):
+    """Collect the temporary storage of the tests in an XML file as a function of input size
+
+    The tests which match fixed_variables are grouped by their variables other than
+    x_axis. Within each group, the bytes per element at size n is the group's y_axis
+    at n divided by n.
+
+    Returns a dictionary mapping each group's title to a sorted list of
+    (size, bytes, bytes per element) tuples
+
+    Example
+    -------
+    input_file = 'sort.xml'
+    fixed_variables = {'KeyType' : 'int', 'Threads' : 1, 'Sort' : 'stable_sort'}
+    """
+
+    TS = parse_testsuite_xml(input_file)
+
+    groups = {}
+    for testname,test in TS.tests.items():
+        if x_axis not in test.variables or y_axis not in test.results:
+            continue
+
+        if any(test.variables.get(k) != v for k,v in fixed_variables.items()):
+            continue
+
+        key = tuple(sorted((k,v) for k,v in test.variables.items() if k != x_axis and k not in fixed_variables))
+        groups.setdefault(key, {})[test.variables[x_axis]] = test.results[y_axis]
+
+    results = {}
+    for key,sizes in groups.items():
+        title = ' '.join([str(v) for k,v in key])
+        results[title] = [(n, sizes[n], float(sizes[n]) / n) for n in sorted(sizes) if n > 0]
+
+    return results
+
+
+def print_memory(input_file, fixed_variables, y_axis='Peak Temporary Bytes', title=None):
+    """Print the temporary storage curves of memory_results() as CSV"""
+
+    results = memory_results(input_file, fixed_variables, y_axis)
+
+    print 'title,' + str(title)
+    for series_title,series_data in sorted(results.items()):
+        print ','.join( [series_title + ' size']              + [str(t[0]) for t in series_data])
+        print ','.join( [series_title + ' bytes']             + [str(t[1]) for t in series_data])
+        print ','.join( [series_title + ' bytes per element'] + [str(t[2]) for t in series_data])
+
+
+def plot_memory(input_file, fixed_variables, y_axis='Peak Temporary Bytes', dpi=72, title=None, format=None):
+    """Plot the temporary storage curves of memory_results()
+
+    if format is None then the figures are shown, otherwise they are
+    written to files named after input_file with the specified extension
+    """
+
+    results = memory_results(input_file, fixed_variables, y_axis)
+
+    if not results:
+        print "no tests in '%s' record %s" % (input_file, y_axis)
+        return
+
+    if title is None:
+        title = os.path.splitext(os.path.basename(input_file))[0] + ' ' + ' '.join([str(v) for k,v in sorted(fixed_variables.items())])
+
+    import pylab
+
+    for index,name,plot in [(1,'Bytes','loglog'),(2,'Bytes per Element','semilogx')]:
+        pylab.figure()
+        pylab.title(title)
+        pylab.xlabel(full_label('InputSize'))
+        pylab.ylabel(full_label(y_axis) if index == 1 else name)
+
+        plotter = getattr(pylab, plot)
+        for series_title,series_data in sorted(results.items()):
+            plotter([t[0] for t in series_data], [t[index] for t in series_data], marker='o', label=series_title)
+
+        if len(results) >= 2:
+            pylab.legend(loc=0)
+
+        if format is not None:
+            fname = '_'.join([os.path.splitext(input_file)[0]] + [str(v).replace(' ', '_') for k,v in sorted(fixed_variables.items())] + [name.lower().replace(' ', '_')]) + '.' + format
+            pylab.savefig(fname, dpi=dpi)
+
+    if format is None:
+        pylab.show()
+
+
+def penalty_results(input_file, baseline_variables, y_axis='Median Time', ignored_variables=['System']):
+    """Compute the ratio of each test's y_axis to that of a baseline test in an XML file
+
+    The baseline tests are those whose variables match baseline_variables. Every other
+    test is compared to the baseline test whose variables equal its own, ignoring those
+    named in baseline_variables and ignored_variables.
+
+    Returns a sorted list of (title, ratio) tuples, where the title lists the test's variables
+
+    Example
+    -------
+    input_file = 'abstraction_penalty.xml'
+    baseline_variables = {'Implementation' : 'raw_loop'}
+    """
+
+    TS = parse_testsuite_xml(input_file)
+
+    def key(test):
+        return tuple(sorted((k,v) for k,v in test.variables.items() if k not in baseline_variables and k not in ignored_variables))
+
+    baselines = {}
+    for testname,test in TS.tests.items():
+        if y_axis in test.results and all(test.variables.get(k) == v for k,v in baseline_variables.items()):
+            baselines[key(test)] = test.results[y_axis]
+
+    results = []
+    for testname,test in TS.tests.items():
+        if y_axis not in test.results or all(test.variables.get(k) == v for k,v in baseline_variables.items()):
+            continue
+
+        baseline = baselines.get(key(test))
+        if not baseline:
+            continue
+
+        title = ' '.join([str(v) for k,v in sorted(test.variables.items())])
+        results.append( (title, test.results[y_axis] / baseline) )
+
+    return sorted(results)
+
+
+def print_penalty(input_file, baseline_variables, y_axis='Median Time', ignored_variables=['System'], threshold=None):
+    """Print the ratios of penalty_results() as CSV
+
+    Returns the number of tests whose ratio exceeds threshold, if it is given
+    """
+
+    results = penalty_results(input_file, baseline_variables, y_axis, ignored_variables)
+
+    print 'test,ratio'
+    for title,ratio in results:
+        print '%s,%.3f%s' % (title, ratio, ',EXCEEDED' if threshold is not None and ratio > threshold else '')
+
+    if threshold is None:
+        return 0
+
+    return len([ratio for title,ratio in results if ratio > threshold])
+
+
+def bandwidth_results(input_file, fixed_variables):
+    """Collect the bandwidth of the tests in an XML file which match fixed_variables,
+    and its fraction of the peak bandwidth measured when they ran
+
+    Returns the peak bandwidth in GBytes/s, or None if it is unknown, and a list of
+    (title, bandwidth, fraction) tuples, where the title lists the test's other
+    variables, sorted by increasing fraction, so that the tests which move the
+    most traffic beyond what their algorithms need come first
+
+    Example
+    -------
+    input_file = 'reduce_by_key.xml'
+    fixed_variables = {'InputType' : 'int', 'InputSize' : 2**24}
+    """
+
+    TS = parse_testsuite_xml(input_file)
+
+    peak = TS.platform.get('device', {}).get('peak bandwidth') or None
+
+    results = []
+    for testname,test in TS.tests.items():
+        if 'Bandwidth' not in test.results:
+            continue
+
+        if any(test.variables.get(k) != v for k,v in fixed_variables.items()):
+            continue
+
+        title = ' '.join([str(v) for k,v in sorted(test.variables.items()) if k not in fixed_variables])
+        results.append( (title, test.results['Bandwidth'], test.results.get('Peak Bandwidth Fraction')) )
+
+    return peak, sorted(results, key=lambda r: (r[2] is None, r[2], r[0]))
+
+
+def print_bandwidth(input_file, fixed_variables, title=None):
+    """Print the bandwidths of bandwidth_results() as CSV"""
+
+    peak, results = bandwidth_results(input_file, fixed_variables)
+
+    print 'title,' + str(title)
+    print 'peak bandwidth,' + str(peak)
+    print 'test,bandwidth,fraction of peak'
+    for test_title,bandwidth,fraction in results:
+        print '%s,%.3f,%s' % (test_title, bandwidth, '' if fraction is None else '%.3f' % fraction)
+
+
+def print_comparison(baseline_file, candidate_file, metric='Median Time', threshold=0.05, verbose=False):
+    """Compare two runs of a performance test stored in XML files
+
+    Prints the speedup of each test the runs have in common with its 95%
+    confidence interval, marking the tests which regressed significantly
+    by more than threshold, and the tests of the baseline which the
+    candidate is missing or failed. Returns the number of regressed and
+    failed tests, counting an unreadable candidate file as one failure.
+
+    Example
+    -------
+    baseline_file  = 'baseline/sort.xml'
+    candidate_file = 'sort.xml'
+    metric = 'Median Time'
+    threshold = 0.05
+    """
+
+    baseline = parse_testsuite_xml(baseline_file)
+
+    try:
+        candidate = parse_testsuite_xml(candidate_file)
+    except Exception, e:
+        print '%s: FAILED, unable to read report (%s)' % (candidate_file, e)
+        return 1
+
+    comparisons, unmatched, failures = compare_testsuites(baseline, candidate, metric, threshold)
+
+    regressions = [c for c in comparisons if c.regression]
+
+    for c in comparisons:
+        if verbose or c.regression:
+            print '%-60s %8.3fx  [%.3f, %.3f]%s' % (c.name, c.speedup, c.lower, c.upper, '  REGRESSION' if c.regression else '')
+
+    for name,reason in failures:
+        print '%-60s FAILED (%s)' % (name, reason)
+
+    for name in unmatched:
+        if verbose:
+            print '%-60s not comparable' % name
+
+    print '%s: %d tests compared, %d regressed by more than %g%%, %d failed or missing, %d not comparable' % (candidate.name, len(comparisons), len(regressions), 100 * threshold, len(failures), len(unmatched))
+
+    return len(regressions) + len(failures)
@@ -4,8 +4,43 @@ FloatingPointTypes = ['float','double']
 
 StandardSizes = [2**k for k in range(4, 24)]
 
+# the systems and numbers of threads swept by the CPU benchmarks in cpu/
+CpuSystems = ['cpp', 'omp', 'tbb']
+
+def cpu_thread_counts():
+    """powers of two below the number of processors of this machine, then that number"""
+    import multiprocessing
+    num_processors = multiprocessing.cpu_count()
+    return [2**k for k in range(0, 16) if 2**k < num_processors] + [num_processors]
+
+CpuThreadCounts = cpu_thread_counts()
+CpuSizes = [2**k for k in range(10, 27, 2)]
+
+# the shapes of input swept by the sort, merge, set operation, unique and search benchmarks,
+# named after the unittest::distribution they are generated with
+InputDistributions = ['uniform', 'presorted', 'reverse_sorted', 'few_unique', 'zipf', 'sawtooth', 'all_equal', 'nearly_sorted']
+
+# the distributions which remain distinct once sorted, for the tests of algorithms whose
+# inputs must be sorted: the others differ only in the order of their values
+SortedInputDistributions = ['uniform', 'few_unique', 'zipf', 'all_equal']
+
+def cpu_test_filter(variables):
+    """the sequential cpp system only runs with a single thread, and distributions
+    of input other than uniform only run with a single thread or all of them"""
+    if variables['System'] == 'cpp' and variables['Threads'] != 1:
+        return False
+    if variables.get('Distribution', 'uniform') != 'uniform':
+        # the largest of CpuThreadCounts, which the filter cannot see
+        import multiprocessing
+        return variables['Threads'] in [1, multiprocessing.cpu_count()]
+    return True
+
 TestVariables = []
 
+# if not None, only combinations of TestVariables for which TestFilter returns True
+# are tested. it is passed a dictionary mapping variable names to values
+TestFilter = None
+
 PREAMBLE = ""
 INITIALIZE = ""
 TIME = ""
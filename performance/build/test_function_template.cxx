@@ -10,55 +10,87 @@ void $FUNCTION(void)
     /************* END INITIALIZATION SECTION *************/
     
     
-        double warmup_time;
+        const perftest_options &options = get_perftest_options();
+
+        // untimed runs fault in memory and start thread pools.
+        // the first also measures the temporary storage a run obtains
+        temporary_memory_usage temporary_memory;
+        double warmup_time = 0;
+        const size_t warmup_runs = options.memory_only ? 1 : std::max<size_t>(1, options.warmup_runs);
+        for(size_t run = 0; run < warmup_runs; run++)
         {
+          thrust::temporary_memory_monitor monitor;
           timer t;
     /************ BEGIN TIMING SECTION ************/
     $TIME
     /************* END TIMING SECTION *************/
           warmup_time = t.elapsed();
+          if(run == 0)
+            temporary_memory = temporary_memory_usage(monitor);
         }
     
         // only verbose
         //std::cout << "warmup_time: " << warmup_time << " seconds" << std::endl;
     
-        static const size_t NUM_TRIALS = 5;
-        static const size_t MAX_ITERATIONS = 1000;
-        static const double MAX_TEST_TIME = 0.5;  //TODO allow to be set by user
+        if(!options.memory_only)
+        {
+            static const size_t MAX_ITERATIONS = 1000;
+    
+            // repeat short tests within each trial so the timer's resolution does not matter
+            size_t NUM_ITERATIONS;
+            if (warmup_time == 0)
+                NUM_ITERATIONS = MAX_ITERATIONS;
+            else
+                NUM_ITERATIONS = std::min(MAX_ITERATIONS, std::max( (size_t) 1, (size_t) (options.trial_time / warmup_time)));
     
-        size_t NUM_ITERATIONS;
-        if (warmup_time == 0)
-            NUM_ITERATIONS = MAX_ITERATIONS;
-        else
-            NUM_ITERATIONS = std::min(MAX_ITERATIONS, std::max( (size_t) 1, (size_t) (MAX_TEST_TIME / warmup_time)));
+            // add trials until their mean is known precisely enough
+            std::vector<double> trial_times;
     
-        double trial_times[NUM_TRIALS];
+            perf_counters &counters = get_perf_counters();
+            counters.start();
     
-        for(size_t trial = 0; trial < NUM_TRIALS; trial++)
-        {
-            timer t;
-            for(size_t i = 0; i < NUM_ITERATIONS; i++){
+            timer test_timer;
+    
+            while(trial_times.size() < options.max_trials)
+            {
+                timer t;
+                for(size_t i = 0; i < NUM_ITERATIONS; i++){
                  
     /************ BEGIN TIMING SECTION ************/
     $TIME
     /************* END TIMING SECTION *************/
     
+                }
+    
+                trial_times.push_back(t.elapsed() / double(NUM_ITERATIONS));
+    
+                if(trial_times.size() >= options.min_trials &&
+                   (timing_statistics(trial_times).relative_error <= options.relative_error || test_timer.elapsed() > options.max_test_time))
+                    break;
             }
     
-            trial_times[trial] = t.elapsed() / double(NUM_ITERATIONS);
-        }
+            // only verbose
+            //for(size_t trial = 0; trial < trial_times.size(); trial++){
+            //    std::cout << "trial[" << trial << "]  : " << trial_times[trial] << " seconds\n";
+            //}
     
-        // only verbose
-        //for(size_t trial = 0; trial < NUM_TRIALS; trial++){
-        //    std::cout << "trial[" << trial << "]  : " << trial_times[trial] << " seconds\n";
-        //}
+            counters.stop();
+    
+            timing_statistics statistics(trial_times);
     
-        double best_time = *std::min_element(trial_times, trial_times + NUM_TRIALS);
+            double best_time = statistics.min;
     
     /************ BEGIN FINALIZE SECTION ************/
     $FINALIZE
     /************* END FINALIZE SECTION *************/
     
+            RECORD_TIME_STATISTICS();
+            RECORD_PERF_COUNTERS();
+        }
+    
+        if(options.temporary_memory)
+            RECORD_TEMPORARY_MEMORY();
+    
 #if THRUST_DEVICE_SYSTEM==THRUST_DEVICE_SYSTEM_CUDA
         cudaError_t error = cudaGetLastError();
         if(error){
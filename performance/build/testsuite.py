@@ -1,6 +1,6 @@
 """functions that generate reports and figures using the .xml output from the performance tests"""
 
-__all__ = ['TestSuite', 'parse_testsuite_xml']
+__all__ = ['TestSuite', 'parse_testsuite_xml', 'Comparison', 'compare_testsuites']
 
 class TestSuite:
     def __init__(self, name, platform, tests):
@@ -13,10 +13,11 @@ class TestSuite:
         return 'TestSuite' + pprint.pformat( (self.name, self.platform, self.tests) ) 
 
 class Test:
-    def __init__(self, name, variables, results):
+    def __init__(self, name, variables, results, status=None):
         self.name = name
         self.variables = variables
         self.results = results
+        self.status = status
 
     def __repr__(self):
         return 'Test' + repr( (self.name, self.variables, self.results) )
@@ -36,6 +37,9 @@ def parse_testsuite_platform(et):
     testsuite_platform = {}
 
     platform_element = et.find('platform')
+    if platform_element is None or platform_element.find('device') is None:
+        return testsuite_platform
+
     device_element = platform_element.find('device')
 
     device = {}
@@ -65,7 +69,11 @@ def parse_testsuite_tests(et):
             # TODO make this a thing that can be converted to its first element when treated like a number
             test_results[result_element.get('name')] = scalar_element(result_element)
         
-        testsuite_tests[test_name] = Test(test_name, test_variables, test_results)
+        # test status: 'Success' or 'Failure'
+        status_element = test_element.find('status')
+        test_status = status_element.get('result') if status_element is not None else None
+
+        testsuite_tests[test_name] = Test(test_name, test_variables, test_results, test_status)
 
     return testsuite_tests
 
@@ -81,3 +89,100 @@ def parse_testsuite_xml(filename):
     return TestSuite(testsuite_name, testsuite_platform, testsuite_tests)
 
 
+class Comparison:
+    """The speedup of a candidate test over a baseline test, baseline time / candidate time,
+    with a confidence interval [lower, upper]"""
+    def __init__(self, name, variables, speedup, lower, upper, regression):
+        self.name = name
+        self.variables = variables
+        self.speedup = speedup
+        self.lower = lower
+        self.upper = upper
+        self.regression = regression
+
+    def __repr__(self):
+        return 'Comparison' + repr( (self.name, self.speedup, self.lower, self.upper, self.regression) )
+
+def timing_summary(test, metric):
+    """returns (time, relative standard error) of a test, using the time statistics
+    recorded by the test when present and a standard error of 0 otherwise"""
+    import math
+
+    if metric in test.results:
+        time = test.results[metric]
+    else:
+        time = test.results.get('Time')
+
+    cv     = test.results.get('Time CV', 0)
+    trials = test.results.get('Trials', 1)
+
+    # the standard error of the median is about 1.25 times that of the mean
+    relative_error = 1.2533 * cv / math.sqrt(max(trials, 1))
+
+    return time, relative_error
+
+def compare_testsuites(baseline, candidate, metric='Median Time', threshold=0.05, z=1.96):
+    """Compare the tests two runs of a test suite have in common
+
+    Tests are matched by name and variables. The speedup of each is
+    baseline time / candidate time, and its confidence interval (at the
+    level given by the normal quantile z) is derived from the relative
+    standard errors of both times. A test regressed when even the upper
+    end of the interval is below 1 / (1 + threshold), i.e. the candidate is
+    significantly more than threshold slower.
+
+    Returns (comparisons, unmatched, failures), where failures lists
+    (name, reason) for the tests of the baseline which the candidate is
+    missing, failed, or has no time for, and unmatched lists the names of
+    the other tests which cannot be compared: those new in the candidate,
+    failed or untimed in the baseline, or whose variables changed
+    """
+    import math
+
+    comparisons = []
+    unmatched = []
+    failures = []
+
+    for name in sorted(set(baseline.tests) | set(candidate.tests)):
+        if name not in candidate.tests:
+            failures.append( (name, 'missing') )
+            continue
+
+        if name not in baseline.tests:
+            unmatched.append(name)
+            continue
+
+        base = baseline.tests[name]
+        cand = candidate.tests[name]
+
+        if cand.status == 'Failure':
+            failures.append( (name, 'failed') )
+            continue
+
+        if base.variables != cand.variables or base.status == 'Failure':
+            unmatched.append(name)
+            continue
+
+        base_time, base_error = timing_summary(base, metric)
+        cand_time, cand_error = timing_summary(cand, metric)
+
+        if not base_time:
+            unmatched.append(name)
+            continue
+
+        if not cand_time:
+            failures.append( (name, 'untimed') )
+            continue
+
+        speedup = float(base_time) / float(cand_time)
+
+        # the relative errors of the two times add in the log of their ratio
+        half_width = z * math.sqrt(base_error**2 + cand_error**2)
+        lower = speedup * math.exp(-half_width)
+        upper = speedup * math.exp(half_width)
+
+        regression = upper < 1.0 / (1.0 + threshold)
+
+        comparisons.append(Comparison(name, base.variables, speedup, lower, upper, regression))
+
+    return comparisons, unmatched, failures
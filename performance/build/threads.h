@@ -0,0 +1,34 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+// Limits the number of threads the omp and tbb systems run algorithms with
+
+#include <omp.h>
+#include <tbb/global_control.h>
+
+inline void set_num_threads(int num_threads)
+{
+  omp_set_num_threads(num_threads);
+
+  // tbb respects the most recently created global_control
+  static tbb::global_control *tbb_control = 0;
+
+  delete tbb_control;
+  tbb_control = new tbb::global_control(tbb::global_control::max_allowed_parallelism, num_threads);
+}
+
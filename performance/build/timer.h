@@ -73,12 +73,13 @@ struct timer
 
 #elif defined(__linux__)
 
-#include <sys/time.h>
+// CLOCK_MONOTONIC is unaffected by adjustments of the system time
+#include <time.h>
 
 struct timer
 {
-  timeval start;
-  timeval end;
+  timespec start;
+  timespec end;
 
   timer(void)
   {
@@ -91,19 +92,22 @@ struct timer
 
   void restart(void)
   {
-    gettimeofday(&start, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &start);
   }
 
   double elapsed(void)
   {
-    gettimeofday(&end, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
 
-    return static_cast<double>(end.tv_sec - start.tv_sec) + 1e-6 * static_cast<double>((int)end.tv_usec - (int)start.tv_usec);
+    return static_cast<double>(end.tv_sec - start.tv_sec) + 1e-9 * static_cast<double>(end.tv_nsec - start.tv_nsec);
   }
 
   double epsilon(void)
   {
-    return 0.5e-6;
+    timespec resolution;
+    clock_getres(CLOCK_MONOTONIC, &resolution);
+
+    return 0.5 * (static_cast<double>(resolution.tv_sec) + 1e-9 * static_cast<double>(resolution.tv_nsec));
   }
 };
 
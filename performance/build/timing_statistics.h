@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+// Summarizes the times of the trials of a test
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+struct timing_statistics
+{
+  std::size_t num_trials;
+  double min;
+  double median;
+  double p90;
+  double mean;
+
+  // the standard deviation over the mean
+  double coefficient_of_variation;
+
+  // the standard error of the mean over the mean
+  double relative_error;
+
+  timing_statistics(std::vector<double> times)
+    : num_trials(times.size()), min(0), median(0), p90(0), mean(0), coefficient_of_variation(0), relative_error(0)
+  {
+    if(times.empty()) return;
+
+    std::sort(times.begin(), times.end());
+
+    const std::size_t n = times.size();
+
+    min    = times[0];
+    median = (n % 2) ? times[n / 2] : 0.5 * (times[n / 2 - 1] + times[n / 2]);
+    p90    = times[static_cast<std::size_t>(std::ceil(0.9 * n)) - 1];
+
+    double sum = 0;
+    for(std::size_t i = 0; i < n; ++i)
+      sum += times[i];
+    mean = sum / n;
+
+    if(n < 2 || mean <= 0) return;
+
+    double sum_of_squares = 0;
+    for(std::size_t i = 0; i < n; ++i)
+      sum_of_squares += (times[i] - mean) * (times[i] - mean);
+
+    double standard_deviation = std::sqrt(sum_of_squares / (n - 1));
+
+    coefficient_of_variation = standard_deviation / mean;
+    relative_error           = coefficient_of_variation / std::sqrt(double(n));
+  }
+};
+
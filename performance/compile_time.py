@@ -0,0 +1,205 @@
+"""Measures how long Thrust's headers take to compile, and how many
+instantiations they emit, with and without thrust/precompiled.h
+
+For each header, compiles a translation unit which only includes it, and,
+for the headers of algorithms, one which also calls the algorithm the way a
+typical program does. The latter is compiled twice, once including
+thrust/precompiled.h, whose extern templates replace the instantiation of
+the algorithm's implementation with a call into the precompiled library.
+
+Writes a testsuite to standard output in the XML format of the other
+performance tests, so that two runs may be compared with
+
+    $ python report.py --compare baseline/compile_time.xml compile_time.xml
+
+Instantiations counts the weak definitions in the object compiled without
+optimization, i.e. the template instantiations and inline functions the
+translation unit emitted, and needs nm.
+"""
+
+import os
+import sys
+import time
+import tempfile
+import subprocess
+
+# (header, code which calls the header's algorithms on device_vector v of int, or None)
+HEADERS = [
+    (None,                            None),
+    ('thrust/functional.h',           None),
+    ('thrust/host_vector.h',          None),
+    ('thrust/device_vector.h',        None),
+    ('thrust/iterator/zip_iterator.h', None),
+    ('thrust/sort.h',                 'thrust::sort(v.begin(), v.end()); thrust::sort(v.begin(), v.end(), thrust::greater<int>());'),
+    ('thrust/reduce.h',               'int sum = thrust::reduce(v.begin(), v.end()); int max = thrust::reduce(v.begin(), v.end(), 0, thrust::maximum<int>());'),
+    ('thrust/scan.h',                 'thrust::inclusive_scan(v.begin(), v.end(), v.begin()); thrust::exclusive_scan(v.begin(), v.end(), v.begin());'),
+    ('thrust/transform.h',            'thrust::transform(v.begin(), v.end(), v.begin(), thrust::negate<int>());'),
+    ('thrust/copy.h',                 'thrust::device_vector<int> w(v.size()); thrust::copy(v.begin(), v.end(), w.begin());'),
+    ('thrust/unique.h',               'v.erase(thrust::unique(v.begin(), v.end()), v.end());'),
+    ('thrust/merge.h',                'thrust::device_vector<int> w(2 * v.size()); thrust::merge(v.begin(), v.end(), v.begin(), v.end(), w.begin());'),
+]
+
+SYSTEMS = {'omp' : 'THRUST_DEVICE_SYSTEM_OMP', 'tbb' : 'THRUST_DEVICE_SYSTEM_TBB'}
+
+
+def make_source(header, code, precompiled):
+    lines = []
+    if precompiled:
+        lines.append('#include <thrust/precompiled.h>')
+    if header is not None:
+        lines.append('#include <%s>' % header)
+    if code is not None:
+        lines.append('#include <thrust/device_vector.h>')
+        lines.append('#include <thrust/functional.h>')
+        lines.append('void f(thrust::device_vector<int> &v)')
+        lines.append('{')
+        lines.append('  ' + code)
+        lines.append('}')
+    lines.append('int main(void) { return 0; }')
+    return '\n'.join(lines) + '\n'
+
+
+def compile_command(options, system, source, output, flags):
+    command = [options.compiler, '-x', 'c++', '-c', source, '-o', output, '-w']
+    command += ['-I' + path for path in options.include_paths]
+    command += ['-DTHRUST_DEVICE_SYSTEM=' + SYSTEMS[system]]
+    if system == 'omp':
+        command += ['-fopenmp']
+    return command + flags + options.flags
+
+
+def run(command):
+    """returns the time in seconds command took, or None when it failed"""
+    devnull = open(os.devnull, 'w')
+    start = time.time()
+    status = subprocess.call(command, stdout = devnull, stderr = devnull)
+    elapsed = time.time() - start
+    devnull.close()
+    if status != 0:
+        return None
+    return elapsed
+
+
+def count_instantiations(object_file):
+    try:
+        output = subprocess.Popen(['nm', object_file], stdout = subprocess.PIPE).communicate()[0]
+    except OSError:
+        return None
+    return len([line for line in output.splitlines() if line.split()[-2:-1] == ['W']])
+
+
+def summarize(times):
+    times = sorted(times)
+    n = len(times)
+    mean = sum(times) / n
+    cv = 0.0
+    if n > 1 and mean > 0:
+        cv = (sum([(t - mean)**2 for t in times]) / (n - 1))**0.5 / mean
+    if n % 2:
+        median = times[n // 2]
+    else:
+        median = (times[n // 2 - 1] + times[n // 2]) / 2
+    return times[0], median, cv
+
+
+def measure(options, system, header, code, precompiled, directory):
+    source = os.path.join(directory, 'tu.cu')
+    output = os.path.join(directory, 'tu.o')
+    open(source, 'w').write(make_source(header, code, precompiled))
+
+    results = []
+
+    times = []
+    for trial in range(options.trials):
+        elapsed = run(compile_command(options, system, source, output, [options.optimization]))
+        if elapsed is None:
+            return None
+        times.append(elapsed)
+
+    min_time, median_time, cv = summarize(times)
+    results.append(('Min Time',    min_time,    'seconds'))
+    results.append(('Median Time', median_time, 'seconds'))
+    results.append(('Time CV',     cv,          ''))
+    results.append(('Trials',      len(times),  ''))
+
+    if run(compile_command(options, system, source, output, ['-O0'])) is not None:
+        count = count_instantiations(output)
+        if count is not None:
+            results.append(('Instantiations', count, ''))
+            results.append(('Object Bytes', os.path.getsize(output), 'bytes'))
+
+    return results
+
+
+def print_test(name, variables, results):
+    print '<test name="%s">' % name
+    for (variable, value) in variables:
+        print '  <variable  name="%s"  value="%s"/>' % (variable, value)
+    if results is None:
+        print '  <status  result="Failure"  message="compilation failed"/>'
+    else:
+        for (result, value, units) in results:
+            print '  <result  name="%s"  value="%s"  units="%s"/>' % (result, value, units)
+        print '  <status  result="Success"  message=""/>'
+    print '</test>'
+    sys.stdout.flush()
+
+
+def main():
+    import optparse
+
+    this_dir = os.path.dirname(os.path.abspath(__file__))
+
+    parser = optparse.OptionParser(usage = "usage: %prog [options] > compile_time.xml")
+    parser.add_option('--compiler', default = os.environ.get('CXX', 'g++'),
+                      help = 'the host compiler [default: %default]')
+    parser.add_option('--system', action = 'append', dest = 'systems', choices = sorted(SYSTEMS.keys()),
+                      help = 'a device system to measure, may be repeated [default: omp]')
+    parser.add_option('--trials', type = 'int', default = 5,
+                      help = 'the number of times each translation unit is compiled [default: %default]')
+    parser.add_option('--optimization', default = '-O2',
+                      help = 'the optimization flag of the timed compilations [default: %default]')
+    parser.add_option('--include-path', action = 'append', dest = 'include_paths', default = [os.path.join(this_dir, '..')],
+                      help = 'an additional include path, e.g. TBB\'s')
+    parser.add_option('--flag', action = 'append', dest = 'flags', default = [],
+                      help = 'an additional compiler flag')
+    parser.add_option('--header', action = 'append', dest = 'headers',
+                      help = 'a header to measure, e.g. thrust/sort.h, may be repeated [default: all]')
+    parser.add_option('--no-precompiled', action = 'store_false', dest = 'precompiled', default = True,
+                      help = 'skip the compilations which include thrust/precompiled.h')
+
+    (options, args) = parser.parse_args()
+
+    systems = options.systems or ['omp']
+    headers = [(h,c) for (h,c) in HEADERS if options.headers is None or h in options.headers]
+
+    directory = tempfile.mkdtemp()
+
+    print '<?xml version="1.0" ?>'
+    print '<testsuite  name="compile_time">'
+
+    try:
+        for system in systems:
+            for (header, code) in headers:
+                scenarios = [('include', None, 'no')]
+                if code is not None:
+                    scenarios.append(('instantiate', code, 'no'))
+                    if options.precompiled:
+                        scenarios.append(('instantiate', code, 'yes'))
+
+                for (scenario, scenario_code, precompiled) in scenarios:
+                    header_name = header or 'none'
+                    variables = [('Header', header_name), ('Scenario', scenario), ('System', system), ('Precompiled', precompiled)]
+                    name = '_'.join(['compile_time'] + [str(v).replace('/','_').replace('.','_') for (n,v) in variables])
+                    results = measure(options, system, header, scenario_code, precompiled == 'yes', directory)
+                    print_test(name, variables, results)
+    finally:
+        for f in os.listdir(directory):
+            os.remove(os.path.join(directory, f))
+        os.rmdir(directory)
+
+    print '</testsuite>'
+
+
+if __name__ == '__main__':
+    main()
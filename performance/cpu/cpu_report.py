@@ -0,0 +1,68 @@
+import os
+import sys
+
+sys.path.insert(0, os.path.abspath('..'))
+from build import plot_scaling, print_scaling, plot_memory, print_memory, print_penalty, print_bandwidth
+
+#valid formats are png, pdf, ps, eps and svg
+#if format=None the plots will be displayed
+format = 'png'
+#output = print_scaling
+output = plot_scaling
+#memory_output = print_memory
+memory_output = plot_memory
+
+# the size at which the tests are compared
+InputSize = 2**24
+
+for function in ['reduce', 'inclusive_scan']:
+    output(function + '.xml', {'InputType' : 'int', 'InputSize' : InputSize}, format=format)
+
+for function in ['transform']:
+    output(function + '.xml', {'InputType' : 'float', 'InputSize' : InputSize}, format=format)
+
+for function in ['copy_if', 'reduce_by_key', 'stable_partition']:
+    output(function + '.xml', {'InputType' : 'int', 'InputSize' : InputSize}, format=format)
+
+for function in ['merge', 'unique']:
+    output(function + '.xml', {'InputType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, format=format)
+
+for method in ['sort', 'stable_sort']:
+    output('sort.xml', {'Sort' : method, 'KeyType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, title='thrust::' + method, format=format)
+
+output('sort_by_key.xml', {'KeyType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, format=format)
+
+# the temporary storage each algorithm obtains, as a function of input size,
+# with a curve for each system and number of threads
+for function in ['reduce', 'inclusive_scan', 'copy_if', 'reduce_by_key', 'stable_partition']:
+    memory_output(function + '.xml', {'InputType' : 'int'}, format=format)
+
+for function in ['merge', 'unique']:
+    memory_output(function + '.xml', {'InputType' : 'int', 'Distribution' : 'uniform'}, format=format)
+
+memory_output('transform.xml', {'InputType' : 'float'}, format=format)
+
+for method in ['sort', 'stable_sort']:
+    memory_output('sort.xml', {'Sort' : method, 'KeyType' : 'int', 'Distribution' : 'uniform'}, title='thrust::' + method, format=format)
+
+memory_output('sort_by_key.xml', {'KeyType' : 'int', 'Distribution' : 'uniform'}, format=format)
+
+# the time of each iterator adaptor stack relative to a hand-written loop computing the same
+print_penalty('abstraction_penalty.xml', {'Implementation' : 'raw_loop'})
+
+# the time of each algorithm on each distribution of input relative to uniform input
+for function in ['sort', 'sort_by_key', 'merge', 'unique']:
+    print_penalty(function + '.xml', {'Distribution' : 'uniform'}, ignored_variables=[])
+
+# the bandwidth of each algorithm, against the minimum traffic it needs, as a fraction of the
+# peak bandwidth measured by the benchmark. the lowest fractions show the most wasted traffic
+for function in ['reduce', 'inclusive_scan', 'copy_if', 'reduce_by_key', 'stable_partition']:
+    print_bandwidth(function + '.xml', {'InputType' : 'int', 'InputSize' : InputSize}, title=function)
+
+for function in ['merge', 'unique']:
+    print_bandwidth(function + '.xml', {'InputType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, title=function)
+
+print_bandwidth('transform.xml', {'InputType' : 'float', 'InputSize' : InputSize}, title='transform')
+print_bandwidth('sort.xml', {'KeyType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, title='sort')
+print_bandwidth('sort_by_key.xml', {'KeyType' : 'int', 'Distribution' : 'uniform', 'InputSize' : InputSize}, title='sort_by_key')
+print_bandwidth('abstraction_penalty.xml', {'InputSize' : 2**24}, title='abstraction_penalty')
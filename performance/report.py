@@ -1,30 +1,79 @@
-from build import plot_results, print_results
+import os
+import sys
 
-#valid formats are png, pdf, ps, eps and svg
-#if format=None the plot will be displayed
-format = 'png'
-#output = print_results
-output = plot_results
+from build import plot_results, print_results, print_comparison
 
-for function in ['fill', 'reduce', 'inner_product', 'gather', 'merge']:
-    output(function + '.xml', 'InputType', 'InputSize', 'Bandwidth', format=format)
 
-for function in ['inclusive_scan', 'inclusive_segmented_scan', 'unique']:
-    output(function + '.xml', 'InputType', 'InputSize', 'Throughput', format=format)
+def plot_reports():
+    #valid formats are png, pdf, ps, eps and svg
+    #if format=None the plot will be displayed
+    format = 'png'
+    #output = print_results
+    output = plot_results
 
-for method in ['indirect_sort']:
-    output(method + '.xml',    'Sort', 'VectorLength', 'Time', plot='semilogx', title='Indirect Sorting', format=format)
+    for function in ['fill', 'reduce', 'inner_product', 'gather', 'merge']:
+        output(function + '.xml', 'InputType', 'InputSize', 'Bandwidth', format=format)
 
-for method in ['sort', 'merge_sort', 'radix_sort']:
-    output(method + '.xml',    'KeyType', 'InputSize', 'Sorting', title='thrust::' + method, format=format)
-    output(method + '_by_key.xml', 'KeyType', 'InputSize', 'Sorting', title='thrust::' + method + '_by_key', format=format)
-    
-output('stl_sort.xml', 'KeyType', 'InputSize', 'Sorting', title='std::sort', format=format)
+    for function in ['inclusive_scan', 'inclusive_segmented_scan', 'unique']:
+        output(function + '.xml', 'InputType', 'InputSize', 'Throughput', format=format)
 
-for method in ['radix_sort']:
-    output(method + '_bits.xml', 'KeyType', 'KeyBits', 'Sorting', title='thrust::' + method, plot='plot', dpi=72, format=format)
+    for method in ['indirect_sort']:
+        output(method + '.xml',    'Sort', 'VectorLength', 'Time', plot='semilogx', title='Indirect Sorting', format=format)
 
-for format in ['png', 'pdf']:
-    output('reduce_float.xml', 'InputType', 'InputSize', 'Bandwidth', dpi=120, plot='semilogx', title='thrust::reduce<float>()', format=format)
-    output('sort_large.xml',  'KeyType', 'InputSize', 'Sorting', dpi=120, plot='semilogx', title='thrust::sort<T>()', format=format)
+    for method in ['sort', 'merge_sort', 'radix_sort']:
+        output(method + '.xml',    'KeyType', 'InputSize', 'Sorting', title='thrust::' + method, format=format)
+        output(method + '_by_key.xml', 'KeyType', 'InputSize', 'Sorting', title='thrust::' + method + '_by_key', format=format)
 
+    output('stl_sort.xml', 'KeyType', 'InputSize', 'Sorting', title='std::sort', format=format)
+
+    for method in ['radix_sort']:
+        output(method + '_bits.xml', 'KeyType', 'KeyBits', 'Sorting', title='thrust::' + method, plot='plot', dpi=72, format=format)
+
+    for format in ['png', 'pdf']:
+        output('reduce_float.xml', 'InputType', 'InputSize', 'Bandwidth', dpi=120, plot='semilogx', title='thrust::reduce<float>()', format=format)
+        output('sort_large.xml',  'KeyType', 'InputSize', 'Sorting', dpi=120, plot='semilogx', title='thrust::sort<T>()', format=format)
+
+
+def compare_reports(baseline, candidate, metric, threshold, verbose):
+    """Compare the reports of two runs, either two XML files or two directories of
+    them, and return the number of tests which regressed or failed, counting each
+    report of the baseline which the candidate is missing as a failure"""
+
+    if os.path.isdir(baseline):
+        pairs = [(os.path.join(baseline, f), os.path.join(candidate, f)) for f in sorted(os.listdir(baseline))
+                 if f.endswith('.xml')]
+    else:
+        pairs = [(baseline, candidate)]
+
+    failures = 0
+    for baseline_file, candidate_file in pairs:
+        if not os.path.exists(candidate_file):
+            print '%s: FAILED, missing report' % candidate_file
+            failures += 1
+            continue
+
+        failures += print_comparison(baseline_file, candidate_file, metric, threshold, verbose)
+
+    return failures
+
+
+if __name__ == '__main__':
+    import optparse
+
+    parser = optparse.OptionParser(usage = "usage: %prog [--compare BASELINE CANDIDATE [options]]")
+    parser.add_option('--compare', nargs = 2, metavar = 'BASELINE CANDIDATE',
+                      help = 'compare two runs, given as .xml files or directories of them, and exit with status 1 if any test regressed, failed, or is missing')
+    parser.add_option('--metric', default = 'Median Time',
+                      help = 'the time result to compare [default: %default]')
+    parser.add_option('--threshold', type = 'float', default = 0.05,
+                      help = 'the slowdown beyond which a significant difference is a regression [default: %default]')
+    parser.add_option('--verbose', action = 'store_true', default = False,
+                      help = 'print every comparison, not only regressions')
+
+    (options, args) = parser.parse_args()
+
+    if options.compare:
+        failures = compare_reports(options.compare[0], options.compare[1], options.metric, options.threshold, options.verbose)
+        sys.exit(1 if failures else 0)
+    else:
+        plot_reports()
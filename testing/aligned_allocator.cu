@@ -0,0 +1,74 @@
+#include <unittest/unittest.h>
+#include <thrust/host_vector.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/allocator/allocator_alignment.h>
+
+template<typename Vector>
+bool is_aligned(const Vector &v, std::size_t alignment)
+{
+  return thrust::detail::uintptr_t(thrust::raw_pointer_cast(v.data())) % alignment == 0;
+}
+
+
+void TestAlignedAllocator(void)
+{
+  typedef thrust::cpp::aligned_allocator<float> Alloc;
+
+  ASSERT_EQUAL(64u, Alloc::alignment);
+
+  thrust::host_vector<float, Alloc> v(3, 1.0f);
+  ASSERT_EQUAL(true, is_aligned(v, 64));
+
+  // storage stays aligned as it grows
+  for(int i = 0; i < 1000; ++i)
+  {
+    v.push_back(float(i));
+    ASSERT_EQUAL(true, is_aligned(v, 64));
+  }
+
+  ASSERT_EQUAL(1003u, v.size());
+  ASSERT_EQUAL(1.0f, v[2]);
+  ASSERT_EQUAL(999.0f, v[1002]);
+
+  thrust::cpp::vector<char, thrust::cpp::aligned_allocator<char, 4096> > w(5);
+  ASSERT_EQUAL(true, is_aligned(w, 4096));
+}
+DECLARE_UNITTEST(TestAlignedAllocator);
+
+
+void TestAllocatorAlignment(void)
+{
+  using thrust::detail::allocator_alignment;
+
+  ASSERT_EQUAL(64u,   size_t(allocator_alignment<thrust::cpp::aligned_allocator<float> >::value));
+  ASSERT_EQUAL(4096u, size_t(allocator_alignment<thrust::cpp::aligned_allocator<char, 4096> >::value));
+
+  // the alignment of rebound allocators is unchanged
+  ASSERT_EQUAL(128u,  size_t(allocator_alignment<thrust::cpp::aligned_allocator<char, 128>::rebind<double>::other>::value));
+
+  // allocators which guarantee nothing more than the alignment of their elements
+  ASSERT_EQUAL(1u,    size_t(allocator_alignment<thrust::cpp::allocator<float> >::value));
+  ASSERT_EQUAL(1u,    size_t(allocator_alignment<std::allocator<float> >::value));
+}
+DECLARE_UNITTEST(TestAllocatorAlignment);
+
+
+void TestAlignedAllocatorLarge(void)
+{
+  // large enough to be backed by huge pages
+  const size_t n = (4 << 20) + 1;
+
+  thrust::cpp::vector<int, thrust::cpp::aligned_allocator<int> > v(n);
+  ASSERT_EQUAL(true, is_aligned(v, 2 << 20));
+
+  thrust::sequence(v.begin(), v.end());
+  thrust::sort(v.begin(), v.end(), thrust::greater<int>());
+
+  ASSERT_EQUAL(int(n - 1), v[0]);
+  ASSERT_EQUAL(0, v[n - 1]);
+}
+DECLARE_UNITTEST(TestAlignedAllocatorLarge);
@@ -0,0 +1,48 @@
+#include <unittest/unittest.h>
+#include <thrust/system/omp/vector.h>
+#include <thrust/sort.h>
+#include <thrust/sequence.h>
+#include <thrust/reverse.h>
+
+void TestOmpPagePlacement(void)
+{
+  ASSERT_EQUAL(thrust::omp::first_touch_placement, thrust::omp::get_page_placement());
+
+  thrust::omp::set_page_placement(thrust::omp::interleaved_placement);
+  ASSERT_EQUAL(thrust::omp::interleaved_placement, thrust::omp::get_page_placement());
+
+  thrust::omp::set_page_placement(thrust::omp::first_touch_placement);
+  ASSERT_EQUAL(thrust::omp::first_touch_placement, thrust::omp::get_page_placement());
+}
+DECLARE_UNITTEST(TestOmpPagePlacement);
+
+
+void TestOmpPagePlacementVector(void)
+{
+  const size_t n = 1 << 20;
+
+  thrust::omp::page_placement placements[] = { thrust::omp::first_touch_placement, thrust::omp::interleaved_placement };
+
+  for(int i = 0; i < 2; ++i)
+  {
+    thrust::omp::set_page_placement(placements[i]);
+
+    // large enough to be placed in parallel, and for stable_sort's temporary buffers to be too
+    thrust::omp::vector<int> v(n, thrust::first_touch);
+    thrust::sequence(v.begin(), v.end());
+    thrust::reverse(v.begin(), v.end());
+    thrust::stable_sort(v.begin(), v.end());
+
+    ASSERT_EQUAL(0, v[0]);
+    ASSERT_EQUAL(int(n - 1), v[n - 1]);
+    ASSERT_EQUAL(true, thrust::is_sorted(v.begin(), v.end()));
+
+    // the storage of an odd size and alignment is placed and usable to its last element
+    thrust::omp::vector<char> w(n + 13, thrust::first_touch);
+    w[n + 12] = 7;
+    ASSERT_EQUAL(7, w[n + 12]);
+  }
+
+  thrust::omp::set_page_placement(thrust::omp::first_touch_placement);
+}
+DECLARE_UNITTEST(TestOmpPagePlacementVector);
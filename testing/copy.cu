@@ -161,6 +161,37 @@ void TestCopyMixedTypes(void)
 DECLARE_VECTOR_UNITTEST(TestCopyMixedTypes);
 
 
+template <typename T>
+void TestCopyOffsets(const size_t n)
+{
+    thrust::host_vector<T>   h_data = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_data = h_data;
+
+    // source and destination misaligned with respect to one another
+    {
+        thrust::host_vector<T>   h_result(n + 3, (T) 0);
+        thrust::device_vector<T> d_result(n + 3, (T) 0);
+
+        thrust::copy(h_data.begin() + std::min((size_t)1, n), h_data.end(), h_result.begin() + 3);
+        thrust::copy(d_data.begin() + std::min((size_t)1, n), d_data.end(), d_result.begin() + 3);
+
+        ASSERT_EQUAL(h_result, d_result);
+    }
+
+    // overlapping source and destination
+    {
+        thrust::host_vector<T>   h_result = h_data;
+        thrust::device_vector<T> d_result = d_data;
+
+        thrust::copy(h_result.begin() + std::min((size_t)5, n), h_result.end(), h_result.begin());
+        thrust::copy(d_result.begin() + std::min((size_t)5, n), d_result.end(), d_result.begin());
+
+        ASSERT_EQUAL(h_result, d_result);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestCopyOffsets);
+
+
 void TestCopyVectorBool(void)
 {
     std::vector<bool> v(3);
@@ -0,0 +1,199 @@
+#include <unittest/unittest.h>
+#include <thrust/copy.h>
+#include <thrust/remove.h>
+#include <thrust/functional.h>
+#include <vector>
+
+// contiguous 4- and 8-byte elements are compacted a tile at a time, and a vector at a time
+// when built with AVX2, so these tests use sizes which are not multiples of either, and
+// predicates which select few, about half, and most of the elements
+
+static const size_t copy_if_sizes[] = {0, 1, 7, 255, 256, 257, 1000, 4099, 10007};
+
+// the percentages of elements the tests select
+static const unsigned int copy_if_selectivities[] = {5, 50, 95};
+
+template<typename T>
+struct is_selected
+  : thrust::unary_function<T,bool>
+{
+    unsigned int percentage;
+
+    is_selected(unsigned int percentage) : percentage(percentage) {}
+
+    __host__ __device__
+    bool operator()(T x) const
+    {
+        // scramble the value, so that selected and rejected elements are interleaved irregularly
+        unsigned int h = static_cast<unsigned int>(static_cast<unsigned long long>(x)) * 2654435761u;
+        return (h >> 16) % 100 < percentage;
+    }
+};
+
+
+template<typename Vector>
+void CheckCopyIf(const std::vector<typename Vector::value_type> &data,
+                 const std::vector<unsigned int> &stencil,
+                 unsigned int percentage)
+{
+    typedef typename Vector::value_type T;
+
+    is_selected<T>            pred(percentage);
+    is_selected<unsigned int> stencil_pred(percentage);
+
+    thrust::host_vector<T> ref, ref_stencil;
+    for(size_t i = 0; i < data.size(); i++)
+    {
+        if(pred(data[i]))                 ref.push_back(data[i]);
+        if(stencil_pred(stencil[i]))      ref_stencil.push_back(data[i]);
+    }
+
+    Vector input(data.begin(), data.end());
+    Vector input_stencil(stencil.begin(), stencil.end());
+
+    Vector result(data.size());
+    typename Vector::iterator end = thrust::copy_if(input.begin(), input.end(), result.begin(), pred);
+
+    ASSERT_EQUAL(ref.size(), end - result.begin());
+    result.resize(end - result.begin());
+    ASSERT_EQUAL(ref, result);
+
+    result.resize(data.size());
+    end = thrust::copy_if(input.begin(), input.end(), input_stencil.begin(), result.begin(), stencil_pred);
+
+    ASSERT_EQUAL(ref_stencil.size(), end - result.begin());
+    result.resize(end - result.begin());
+    ASSERT_EQUAL(ref_stencil, result);
+}
+
+
+template<typename T>
+void TestCopyIfTrivialWithType(void)
+{
+    for(size_t i = 0; i < sizeof(copy_if_sizes) / sizeof(size_t); i++)
+    {
+        size_t n = copy_if_sizes[i];
+
+        // distinct values, so that the order of the result is observable
+        std::vector<T> data(n);
+        std::vector<unsigned int> stencil(n);
+        for(size_t j = 0; j < n; j++)
+        {
+            data[j]    = T(j);
+            stencil[j] = static_cast<unsigned int>(n - j);
+        }
+
+        for(size_t k = 0; k < sizeof(copy_if_selectivities) / sizeof(unsigned int); k++)
+        {
+            CheckCopyIf< thrust::host_vector<T> >(data, stencil, copy_if_selectivities[k]);
+            CheckCopyIf< thrust::device_vector<T> >(data, stencil, copy_if_selectivities[k]);
+        }
+    }
+}
+
+void TestCopyIfTrivial(void)
+{
+    TestCopyIfTrivialWithType<int>();
+    TestCopyIfTrivialWithType<unsigned int>();
+    TestCopyIfTrivialWithType<float>();
+    TestCopyIfTrivialWithType<long long>();
+    TestCopyIfTrivialWithType<unsigned long long>();
+    TestCopyIfTrivialWithType<double>();
+}
+DECLARE_UNITTEST(TestCopyIfTrivial);
+
+
+template<typename Vector>
+void CheckRemoveIf(const std::vector<typename Vector::value_type> &data,
+                   const std::vector<unsigned int> &stencil,
+                   unsigned int percentage)
+{
+    typedef typename Vector::value_type T;
+
+    is_selected<T>            pred(percentage);
+    is_selected<unsigned int> stencil_pred(percentage);
+
+    // the removed elements are zero, and the others distinct
+    thrust::host_vector<T> ref, ref_stencil;
+    for(size_t i = 0; i < data.size(); i++)
+    {
+        if(data[i] != T(0))               ref.push_back(data[i]);
+        if(!stencil_pred(stencil[i]))     ref_stencil.push_back(data[i]);
+    }
+
+    Vector input(data.begin(), data.end());
+    Vector input_stencil(stencil.begin(), stencil.end());
+    Vector result(data.size());
+
+    // remove_copy
+    typename Vector::iterator end = thrust::remove_copy(input.begin(), input.end(), result.begin(), T(0));
+    ASSERT_EQUAL(ref.size(), end - result.begin());
+    result.resize(end - result.begin());
+    ASSERT_EQUAL(ref, result);
+
+    // remove_copy_if with a stencil
+    result.resize(data.size());
+    end = thrust::remove_copy_if(input.begin(), input.end(), input_stencil.begin(), result.begin(), stencil_pred);
+    ASSERT_EQUAL(ref_stencil.size(), end - result.begin());
+    result.resize(end - result.begin());
+    ASSERT_EQUAL(ref_stencil, result);
+
+    // remove_if with a stencil, in place
+    Vector data_copy = input;
+    end = thrust::remove_if(data_copy.begin(), data_copy.end(), input_stencil.begin(), stencil_pred);
+    ASSERT_EQUAL(ref_stencil.size(), end - data_copy.begin());
+    data_copy.resize(end - data_copy.begin());
+    ASSERT_EQUAL(ref_stencil, data_copy);
+
+    // remove, in place
+    data_copy = input;
+    end = thrust::remove(data_copy.begin(), data_copy.end(), T(0));
+    ASSERT_EQUAL(ref.size(), end - data_copy.begin());
+    data_copy.resize(end - data_copy.begin());
+    ASSERT_EQUAL(ref, data_copy);
+
+    // remove_if, in place, removes the elements which are not zero
+    data_copy = input;
+    end = thrust::remove_if(data_copy.begin(), data_copy.end(), thrust::identity<T>());
+    ASSERT_EQUAL(data.size() - ref.size(), end - data_copy.begin());
+    data_copy.resize(end - data_copy.begin());
+    ASSERT_EQUAL(thrust::host_vector<T>(data.size() - ref.size(), T(0)), data_copy);
+}
+
+
+template<typename T>
+void TestRemoveIfTrivialWithType(void)
+{
+    for(size_t i = 0; i < sizeof(copy_if_sizes) / sizeof(size_t); i++)
+    {
+        size_t n = copy_if_sizes[i];
+
+        std::vector<unsigned int> stencil(n);
+        for(size_t j = 0; j < n; j++)
+            stencil[j] = static_cast<unsigned int>(j);
+
+        for(size_t k = 0; k < sizeof(copy_if_selectivities) / sizeof(unsigned int); k++)
+        {
+            is_selected<unsigned int> pred(copy_if_selectivities[k]);
+
+            // the selected fraction of the elements is zero, to be removed
+            std::vector<T> data(n);
+            for(size_t j = 0; j < n; j++)
+                data[j] = pred(stencil[j]) ? T(0) : T(j + 1);
+
+            CheckRemoveIf< thrust::host_vector<T> >(data, stencil, copy_if_selectivities[k]);
+            CheckRemoveIf< thrust::device_vector<T> >(data, stencil, copy_if_selectivities[k]);
+        }
+    }
+}
+
+void TestRemoveIfTrivial(void)
+{
+    TestRemoveIfTrivialWithType<int>();
+    TestRemoveIfTrivialWithType<unsigned int>();
+    TestRemoveIfTrivialWithType<float>();
+    TestRemoveIfTrivialWithType<long long>();
+    TestRemoveIfTrivialWithType<unsigned long long>();
+    TestRemoveIfTrivialWithType<double>();
+}
+DECLARE_UNITTEST(TestRemoveIfTrivial);
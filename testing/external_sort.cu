@@ -0,0 +1,149 @@
+#include <unittest/unittest.h>
+#include <thrust/external_sort.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+template<typename T>
+std::string to_bytes(const thrust::host_vector<T> &data)
+{
+    return std::string(reinterpret_cast<const char*>(thrust::raw_pointer_cast(data.data())), data.size() * sizeof(T));
+}
+
+template<typename T>
+thrust::host_vector<T> from_bytes(const std::string &bytes)
+{
+    thrust::host_vector<T> result(bytes.size() / sizeof(T));
+    bytes.copy(reinterpret_cast<char*>(thrust::raw_pointer_cast(result.data())), bytes.size());
+    return result;
+}
+
+
+template<typename T>
+void TestExternalSort(const size_t n)
+{
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_ref  = h_data;
+
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+
+    // in memory, with a single run, and with too many runs to merge at once
+    const size_t memory_bytes[] = {1 << 24, 1 << 18, 1 << 12};
+
+    for(size_t i = 0; i < sizeof(memory_bytes) / sizeof(size_t); ++i)
+    {
+        std::istringstream input(to_bytes(h_data), std::ios::binary);
+        std::ostringstream output(std::ios::binary);
+
+        thrust::external_sort<T>(input, output, memory_bytes[i]);
+
+        ASSERT_EQUAL(h_ref, from_bytes<T>(output.str()));
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestExternalSort);
+
+
+void TestExternalSortDescending(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(20000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    thrust::stable_sort(h_ref.begin(), h_ref.end(), thrust::greater<int>());
+
+    std::istringstream input(to_bytes(h_data), std::ios::binary);
+    std::ostringstream output(std::ios::binary);
+
+    thrust::external_sort<int>(input, output, 1 << 14, thrust::greater<int>());
+
+    ASSERT_EQUAL(h_ref, from_bytes<int>(output.str()));
+}
+DECLARE_UNITTEST(TestExternalSortDescending);
+
+
+void TestExternalSortByKey(void)
+{
+    const size_t n = 30000;
+
+    // many equal keys, so that stability is observable
+    thrust::host_vector<unsigned char> h_keys = unittest::random_integers<unsigned char>(n);
+    thrust::host_vector<int> h_values(n);
+    for(size_t i = 0; i < n; ++i)
+        h_values[i] = i;
+
+    thrust::host_vector<unsigned char> h_ref_keys   = h_keys;
+    thrust::host_vector<int>           h_ref_values = h_values;
+
+    thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), thrust::greater<unsigned char>());
+
+    std::istringstream keys_input(to_bytes(h_keys), std::ios::binary);
+    std::istringstream values_input(to_bytes(h_values), std::ios::binary);
+    std::ostringstream keys_output(std::ios::binary);
+    std::ostringstream values_output(std::ios::binary);
+
+    thrust::external_sort_by_key<unsigned char,int>(keys_input, values_input, keys_output, values_output, 1 << 13, thrust::greater<unsigned char>());
+
+    ASSERT_EQUAL(h_ref_keys,   from_bytes<unsigned char>(keys_output.str()));
+    ASSERT_EQUAL(h_ref_values, from_bytes<int>(values_output.str()));
+}
+DECLARE_UNITTEST(TestExternalSortByKey);
+
+
+void TestExternalSortByKeyFiles(void)
+{
+    const char *keys_filename          = "thrust_test_external_sort_keys.bin";
+    const char *values_filename        = "thrust_test_external_sort_values.bin";
+    const char *sorted_keys_filename   = "thrust_test_external_sort_sorted_keys.bin";
+    const char *sorted_values_filename = "thrust_test_external_sort_sorted_values.bin";
+
+    thrust::host_vector<int>   h_keys   = unittest::random_integers<int>(10000);
+    thrust::host_vector<float> h_values = unittest::random_samples<float>(10000);
+
+    {
+        std::FILE *keys   = std::fopen(keys_filename,   "wb");
+        std::FILE *values = std::fopen(values_filename, "wb");
+        std::fwrite(thrust::raw_pointer_cast(h_keys.data()),   sizeof(int),   h_keys.size(),   keys);
+        std::fwrite(thrust::raw_pointer_cast(h_values.data()), sizeof(float), h_values.size(), values);
+        std::fclose(keys);
+        std::fclose(values);
+    }
+
+    thrust::external_sort_by_key<int,float>(keys_filename, values_filename, sorted_keys_filename, sorted_values_filename, 1 << 14);
+
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+
+    thrust::host_vector<int>   h_sorted_keys(h_keys.size());
+    thrust::host_vector<float> h_sorted_values(h_values.size());
+
+    {
+        std::FILE *keys   = std::fopen(sorted_keys_filename,   "rb");
+        std::FILE *values = std::fopen(sorted_values_filename, "rb");
+        ASSERT_EQUAL(std::fread(thrust::raw_pointer_cast(h_sorted_keys.data()),   sizeof(int),   h_keys.size(),       keys),   h_keys.size());
+        ASSERT_EQUAL(std::fread(thrust::raw_pointer_cast(h_sorted_values.data()), sizeof(float), h_values.size(),     values), h_values.size());
+        std::fclose(keys);
+        std::fclose(values);
+    }
+
+    ASSERT_EQUAL(h_keys,   h_sorted_keys);
+    ASSERT_EQUAL(h_values, h_sorted_values);
+
+    // the values are now fewer than the keys
+    std::FILE *values = std::fopen(values_filename, "wb");
+    std::fwrite(thrust::raw_pointer_cast(h_values.data()), sizeof(float), h_values.size() / 2, values);
+    std::fclose(values);
+
+    typedef void (*sort_by_key_files)(const char*, const char*, const char*, const char*, size_t);
+    sort_by_key_files sort_by_key = thrust::external_sort_by_key<int,float>;
+
+    ASSERT_THROWS(sort_by_key(keys_filename, values_filename, sorted_keys_filename, sorted_values_filename, 1 << 14),
+                  thrust::system_error);
+
+    std::remove(keys_filename);
+    std::remove(values_filename);
+    std::remove(sorted_keys_filename);
+    std::remove(sorted_values_filename);
+}
+DECLARE_UNITTEST(TestExternalSortByKeyFiles);
+
@@ -0,0 +1,29 @@
+// thrust/fill.h is included before any other header on purpose: the omp and tbb
+// fills must find the generic fill even when their headers are reached through it
+#include <thrust/fill.h>
+#include <thrust/device_vector.h>
+#include <unittest/unittest.h>
+
+struct fill_include_order_triple
+{
+    int x, y, z;
+};
+
+void TestFillIncludeOrderNonTrivialType(void)
+{
+    fill_include_order_triple value = {1, 2, 3};
+
+    thrust::device_vector<fill_include_order_triple> v(10);
+
+    thrust::fill(v.begin(), v.end(), value);
+    thrust::fill_n(v.begin(), 3, value);
+
+    for(size_t i = 0; i < v.size(); i++)
+    {
+        fill_include_order_triple t = v[i];
+        ASSERT_EQUAL(t.x, 1);
+        ASSERT_EQUAL(t.y, 2);
+        ASSERT_EQUAL(t.z, 3);
+    }
+}
+DECLARE_UNITTEST(TestFillIncludeOrderNonTrivialType);
@@ -0,0 +1,196 @@
+#include <unittest/unittest.h>
+#include <thrust/low_memory_monitor.h>
+#include <thrust/scratch_arena.h>
+#include <thrust/partition.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <vector>
+
+template<typename T>
+struct is_even
+{
+    __host__ __device__
+    bool operator()(T x) const { return (static_cast<int>(x) & 1) == 0; }
+};
+
+
+void TestLowMemoryMonitorFullBuffer(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+
+    thrust::low_memory_monitor monitor;
+
+    thrust::stable_sort(h_data.begin(), h_data.end());
+
+    ASSERT_EQUAL(monitor.worst_mode(), thrust::low_memory_monitor::full_buffer);
+    ASSERT_EQUAL(monitor.num_fallbacks(), 0u);
+}
+DECLARE_UNITTEST(TestLowMemoryMonitorFullBuffer);
+
+
+template<typename T>
+void TestLowMemoryMonitorSort(const size_t n)
+{
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_ref  = h_data;
+
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+
+    // no temporary storage at all, and a little
+    const size_t region_bytes[] = {0, 4096};
+
+    std::vector<char> region(4096);
+
+    for(size_t i = 0; i < sizeof(region_bytes) / sizeof(size_t); ++i)
+    {
+        thrust::host_vector<T> h_result = h_data;
+
+        thrust::low_memory_monitor monitor;
+
+        {
+            thrust::scratch_arena arena(&region[0], region_bytes[i], thrust::scratch_arena::fail);
+
+            thrust::stable_sort(h_result.begin(), h_result.end());
+        }
+
+        ASSERT_EQUAL(h_ref, h_result);
+
+        // inputs larger than the region cannot have been sorted with all the storage asked for
+        if(n * sizeof(T) > region.size())
+        {
+            ASSERT_EQUAL(monitor.worst_mode() != thrust::low_memory_monitor::full_buffer, true);
+            ASSERT_GEQUAL(monitor.num_fallbacks(), 1u);
+        }
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestLowMemoryMonitorSort);
+
+
+void TestLowMemoryMonitorSortByKey(void)
+{
+    const size_t n = 20000;
+
+    // many equal keys, so that stability is observable
+    thrust::host_vector<unsigned char> h_keys = unittest::random_integers<unsigned char>(n);
+    thrust::host_vector<int> h_values(n);
+    for(size_t i = 0; i < n; ++i)
+        h_values[i] = i;
+
+    thrust::host_vector<unsigned char> h_ref_keys   = h_keys;
+    thrust::host_vector<int>           h_ref_values = h_values;
+
+    thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), thrust::greater<unsigned char>());
+
+    thrust::low_memory_monitor monitor;
+
+    {
+        char region[1024];
+        thrust::scratch_arena arena(region, sizeof(region), thrust::scratch_arena::fail);
+
+        thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), thrust::greater<unsigned char>());
+    }
+
+    ASSERT_EQUAL(h_ref_keys,   h_keys);
+    ASSERT_EQUAL(h_ref_values, h_values);
+    ASSERT_EQUAL(monitor.worst_mode() != thrust::low_memory_monitor::full_buffer, true);
+}
+DECLARE_UNITTEST(TestLowMemoryMonitorSortByKey);
+
+
+template<typename Vector>
+void TestLowMemoryMonitorStablePartition(void)
+{
+    typedef typename Vector::value_type T;
+
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(5000);
+    thrust::host_vector<T> h_ref  = h_data;
+
+    thrust::stable_partition(h_ref.begin(), h_ref.end(), is_even<T>());
+
+    Vector data = h_data;
+
+    thrust::low_memory_monitor monitor;
+
+    {
+        char region[512];
+        thrust::scratch_arena arena(region, sizeof(region), thrust::scratch_arena::fail);
+
+        thrust::stable_partition(data.begin(), data.end(), is_even<T>());
+    }
+
+    ASSERT_EQUAL(h_ref, data);
+    ASSERT_EQUAL(monitor.worst_mode(), thrust::low_memory_monitor::reduced_buffer);
+}
+DECLARE_VECTOR_UNITTEST(TestLowMemoryMonitorStablePartition);
+
+
+template<typename Vector>
+void TestLowMemoryMonitorReduceByKey(void)
+{
+    typedef typename Vector::value_type T;
+
+    const size_t n = 5000;
+
+    // runs of equal keys, some spanning the chunks the input is reduced in
+    thrust::host_vector<T> h_keys = unittest::random_integers<bool>(n);
+    for(size_t i = 1; i < n; ++i)
+        h_keys[i] = h_keys[i - 1] + (h_keys[i] && (i % 7 == 0));
+
+    thrust::host_vector<T> h_values = unittest::random_integers<bool>(n);
+
+    thrust::host_vector<T> h_ref_keys(n), h_ref_values(n);
+    size_t num_ref = thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), h_ref_keys.begin(), h_ref_values.begin()).first - h_ref_keys.begin();
+    h_ref_keys.resize(num_ref);
+    h_ref_values.resize(num_ref);
+
+    Vector keys = h_keys, values = h_values;
+    Vector keys_result(n), values_result(n);
+
+    thrust::low_memory_monitor monitor;
+
+    size_t num_segments = 0;
+
+    {
+        char region[512];
+        thrust::scratch_arena arena(region, sizeof(region), thrust::scratch_arena::fail);
+
+        num_segments = thrust::reduce_by_key(keys.begin(), keys.end(), values.begin(), keys_result.begin(), values_result.begin()).first - keys_result.begin();
+    }
+
+    keys_result.resize(num_segments);
+    values_result.resize(num_segments);
+
+    ASSERT_EQUAL(h_ref_keys,   keys_result);
+    ASSERT_EQUAL(h_ref_values, values_result);
+
+    // sequential reductions need no temporary storage, and parallel ones work in chunks
+    ASSERT_EQUAL(monitor.worst_mode() != thrust::low_memory_monitor::no_buffer, true);
+}
+DECLARE_VECTOR_UNITTEST(TestLowMemoryMonitorReduceByKey);
+
+
+void TestLowMemoryMonitorNested(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+
+    thrust::low_memory_monitor outer;
+
+    {
+        thrust::low_memory_monitor inner;
+
+        char region[256];
+        thrust::scratch_arena arena(region, sizeof(region), thrust::scratch_arena::fail);
+
+        thrust::stable_sort(h_data.begin(), h_data.end());
+
+        ASSERT_EQUAL(inner.worst_mode() != thrust::low_memory_monitor::full_buffer, true);
+    }
+
+    // fallbacks are also seen by enclosing monitors
+    ASSERT_EQUAL(outer.worst_mode() != thrust::low_memory_monitor::full_buffer, true);
+    ASSERT_GEQUAL(outer.num_fallbacks(), 1u);
+}
+DECLARE_UNITTEST(TestLowMemoryMonitorNested);
+
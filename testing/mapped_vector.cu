@@ -0,0 +1,104 @@
+#include <unittest/unittest.h>
+#include <thrust/mapped_vector.h>
+#include <thrust/copy.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/memory.h>
+
+#include <algorithm>
+#include <cstdio>
+
+void TestMappedVectorSort(void)
+{
+    const char *filename = "thrust_test_mapped_vector.bin";
+
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(100000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end());
+
+    {
+        thrust::mapped_vector<int> keys(filename, h_data.size());
+
+        ASSERT_EQUAL(keys.size(), h_data.size());
+        ASSERT_EQUAL(keys.mode(), thrust::mapped_vector<int>::read_write);
+
+        thrust::copy(h_data.begin(), h_data.end(), keys.begin());
+
+        keys.advise(thrust::mapped_vector<int>::random);
+
+        thrust::sort(keys.begin(), keys.end());
+
+        keys.flush();
+    }
+
+    {
+        thrust::mapped_vector<int> keys(filename);
+
+        ASSERT_EQUAL(keys.size(), h_ref.size());
+        ASSERT_EQUAL(keys.mode(), thrust::mapped_vector<int>::read_only);
+
+        keys.advise(thrust::mapped_vector<int>::sequential);
+        keys.advise(thrust::mapped_vector<int>::will_need, 1000, 5000);
+
+        thrust::host_vector<int> h_result(keys.begin(), keys.end());
+        ASSERT_EQUAL(h_ref, h_result);
+
+        ASSERT_EQUAL(thrust::reduce(keys.begin(), keys.end()),
+                     thrust::reduce(h_ref.begin(), h_ref.end()));
+    }
+
+    std::remove(filename);
+}
+DECLARE_UNITTEST(TestMappedVectorSort);
+
+
+void TestMappedVectorSystem(void)
+{
+    const char *filename = "thrust_test_mapped_vector_system.bin";
+
+    // a trailing partial element is not part of the vector
+    {
+        thrust::mapped_vector<char, thrust::cpp::tag> bytes(filename, 4 * sizeof(int) + 1);
+        ASSERT_EQUAL(bytes[4 * sizeof(int)], 0);
+    }
+
+    thrust::mapped_vector<int, thrust::cpp::tag> ints(filename, thrust::mapped_vector<int, thrust::cpp::tag>::read_write);
+
+    ASSERT_EQUAL(ints.size(), 4u);
+    ASSERT_EQUAL(ints.empty(), false);
+
+    ints[0] = 3; ints[1] = 1; ints[2] = 2; ints[3] = 0;
+
+    thrust::sort(ints.begin(), ints.end());
+
+    ASSERT_EQUAL(ints[0], 0);
+    ASSERT_EQUAL(ints[3], 3);
+    ASSERT_EQUAL(ints.data() + 4, &*ints.end());
+
+    std::remove(filename);
+}
+DECLARE_UNITTEST(TestMappedVectorSystem);
+
+
+void TestMappedVectorEmpty(void)
+{
+    const char *filename = "thrust_test_mapped_vector_empty.bin";
+
+    {
+        thrust::mapped_vector<int> empty(filename, 0);
+
+        ASSERT_EQUAL(empty.size(), 0u);
+        ASSERT_EQUAL(empty.empty(), true);
+        ASSERT_EQUAL(empty.begin() == empty.end(), true);
+
+        empty.advise(thrust::mapped_vector<int>::sequential);
+        empty.flush();
+    }
+
+    std::remove(filename);
+
+    ASSERT_THROWS(thrust::mapped_vector<int> missing(filename), thrust::system_error);
+}
+DECLARE_UNITTEST(TestMappedVectorEmpty);
+
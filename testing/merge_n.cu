@@ -0,0 +1,319 @@
+#include <unittest/unittest.h>
+#include <thrust/merge.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/pair.h>
+#include <algorithm>
+#include <vector>
+
+template<typename Vector>
+void TestMergeNSimple(void)
+{
+  typedef typename Vector::iterator        Iterator;
+  typedef thrust::pair<Iterator,Iterator> Range;
+
+  Vector a(3), b(4), c(2);
+
+  a[0] = 0; a[1] = 2; a[2] = 4;
+  b[0] = 0; b[1] = 3; b[2] = 3; b[3] = 4;
+  c[0] = 1; c[1] = 3;
+
+  Vector ref(9);
+  ref[0] = 0;
+  ref[1] = 0;
+  ref[2] = 1;
+  ref[3] = 2;
+  ref[4] = 3;
+  ref[5] = 3;
+  ref[6] = 3;
+  ref[7] = 4;
+  ref[8] = 4;
+
+  Range ranges[3] = {Range(a.begin(), a.end()), Range(b.begin(), b.end()), Range(c.begin(), c.end())};
+
+  Vector result(9);
+
+  Iterator end = thrust::merge_n(ranges, 3, result.begin());
+
+  ASSERT_EQUAL_QUIET(result.end(), end);
+  ASSERT_EQUAL(ref, result);
+
+  // no ranges
+  end = thrust::merge_n(ranges, 0, result.begin());
+
+  ASSERT_EQUAL_QUIET(result.begin(), end);
+}
+DECLARE_VECTOR_UNITTEST(TestMergeNSimple);
+
+
+template<typename T>
+  void TestMergeN(size_t n)
+{
+  typedef typename thrust::device_vector<T>::iterator Iterator;
+  typedef thrust::pair<Iterator,Iterator>             Range;
+
+  // two ranges, a few, and enough that the loser tree is several levels deep
+  size_t counts[]   = {1, 2, 3, 7, 64};
+  size_t num_counts = sizeof(counts) / sizeof(size_t);
+
+  thrust::host_vector<T> h_data = unittest::random_integers<char>(n);
+
+  for(size_t i = 0; i < num_counts; i++)
+  {
+    size_t k = counts[i];
+
+    // the ranges are uneven and some may be empty
+    std::vector<size_t> bounds(k + 1);
+    thrust::host_vector<size_t> h_cuts = unittest::random_integers<size_t>(k - 1);
+    for(size_t j = 0; j + 1 < k; j++)
+      bounds[j + 1] = h_cuts[j] % (n + 1);
+    bounds[k] = n;
+    std::sort(bounds.begin(), bounds.end());
+
+    thrust::host_vector<T> h_input = h_data;
+    for(size_t j = 0; j < k; j++)
+      thrust::stable_sort(h_input.begin() + bounds[j], h_input.begin() + bounds[j + 1]);
+
+    thrust::host_vector<T> h_ref = h_input;
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+
+    thrust::device_vector<T> d_input = h_input;
+
+    std::vector<Range> ranges(k);
+    for(size_t j = 0; j < k; j++)
+      ranges[j] = Range(d_input.begin() + bounds[j], d_input.begin() + bounds[j + 1]);
+
+    thrust::device_vector<T> d_result(n);
+
+    Iterator end = thrust::merge_n(&ranges[0], k, d_result.begin());
+
+    ASSERT_EQUAL_QUIET(d_result.end(), end);
+    ASSERT_EQUAL(h_ref, d_result);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeN);
+
+
+void TestMergeNDescending(void)
+{
+  typedef thrust::device_vector<int>::iterator Iterator;
+  typedef thrust::pair<Iterator,Iterator>      Range;
+
+  const size_t k = 5;
+  const size_t n = 10000;
+
+  thrust::host_vector<int> h_ref;
+
+  std::vector<thrust::device_vector<int> > inputs(k);
+  std::vector<Range> ranges(k);
+
+  for(size_t i = 0; i < k; i++)
+  {
+    thrust::host_vector<int> h_input = unittest::random_integers<int>(n + 1000 * i);
+    thrust::stable_sort(h_input.begin(), h_input.end(), thrust::greater<int>());
+
+    h_ref.insert(h_ref.end(), h_input.begin(), h_input.end());
+
+    inputs[i] = h_input;
+    ranges[i] = Range(inputs[i].begin(), inputs[i].end());
+  }
+
+  thrust::stable_sort(h_ref.begin(), h_ref.end(), thrust::greater<int>());
+
+  thrust::device_vector<int> d_result(h_ref.size());
+
+  thrust::merge_n(&ranges[0], k, d_result.begin(), thrust::greater<int>());
+
+  ASSERT_EQUAL(h_ref, d_result);
+}
+DECLARE_UNITTEST(TestMergeNDescending);
+
+
+void TestMergeNByKey(void)
+{
+  typedef thrust::device_vector<unsigned char>::iterator KeyIterator;
+  typedef thrust::device_vector<int>::iterator           ValueIterator;
+  typedef thrust::pair<KeyIterator,KeyIterator>          Range;
+
+  const size_t k = 9;
+  const size_t n = 100000;
+
+  // many equal keys, so that stability is observable
+  thrust::host_vector<unsigned char> h_keys = unittest::random_integers<unsigned char>(n);
+  thrust::host_vector<int> h_values(n);
+  for(size_t i = 0; i < n; i++)
+    h_values[i] = i;
+
+  std::vector<Range> key_ranges(k);
+  std::vector<ValueIterator> values(k);
+
+  for(size_t i = 0; i < k; i++)
+    thrust::stable_sort_by_key(h_keys.begin() + i * n / k, h_keys.begin() + (i + 1) * n / k, h_values.begin() + i * n / k);
+
+  thrust::device_vector<unsigned char> d_keys   = h_keys;
+  thrust::device_vector<int>           d_values = h_values;
+
+  for(size_t i = 0; i < k; i++)
+  {
+    key_ranges[i] = Range(d_keys.begin() + i * n / k, d_keys.begin() + (i + 1) * n / k);
+    values[i]     = d_values.begin() + i * n / k;
+  }
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+
+  thrust::device_vector<unsigned char> d_keys_result(n);
+  thrust::device_vector<int>           d_values_result(n);
+
+  thrust::pair<KeyIterator,ValueIterator> ends =
+    thrust::merge_n_by_key(&key_ranges[0], &values[0], k, d_keys_result.begin(), d_values_result.begin());
+
+  ASSERT_EQUAL_QUIET(d_keys_result.end(),   ends.first);
+  ASSERT_EQUAL_QUIET(d_values_result.end(), ends.second);
+  ASSERT_EQUAL(h_keys,   d_keys_result);
+  ASSERT_EQUAL(h_values, d_values_result);
+}
+DECLARE_UNITTEST(TestMergeNByKey);
+
+
+
+template<typename T>
+  void TestMergeNOffsets(size_t n)
+{
+  typedef typename thrust::device_vector<T>::iterator Iterator;
+
+  size_t counts[]   = {1, 2, 3, 7, 64};
+  size_t num_counts = sizeof(counts) / sizeof(size_t);
+
+  thrust::host_vector<T> h_data = unittest::random_integers<char>(n);
+
+  for(size_t i = 0; i < num_counts; i++)
+  {
+    size_t k = counts[i];
+
+    // see TestMergeN
+    std::vector<size_t> offsets(k + 1);
+    thrust::host_vector<size_t> h_cuts = unittest::random_integers<size_t>(k - 1);
+    for(size_t j = 0; j + 1 < k; j++)
+      offsets[j + 1] = h_cuts[j] % (n + 1);
+    offsets[k] = n;
+    std::sort(offsets.begin(), offsets.end());
+
+    thrust::host_vector<T> h_input = h_data;
+    for(size_t j = 0; j < k; j++)
+      thrust::stable_sort(h_input.begin() + offsets[j], h_input.begin() + offsets[j + 1]);
+
+    thrust::host_vector<T> h_ref = h_input;
+    thrust::stable_sort(h_ref.begin(), h_ref.end());
+
+    thrust::device_vector<T> d_input = h_input;
+    thrust::device_vector<T> d_result(n);
+
+    Iterator end = thrust::merge_n(d_input.begin(), offsets.begin(), k, d_result.begin());
+
+    ASSERT_EQUAL_QUIET(d_result.end(), end);
+    ASSERT_EQUAL(h_ref, d_result);
+
+    // descending, through the version taking a comparison
+    for(size_t j = 0; j < k; j++)
+      thrust::stable_sort(h_input.begin() + offsets[j], h_input.begin() + offsets[j + 1], thrust::greater<T>());
+    thrust::stable_sort(h_ref.begin(), h_ref.end(), thrust::greater<T>());
+
+    d_input = h_input;
+
+    end = thrust::merge_n(d_input.begin(), &offsets[0], k, d_result.begin(), thrust::greater<T>());
+
+    ASSERT_EQUAL_QUIET(d_result.end(), end);
+    ASSERT_EQUAL(h_ref, d_result);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeNOffsets);
+
+
+void TestMergeNOffsetsEmpty(void)
+{
+  typedef thrust::device_vector<int>::iterator Iterator;
+
+  thrust::device_vector<int> input(3, 7);
+  thrust::device_vector<int> result(3);
+
+  int offsets[1] = {0};
+
+  Iterator end = thrust::merge_n(input.begin(), offsets, 0, result.begin());
+
+  ASSERT_EQUAL_QUIET(result.begin(), end);
+}
+DECLARE_UNITTEST(TestMergeNOffsetsEmpty);
+
+
+template<typename Compare>
+  void TestMergeNByKeyOffsetsWithCompare(Compare comp)
+{
+  typedef thrust::device_vector<unsigned char>::iterator KeyIterator;
+  typedef thrust::device_vector<int>::iterator           ValueIterator;
+
+  const size_t k = 9;
+  const size_t n = 100000;
+
+  // see TestMergeNByKey
+  thrust::host_vector<unsigned char> h_keys = unittest::random_integers<unsigned char>(n);
+  thrust::host_vector<int> h_values(n);
+  for(size_t i = 0; i < n; i++)
+    h_values[i] = i;
+
+  std::vector<int> offsets(k + 1);
+  for(size_t i = 0; i <= k; i++)
+    offsets[i] = i * n / k;
+
+  for(size_t i = 0; i < k; i++)
+    thrust::stable_sort_by_key(h_keys.begin() + offsets[i], h_keys.begin() + offsets[i + 1], h_values.begin() + offsets[i], comp);
+
+  thrust::device_vector<unsigned char> d_keys   = h_keys;
+  thrust::device_vector<int>           d_values = h_values;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), comp);
+
+  thrust::device_vector<unsigned char> d_keys_result(n);
+  thrust::device_vector<int>           d_values_result(n);
+
+  thrust::pair<KeyIterator,ValueIterator> ends =
+    thrust::merge_n_by_key(d_keys.begin(), d_values.begin(), &offsets[0], k, d_keys_result.begin(), d_values_result.begin(), comp);
+
+  ASSERT_EQUAL_QUIET(d_keys_result.end(),   ends.first);
+  ASSERT_EQUAL_QUIET(d_values_result.end(), ends.second);
+  ASSERT_EQUAL(h_keys,   d_keys_result);
+  ASSERT_EQUAL(h_values, d_values_result);
+}
+
+void TestMergeNByKeyOffsets(void)
+{
+  typedef thrust::device_vector<unsigned char>::iterator KeyIterator;
+  typedef thrust::device_vector<int>::iterator           ValueIterator;
+
+  TestMergeNByKeyOffsetsWithCompare(thrust::greater<unsigned char>());
+
+  // the version comparing with operator<
+  thrust::device_vector<unsigned char> keys(6);
+  thrust::device_vector<int>           values(6);
+
+  keys[0] = 1; keys[1] = 4; keys[2] = 2; keys[3] = 3; keys[4] = 4; keys[5] = 0;
+  values[0] = 0; values[1] = 1; values[2] = 2; values[3] = 3; values[4] = 4; values[5] = 5;
+
+  size_t offsets[4] = {0, 2, 5, 6};
+
+  thrust::device_vector<unsigned char> keys_result(6);
+  thrust::device_vector<int>           values_result(6);
+
+  thrust::pair<KeyIterator,ValueIterator> ends =
+    thrust::merge_n_by_key(keys.begin(), values.begin(), offsets, 3, keys_result.begin(), values_result.begin());
+
+  ASSERT_EQUAL_QUIET(keys_result.end(),   ends.first);
+  ASSERT_EQUAL_QUIET(values_result.end(), ends.second);
+
+  ASSERT_EQUAL(0, keys_result[0]);   ASSERT_EQUAL(5, values_result[0]);
+  ASSERT_EQUAL(1, keys_result[1]);   ASSERT_EQUAL(0, values_result[1]);
+  ASSERT_EQUAL(2, keys_result[2]);   ASSERT_EQUAL(2, values_result[2]);
+  ASSERT_EQUAL(3, keys_result[3]);   ASSERT_EQUAL(3, values_result[3]);
+  ASSERT_EQUAL(4, keys_result[4]);   ASSERT_EQUAL(1, values_result[4]);
+  ASSERT_EQUAL(4, keys_result[5]);   ASSERT_EQUAL(4, values_result[5]);
+}
+DECLARE_UNITTEST(TestMergeNByKeyOffsets);
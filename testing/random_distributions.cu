@@ -0,0 +1,165 @@
+#include <unittest/unittest.h>
+#include <thrust/sort.h>
+#include <thrust/merge.h>
+#include <thrust/set_operations.h>
+#include <thrust/unique.h>
+#include <thrust/binary_search.h>
+
+#include <algorithm>
+#include <set>
+
+
+void TestRandomDistributionShapes(void)
+{
+    const size_t n = 10000;
+
+    typedef thrust::host_vector<int> Vector;
+
+    unittest::distribution_parameters p;
+
+    ASSERT_EQUAL(unittest::random_distribution<int>(unittest::uniform, n), unittest::random_integers<int>(n));
+
+    Vector presorted = unittest::random_distribution<int>(unittest::presorted, n);
+    ASSERT_EQUAL(std::adjacent_find(presorted.begin(), presorted.end(), std::greater<int>()) == presorted.end(), true);
+
+    Vector reverse_sorted = unittest::random_distribution<int>(unittest::reverse_sorted, n);
+    ASSERT_EQUAL(std::adjacent_find(reverse_sorted.begin(), reverse_sorted.end(), std::less<int>()) == reverse_sorted.end(), true);
+
+    Vector all_equal = unittest::random_distribution<int>(unittest::all_equal, n);
+    ASSERT_EQUAL(std::count(all_equal.begin(), all_equal.end(), all_equal[0]), int(n));
+
+    Vector few_unique = unittest::random_distribution<int>(unittest::few_unique, n);
+    ASSERT_LEQUAL(std::set<int>(few_unique.begin(), few_unique.end()).size(), p.num_unique);
+
+    Vector sawtooth = unittest::random_distribution<int>(unittest::sawtooth, n);
+    size_t num_descents = 0;
+    for(size_t i = 1; i < n; i++)
+    {
+        if(sawtooth[i] < sawtooth[i - 1])
+        {
+            ASSERT_EQUAL(i % p.run_length, 0u);
+            num_descents++;
+        }
+    }
+    ASSERT_GEQUAL(num_descents, 1u);
+
+    // each swap makes at most two descents on either side of each element it moves
+    Vector nearly_sorted = unittest::random_distribution<int>(unittest::nearly_sorted, n);
+    num_descents = 0;
+    for(size_t i = 1; i < n; i++)
+    {
+        if(nearly_sorted[i] < nearly_sorted[i - 1]) num_descents++;
+    }
+    ASSERT_GEQUAL(num_descents, 1u);
+    ASSERT_LEQUAL(num_descents, size_t(2 * p.unsorted_fraction * n));
+
+    // the most frequent value of Zipf's law over 2^16 values is drawn about 8% of the time
+    Vector zipf = unittest::random_distribution<int>(unittest::zipf, n);
+    std::sort(zipf.begin(), zipf.end());
+    size_t longest_run = 0;
+    for(size_t i = 0, j = 0; i < n; i = j)
+    {
+        for(j = i; j < n && zipf[j] == zipf[i]; j++) {}
+        longest_run = std::max(longest_run, j - i);
+    }
+    ASSERT_GEQUAL(longest_run, n / 20);
+
+    // different seeds give different values
+    Vector other = unittest::random_distribution<int>(unittest::uniform, n, unittest::distribution_parameters(1));
+    ASSERT_EQUAL(other == unittest::random_integers<int>(n), false);
+}
+DECLARE_UNITTEST(TestRandomDistributionShapes);
+
+
+template<typename T>
+void TestSortDistributions(const size_t n)
+{
+    for(size_t d = 0; d < sizeof(unittest::all_distributions) / sizeof(unittest::distribution); d++)
+    {
+        thrust::host_vector<T> h_keys = unittest::random_distribution<T>(unittest::all_distributions[d], n);
+        thrust::host_vector<T> h_ref  = h_keys;
+
+        std::stable_sort(h_ref.begin(), h_ref.end());
+
+        thrust::device_vector<T> d_keys = h_keys;
+        thrust::sort(d_keys.begin(), d_keys.end());
+        ASSERT_EQUAL(h_ref, d_keys);
+
+        d_keys = h_keys;
+        thrust::stable_sort(d_keys.begin(), d_keys.end());
+        ASSERT_EQUAL(h_ref, d_keys);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestSortDistributions);
+
+
+template<typename T>
+void TestMergeDistributions(const size_t n)
+{
+    for(size_t d = 0; d < sizeof(unittest::all_distributions) / sizeof(unittest::distribution); d++)
+    {
+        thrust::host_vector<T> h_a = unittest::random_distribution<T>(unittest::all_distributions[d], n, unittest::distribution_parameters(1));
+        thrust::host_vector<T> h_b = unittest::random_distribution<T>(unittest::all_distributions[d], n, unittest::distribution_parameters(2));
+
+        std::sort(h_a.begin(), h_a.end());
+        std::sort(h_b.begin(), h_b.end());
+
+        thrust::host_vector<T> h_ref(2 * n);
+        std::merge(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_ref.begin());
+
+        thrust::device_vector<T> d_a = h_a, d_b = h_b;
+        thrust::device_vector<T> d_result(2 * n);
+        thrust::merge(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+        ASSERT_EQUAL(h_ref, d_result);
+
+        thrust::host_vector<T> h_union(2 * n);
+        h_union.resize(std::set_union(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_union.begin()) - h_union.begin());
+
+        d_result.resize(thrust::set_union(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin()) - d_result.begin());
+        ASSERT_EQUAL(h_union, d_result);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestMergeDistributions);
+
+
+template<typename T>
+void TestUniqueDistributions(const size_t n)
+{
+    for(size_t d = 0; d < sizeof(unittest::all_distributions) / sizeof(unittest::distribution); d++)
+    {
+        thrust::host_vector<T> h_data = unittest::random_distribution<T>(unittest::all_distributions[d], n);
+
+        thrust::host_vector<T> h_ref(h_data.begin(), h_data.end());
+        h_ref.erase(std::unique(h_ref.begin(), h_ref.end()), h_ref.end());
+
+        thrust::device_vector<T> d_data = h_data;
+        d_data.erase(thrust::unique(d_data.begin(), d_data.end()), d_data.end());
+
+        ASSERT_EQUAL(h_ref, d_data);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestUniqueDistributions);
+
+
+template<typename T>
+void TestBinarySearchDistributions(const size_t n)
+{
+    for(size_t d = 0; d < sizeof(unittest::all_distributions) / sizeof(unittest::distribution); d++)
+    {
+        thrust::host_vector<T> h_keys   = unittest::random_distribution<T>(unittest::all_distributions[d], n, unittest::distribution_parameters(1));
+        thrust::host_vector<T> h_search = unittest::random_distribution<T>(unittest::all_distributions[d], n, unittest::distribution_parameters(2));
+
+        std::sort(h_keys.begin(), h_keys.end());
+
+        thrust::host_vector<size_t> h_ref(n);
+        for(size_t i = 0; i < n; i++)
+            h_ref[i] = std::lower_bound(h_keys.begin(), h_keys.end(), h_search[i]) - h_keys.begin();
+
+        thrust::device_vector<T> d_keys = h_keys, d_search = h_search;
+        thrust::device_vector<size_t> d_result(n);
+        thrust::lower_bound(d_keys.begin(), d_keys.end(), d_search.begin(), d_search.end(), d_result.begin());
+
+        ASSERT_EQUAL(h_ref, d_result);
+    }
+}
+DECLARE_VARIABLE_UNITTEST(TestBinarySearchDistributions);
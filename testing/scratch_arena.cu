@@ -0,0 +1,123 @@
+#include <unittest/unittest.h>
+#include <thrust/scratch_arena.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/detail/temporary_array.h>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+void TestScratchArenaSort(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end());
+
+    std::vector<char> region(1 << 20);
+
+    thrust::cpp::reset_temporary_buffer_statistics();
+
+    {
+        thrust::scratch_arena arena(&region[0], region.size(), thrust::scratch_arena::fail);
+
+        thrust::stable_sort(h_data.begin(), h_data.end());
+
+        ASSERT_EQUAL(arena.size(), region.size());
+        ASSERT_EQUAL(arena.bytes_in_use(), 0u);
+        ASSERT_EQUAL(arena.num_exhaustions(), 0u);
+        ASSERT_GEQUAL(arena.peak_bytes_in_use(), 10000 * sizeof(int));
+    }
+
+    ASSERT_EQUAL(h_ref, h_data);
+
+    // the heap was not touched
+    thrust::cpp::temporary_buffer_statistics stats = thrust::cpp::get_temporary_buffer_statistics();
+    ASSERT_EQUAL(stats.hits,   0u);
+    ASSERT_EQUAL(stats.misses, 0u);
+}
+DECLARE_UNITTEST(TestScratchArenaSort);
+
+
+void TestScratchArenaFail(void)
+{
+    typedef thrust::detail::temporary_array<int, thrust::cpp::tag> temporary_array;
+
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end());
+
+    char region[256];
+
+    thrust::scratch_arena arena(region, sizeof(region), thrust::scratch_arena::fail);
+
+    ASSERT_THROWS(temporary_array temp(h_data.size()), std::bad_alloc);
+
+    // sorts make do without the temporary storage they could not have
+    thrust::stable_sort(h_data.begin(), h_data.end());
+
+    ASSERT_EQUAL(h_ref, h_data);
+    ASSERT_EQUAL(arena.bytes_in_use(), 0u);
+    ASSERT_GEQUAL(arena.num_exhaustions(), 2u);
+}
+DECLARE_UNITTEST(TestScratchArenaFail);
+
+
+void TestScratchArenaFallBack(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end());
+
+    char region[256];
+
+    {
+        thrust::scratch_arena arena(region, sizeof(region));
+
+        thrust::stable_sort(h_data.begin(), h_data.end());
+
+        ASSERT_EQUAL(arena.bytes_in_use(), 0u);
+        ASSERT_GEQUAL(arena.num_exhaustions(), 1u);
+    }
+
+    ASSERT_EQUAL(h_ref, h_data);
+}
+DECLARE_UNITTEST(TestScratchArenaFallBack);
+
+
+void TestScratchArenaNested(void)
+{
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+    thrust::host_vector<int> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end());
+
+    std::vector<char> outer_region(1 << 20);
+    std::vector<char> inner_region(1 << 20);
+
+    thrust::scratch_arena outer(&outer_region[0], outer_region.size(), thrust::scratch_arena::fail);
+
+    {
+        thrust::scratch_arena inner(&inner_region[0], inner_region.size(), thrust::scratch_arena::fail);
+
+        thrust::stable_sort(h_data.begin(), h_data.end());
+
+        ASSERT_GEQUAL(inner.peak_bytes_in_use(), 10000 * sizeof(int));
+    }
+
+    ASSERT_EQUAL(h_ref, h_data);
+
+    // the outer arena is bound again once the inner arena is destroyed
+    ASSERT_EQUAL(outer.peak_bytes_in_use(), 0u);
+
+    h_data = unittest::random_integers<int>(10000);
+
+    thrust::stable_sort(h_data.begin(), h_data.end());
+
+    ASSERT_GEQUAL(outer.peak_bytes_in_use(), 10000 * sizeof(int));
+}
+DECLARE_UNITTEST(TestScratchArenaNested);
+
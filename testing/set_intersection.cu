@@ -3,6 +3,8 @@
 #include <thrust/functional.h>
 #include <thrust/sort.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <algorithm>
+#include <vector>
 
 template<typename Vector>
 void TestSetIntersectionSimple(void)
@@ -188,3 +190,36 @@ void TestSetIntersectionMultiset(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetIntersectionMultiset);
 
+
+template<typename T>
+void TestSetIntersectionSkewed(const size_t n)
+{
+  // a short range against a long one is searched rather than walked
+  thrust::host_vector<T> h_a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b = unittest::random_integers<T>(n / 64 + 1);
+
+  thrust::sort(h_a.begin(), h_a.end());
+  thrust::sort(h_b.begin(), h_b.end());
+
+  std::vector<T> a(h_a.begin(), h_a.end());
+  std::vector<T> b(h_b.begin(), h_b.end());
+
+  thrust::device_vector<T> d_a = h_a;
+  thrust::device_vector<T> d_b = h_b;
+
+  for(int i = 0; i < 2; ++i)
+  {
+    std::vector<T> reference(a.size() + b.size());
+    reference.resize(std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), reference.begin()) - reference.begin());
+
+    thrust::device_vector<T> d_result(a.size() + b.size());
+    d_result.resize(thrust::set_intersection(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin()) - d_result.begin());
+
+    ASSERT_EQUAL(thrust::host_vector<T>(reference.begin(), reference.end()), d_result);
+
+    // and the long range against the short one
+    a.swap(b);
+    d_a.swap(d_b);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSetIntersectionSkewed);
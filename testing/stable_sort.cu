@@ -1,6 +1,8 @@
 #include <unittest/unittest.h>
 #include <thrust/sort.h>
 #include <thrust/functional.h>
+#include <algorithm>
+#include <vector>
 
 template <typename T>
 struct less_div_10
@@ -52,6 +54,28 @@ void TestStableSortSimple(void)
 DECLARE_VECTOR_UNITTEST(TestStableSortSimple);
 
 
+template <class Vector>
+void TestStableSortSmallBlocks(void)
+{
+    typedef typename Vector::value_type T;
+
+    // cover every block size sorted directly rather than by merging
+    for(size_t n = 0; n <= 40; ++n)
+    {
+        thrust::host_vector<T> h_data = unittest::random_samples<T>(n);
+
+        std::vector<T> reference(h_data.begin(), h_data.end());
+        std::stable_sort(reference.begin(), reference.end(), less_div_10<T>());
+
+        Vector data = h_data;
+        thrust::stable_sort(data.begin(), data.end(), less_div_10<T>());
+
+        ASSERT_EQUAL(data, thrust::host_vector<T>(reference.begin(), reference.end()));
+    }
+}
+DECLARE_VECTOR_UNITTEST(TestStableSortSmallBlocks);
+
+
 template <typename T>
 struct TestStableSort
 {
@@ -69,6 +93,44 @@ struct TestStableSort
 VariableUnitTest<TestStableSort, SignedIntegralTypes> TestStableSortInstance;
 
 
+template <typename T>
+struct TestStableSortRuns
+{
+    void operator()(const size_t n)
+    {
+        // an ascending, a descending, an unordered and another ascending quarter
+        std::vector<T> data(n);
+        thrust::host_vector<T> h_random = unittest::random_integers<T>(n);
+        std::copy(h_random.begin(), h_random.end(), data.begin());
+
+        std::sort(data.begin(),             data.begin() + n / 4);
+        std::sort(data.begin() + n / 4,     data.begin() + n / 2, std::greater<T>());
+        std::sort(data.begin() + 3 * n / 4, data.end());
+
+        thrust::host_vector<T>   h_data(data.begin(), data.end());
+        thrust::device_vector<T> d_data = h_data;
+
+        std::stable_sort(data.begin(), data.end(), less_div_10<T>());
+        thrust::stable_sort(h_data.begin(), h_data.end(), less_div_10<T>());
+        thrust::stable_sort(d_data.begin(), d_data.end(), less_div_10<T>());
+
+        ASSERT_EQUAL(h_data, thrust::host_vector<T>(data.begin(), data.end()));
+        ASSERT_EQUAL(d_data, thrust::host_vector<T>(data.begin(), data.end()));
+
+        // already sorted input, and input in reverse order
+        thrust::stable_sort(d_data.begin(), d_data.end(), less_div_10<T>());
+        ASSERT_EQUAL(d_data, thrust::host_vector<T>(data.begin(), data.end()));
+
+        std::sort(data.begin(), data.end(), std::greater<T>());
+        d_data = thrust::host_vector<T>(data.begin(), data.end());
+        std::stable_sort(data.begin(), data.end());
+        thrust::stable_sort(d_data.begin(), d_data.end());
+        ASSERT_EQUAL(d_data, thrust::host_vector<T>(data.begin(), data.end()));
+    }
+};
+VariableUnitTest<TestStableSortRuns, SignedIntegralTypes> TestStableSortRunsInstance;
+
+
 template <typename T>
 struct TestStableSortSemantics
 {
@@ -1,6 +1,9 @@
 #include <unittest/unittest.h>
 #include <thrust/sort.h>
 #include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <algorithm>
+#include <vector>
 
 template <typename T>
 struct less_div_10
@@ -57,6 +60,47 @@ void TestStableSortByKeySimple(void)
 DECLARE_VECTOR_UNITTEST(TestStableSortByKeySimple);
 
 
+template <typename T>
+struct less_div_10_first
+{
+  bool operator()(const std::pair<T,T> &lhs, const std::pair<T,T> &rhs) const {return less_div_10<T>()(lhs.first, rhs.first);}
+};
+
+template <class Vector>
+void TestStableSortByKeySmallBlocks(void)
+{
+    typedef typename Vector::value_type T;
+
+    // cover every block size sorted directly rather than by merging
+    for(size_t n = 0; n <= 40; ++n)
+    {
+        thrust::host_vector<T> h_keys = unittest::random_samples<T>(n);
+        thrust::host_vector<T> h_values(n);
+        thrust::sequence(h_values.begin(), h_values.end());
+
+        std::vector< std::pair<T,T> > reference(n);
+        for(size_t i = 0; i < n; ++i)
+            reference[i] = std::make_pair(h_keys[i], h_values[i]);
+        std::stable_sort(reference.begin(), reference.end(), less_div_10_first<T>());
+
+        thrust::host_vector<T> ref_keys(n), ref_values(n);
+        for(size_t i = 0; i < n; ++i)
+        {
+            ref_keys[i]   = reference[i].first;
+            ref_values[i] = reference[i].second;
+        }
+
+        Vector keys   = h_keys;
+        Vector values = h_values;
+        thrust::stable_sort_by_key(keys.begin(), keys.end(), values.begin(), less_div_10<T>());
+
+        ASSERT_EQUAL(keys,   ref_keys);
+        ASSERT_EQUAL(values, ref_values);
+    }
+}
+DECLARE_VECTOR_UNITTEST(TestStableSortByKeySmallBlocks);
+
+
 template <typename T>
 struct TestStableSortByKey
 {
@@ -78,6 +122,45 @@ struct TestStableSortByKey
 VariableUnitTest<TestStableSortByKey, SignedIntegralTypes> TestStableSortByKeyInstance;
 
 
+template <typename T>
+struct TestStableSortByKeyRuns
+{
+    void operator()(const size_t n)
+    {
+        // an ascending, a descending, an unordered and another ascending quarter
+        std::vector<T> keys(n);
+        thrust::host_vector<T> h_random = unittest::random_integers<T>(n);
+        std::copy(h_random.begin(), h_random.end(), keys.begin());
+
+        std::sort(keys.begin(),             keys.begin() + n / 4);
+        std::sort(keys.begin() + n / 4,     keys.begin() + n / 2, std::greater<T>());
+        std::sort(keys.begin() + 3 * n / 4, keys.end());
+
+        std::vector< std::pair<T,T> > reference(n);
+        for(size_t i = 0; i < n; ++i)
+            reference[i] = std::make_pair(keys[i], T(i));
+        std::stable_sort(reference.begin(), reference.end(), less_div_10_first<T>());
+
+        thrust::host_vector<T> ref_keys(n), ref_values(n);
+        for(size_t i = 0; i < n; ++i)
+        {
+            ref_keys[i]   = reference[i].first;
+            ref_values[i] = reference[i].second;
+        }
+
+        thrust::device_vector<T> d_keys(keys.begin(), keys.end());
+        thrust::device_vector<T> d_values(n);
+        thrust::sequence(d_values.begin(), d_values.end());
+
+        thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), less_div_10<T>());
+
+        ASSERT_EQUAL(d_keys,   ref_keys);
+        ASSERT_EQUAL(d_values, ref_values);
+    }
+};
+VariableUnitTest<TestStableSortByKeyRuns, SignedIntegralTypes> TestStableSortByKeyRunsInstance;
+
+
 template <typename T>
 struct TestStableSortByKeySemantics
 {
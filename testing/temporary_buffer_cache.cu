@@ -0,0 +1,71 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/detail/temporary_array.h>
+
+void TestTemporaryBufferCacheReuse(void)
+{
+    thrust::cpp::trim_temporary_buffer_cache();
+    thrust::cpp::reset_temporary_buffer_statistics();
+
+    thrust::cpp::temporary_buffer_statistics before = thrust::cpp::get_temporary_buffer_statistics();
+
+    ASSERT_EQUAL(before.hits,         0u);
+    ASSERT_EQUAL(before.misses,       0u);
+    ASSERT_EQUAL(before.bytes_cached, 0u);
+
+    {
+        thrust::detail::temporary_array<int, thrust::cpp::tag> temp(1000);
+    }
+
+    thrust::cpp::temporary_buffer_statistics after_first = thrust::cpp::get_temporary_buffer_statistics();
+
+    ASSERT_EQUAL(after_first.hits,   0u);
+    ASSERT_EQUAL(after_first.misses, 1u);
+    ASSERT_EQUAL(after_first.bytes_in_use, before.bytes_in_use);
+    ASSERT_GEQUAL(after_first.peak_bytes_in_use, before.bytes_in_use + 1000 * sizeof(int));
+    ASSERT_GEQUAL(after_first.bytes_cached, 1000 * sizeof(int));
+
+    // a request of a similar size reuses the released buffer
+    {
+        thrust::detail::temporary_array<int, thrust::cpp::tag> temp(990);
+    }
+
+    thrust::cpp::temporary_buffer_statistics after_second = thrust::cpp::get_temporary_buffer_statistics();
+
+    ASSERT_EQUAL(after_second.hits,   1u);
+    ASSERT_EQUAL(after_second.misses, 1u);
+    ASSERT_EQUAL(after_second.bytes_cached, after_first.bytes_cached);
+
+    thrust::cpp::trim_temporary_buffer_cache();
+
+    ASSERT_EQUAL(thrust::cpp::get_temporary_buffer_statistics().bytes_cached, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryBufferCacheReuse);
+
+
+void TestTemporaryBufferCacheLimit(void)
+{
+    const size_t old_limit = thrust::cpp::get_temporary_buffer_cache_limit();
+
+    thrust::cpp::trim_temporary_buffer_cache();
+    thrust::cpp::set_temporary_buffer_cache_limit(0);
+    thrust::cpp::reset_temporary_buffer_statistics();
+
+    ASSERT_EQUAL(thrust::cpp::get_temporary_buffer_cache_limit(), 0u);
+
+    // nothing is cached past the limit
+    for(int i = 0; i < 2; ++i)
+    {
+        thrust::detail::temporary_array<int, thrust::cpp::tag> temp(1000);
+    }
+
+    thrust::cpp::temporary_buffer_statistics stats = thrust::cpp::get_temporary_buffer_statistics();
+
+    ASSERT_EQUAL(stats.hits,         0u);
+    ASSERT_EQUAL(stats.misses,       2u);
+    ASSERT_EQUAL(stats.bytes_cached, 0u);
+
+    thrust::cpp::set_temporary_buffer_cache_limit(old_limit);
+}
+DECLARE_UNITTEST(TestTemporaryBufferCacheLimit);
+
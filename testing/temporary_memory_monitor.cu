@@ -0,0 +1,133 @@
+#include <unittest/unittest.h>
+#include <thrust/temporary_memory_monitor.h>
+#include <thrust/scratch_arena.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <vector>
+
+
+void TestTemporaryMemoryMonitorTemporaryArray(void)
+{
+    typedef thrust::detail::temporary_array<int, thrust::cpp::tag> array;
+
+    thrust::temporary_memory_monitor monitor;
+
+    ASSERT_EQUAL(monitor.bytes_in_use(), 0u);
+    ASSERT_EQUAL(monitor.peak_bytes_in_use(), 0u);
+
+    {
+        array a(1000);
+
+        ASSERT_EQUAL(monitor.bytes_in_use(), 1000 * sizeof(int));
+
+        {
+            array b(500);
+
+            ASSERT_EQUAL(monitor.bytes_in_use(), 1500 * sizeof(int));
+        }
+
+        array c(200);
+
+        ASSERT_EQUAL(monitor.bytes_in_use(), 1200 * sizeof(int));
+    }
+
+    ASSERT_EQUAL(monitor.bytes_in_use(), 0u);
+    ASSERT_EQUAL(monitor.peak_bytes_in_use(), 1500 * sizeof(int));
+    ASSERT_EQUAL(monitor.total_bytes(), 1700 * sizeof(int));
+    ASSERT_EQUAL(monitor.num_allocations(), 3u);
+
+    monitor.reset();
+
+    ASSERT_EQUAL(monitor.peak_bytes_in_use(), 0u);
+    ASSERT_EQUAL(monitor.total_bytes(), 0u);
+    ASSERT_EQUAL(monitor.num_allocations(), 0u);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryMonitorTemporaryArray);
+
+
+void TestTemporaryMemoryMonitorNested(void)
+{
+    typedef thrust::detail::temporary_array<char, thrust::cpp::tag> array;
+
+    thrust::temporary_memory_monitor outer;
+
+    array a(100);
+
+    {
+        thrust::temporary_memory_monitor inner;
+
+        array b(10);
+
+        ASSERT_EQUAL(inner.bytes_in_use(), 10u);
+        ASSERT_EQUAL(outer.bytes_in_use(), 110u);
+    }
+
+    // storage obtained before a monitor existed does not count against it when released
+    thrust::temporary_memory_monitor late;
+
+    {
+        array c(1000);
+    }
+
+    {
+        array d(50);
+    }
+
+    ASSERT_EQUAL(late.bytes_in_use(), 0u);
+    ASSERT_EQUAL(late.peak_bytes_in_use(), 1000u);
+    ASSERT_EQUAL(outer.peak_bytes_in_use(), 1100u);
+    ASSERT_EQUAL(outer.total_bytes(), 1160u);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryMonitorNested);
+
+
+template<typename Vector>
+void TestTemporaryMemoryMonitorAlgorithms(void)
+{
+    typedef typename Vector::value_type T;
+
+    const size_t n = 10000;
+
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    Vector keys = h_data;
+    Vector values(n, T(1));
+    Vector output_keys(n);
+    Vector output_values(n);
+
+    thrust::temporary_memory_monitor monitor;
+
+    thrust::stable_sort(keys.begin(), keys.end());
+
+    ASSERT_EQUAL(monitor.bytes_in_use(), 0u);
+    ASSERT_LEQUAL(monitor.peak_bytes_in_use(), monitor.total_bytes());
+
+    thrust::reduce_by_key(keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+    ASSERT_EQUAL(monitor.bytes_in_use(), 0u);
+    ASSERT_LEQUAL(monitor.peak_bytes_in_use(), monitor.total_bytes());
+}
+DECLARE_VECTOR_UNITTEST(TestTemporaryMemoryMonitorAlgorithms);
+
+
+void TestTemporaryMemoryMonitorFailedAllocation(void)
+{
+    typedef thrust::detail::temporary_array<int, thrust::cpp::tag> array;
+
+    thrust::temporary_memory_monitor monitor;
+
+    {
+        thrust::scratch_arena arena(0, 0, thrust::scratch_arena::fail);
+
+        array a(0);
+
+        ASSERT_EQUAL(a.try_allocate(1000), false);
+    }
+
+    ASSERT_EQUAL(monitor.bytes_in_use(), 0u);
+    ASSERT_EQUAL(monitor.total_bytes(), 0u);
+    ASSERT_EQUAL(monitor.num_allocations(), 0u);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryMonitorFailedAllocation);
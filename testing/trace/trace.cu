@@ -0,0 +1,226 @@
+// these tests are built as a program of their own, trace_tester, whose translation
+// units are all compiled with THRUST_ENABLE_TRACING, as thrust/trace.h requires
+#if !defined(THRUST_ENABLE_TRACING)
+#error "testing/trace/trace.cu must be compiled with THRUST_ENABLE_TRACING defined"
+#endif
+
+#include <unittest/unittest.h>
+#include <thrust/trace.h>
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct trace_less
+{
+    __host__ __device__
+    bool operator()(int x, int y) const { return x < y; }
+};
+
+struct trace_plus
+{
+    __host__ __device__
+    int operator()(int x, int y) const { return x + y; }
+};
+
+struct trace_negate
+{
+    __host__ __device__
+    int operator()(int x) const { return -x; }
+};
+
+
+class recording_sink
+  : public thrust::trace::sink
+{
+  public:
+    std::vector<thrust::trace::event> events;
+
+    void record(const thrust::trace::event &e)
+    {
+        events.push_back(e);
+    }
+
+    // the outermost event of an algorithm, or null
+    const thrust::trace::event *find(const std::string &algorithm) const
+    {
+        for(size_t i = 0; i < events.size(); ++i)
+            if(algorithm == events[i].algorithm && events[i].depth == 0)
+                return &events[i];
+
+        return 0;
+    }
+};
+
+
+template<typename Vector>
+void TestTraceEvents(void)
+{
+    Vector data = unittest::random_integers<int>(1000);
+
+    recording_sink sink;
+    thrust::trace::sink *previous = thrust::trace::set_sink(&sink);
+
+    thrust::stable_sort(data.begin(), data.end(), trace_less());
+    thrust::reduce(data.begin(), data.end(), 0, trace_plus());
+
+    thrust::trace::set_sink(previous);
+
+    const thrust::trace::event *sort_event   = sink.find("stable_sort");
+    const thrust::trace::event *reduce_event = sink.find("reduce");
+
+    ASSERT_EQUAL(sort_event != 0, true);
+    ASSERT_EQUAL(reduce_event != 0, true);
+
+    ASSERT_EQUAL(sort_event->num_elements, 1000u);
+    ASSERT_EQUAL(sort_event->duration >= 0, true);
+    ASSERT_EQUAL(reduce_event->begin >= sort_event->begin + sort_event->duration, true);
+    ASSERT_EQUAL(reduce_event->thread, sort_event->thread);
+
+    // the sort merges through a temporary buffer
+    ASSERT_GEQUAL(sort_event->temporary_bytes, 1000 * sizeof(int));
+
+    // the outermost events are reported last
+    ASSERT_EQUAL(std::string(sink.events.back().algorithm), "reduce");
+
+    // after the sink is removed, nothing is recorded
+    size_t num_events = sink.events.size();
+    thrust::reduce(data.begin(), data.end(), 0, trace_plus());
+    ASSERT_EQUAL(sink.events.size(), num_events);
+}
+DECLARE_VECTOR_UNITTEST(TestTraceEvents);
+
+
+template<typename Vector>
+void TestTraceMergeAndSearchEvents(void)
+{
+    // three sorted ranges, of 300, 0, and 700 elements
+    Vector data = unittest::random_integers<int>(1000);
+    thrust::sort(data.begin(), data.begin() + 300);
+    thrust::sort(data.begin() + 300, data.end());
+
+    std::vector<int> offsets(4);
+    offsets[0] = 0;
+    offsets[1] = 300;
+    offsets[2] = 300;
+    offsets[3] = 1000;
+
+    Vector merged(1000);
+    Vector values(10, 0);
+    Vector bounds(10);
+
+    recording_sink sink;
+    thrust::trace::sink *previous = thrust::trace::set_sink(&sink);
+
+    thrust::merge_n(data.begin(), offsets.begin(), 3, merged.begin());
+    thrust::lower_bound(merged.begin(), merged.end(), 0);
+    thrust::lower_bound(merged.begin(), merged.end(), values.begin(), values.end(), bounds.begin());
+
+    thrust::trace::set_sink(previous);
+
+    const thrust::trace::event *merge_event = sink.find("merge_n");
+    ASSERT_EQUAL(merge_event != 0, true);
+
+    // merge_n counts the ranges it merges
+    ASSERT_EQUAL(merge_event->num_elements, 3u);
+
+    size_t num_searches = 0;
+    for(size_t i = 0; i < sink.events.size(); ++i)
+    {
+        if(std::string(sink.events[i].algorithm) == "lower_bound" && sink.events[i].depth == 0)
+        {
+            ASSERT_EQUAL(sink.events[i].num_elements, 1000u);
+            ++num_searches;
+        }
+    }
+
+    ASSERT_EQUAL(num_searches, 2u);
+}
+DECLARE_VECTOR_UNITTEST(TestTraceMergeAndSearchEvents);
+
+
+void TestTraceSystemName(void)
+{
+    thrust::host_vector<int>   h_data(10);
+    thrust::device_vector<int> d_data(10);
+
+    recording_sink sink;
+    thrust::trace::sink *previous = thrust::trace::set_sink(&sink);
+
+    thrust::transform(h_data.begin(), h_data.end(), h_data.begin(), trace_negate());
+    std::string host_system = sink.events.back().system;
+
+    thrust::transform(d_data.begin(), d_data.end(), d_data.begin(), trace_negate());
+    std::string device_system = sink.events.back().system;
+
+    thrust::trace::set_sink(previous);
+
+    ASSERT_EQUAL(host_system, "cpp");
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    ASSERT_EQUAL(device_system, "omp");
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    ASSERT_EQUAL(device_system, "tbb");
+#else
+    ASSERT_EQUAL(device_system, "cuda");
+#endif
+}
+DECLARE_UNITTEST(TestTraceSystemName);
+
+
+void TestTraceCountingSink(void)
+{
+    thrust::host_vector<int> data = unittest::random_integers<int>(100);
+
+    thrust::trace::counting_sink sink;
+    thrust::trace::sink *previous = thrust::trace::set_sink(&sink);
+
+    for(int i = 0; i < 3; ++i)
+        thrust::transform(data.begin(), data.end(), data.begin(), trace_negate());
+
+    thrust::trace::set_sink(previous);
+
+    thrust::trace::counting_sink::totals_map totals = sink.get_totals();
+
+    ASSERT_EQUAL(totals["transform"].num_calls, 3u);
+    ASSERT_EQUAL(totals["transform"].num_elements, 300u);
+
+    std::ostringstream table;
+    sink.write(table);
+    ASSERT_EQUAL(table.str().find("transform") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestTraceCountingSink);
+
+
+void TestTraceChromeSink(void)
+{
+    thrust::host_vector<int> data = unittest::random_integers<int>(100);
+
+    std::ostringstream trace;
+
+    {
+        thrust::trace::chrome_trace_sink sink(trace);
+        thrust::trace::sink *previous = thrust::trace::set_sink(&sink);
+
+        thrust::transform(data.begin(), data.end(), data.begin(), trace_negate());
+        thrust::reduce(data.begin(), data.end(), 0, trace_plus());
+
+        thrust::trace::set_sink(previous);
+    }
+
+    std::string json = trace.str();
+
+    ASSERT_EQUAL(json[0], '[');
+    ASSERT_EQUAL(json.find("\"name\":\"transform\",\"cat\":\"cpp\",\"ph\":\"X\"") != std::string::npos, true);
+    ASSERT_EQUAL(json.find("\"args\":{\"elements\":100,") != std::string::npos, true);
+    ASSERT_EQUAL(json.find("},\n{") != std::string::npos, true);
+    ASSERT_EQUAL(json.substr(json.size() - 2), std::string("]\n"));
+}
+DECLARE_UNITTEST(TestTraceChromeSink);
+
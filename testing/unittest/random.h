@@ -4,6 +4,10 @@
 #include <thrust/random.h>
 #include <thrust/detail/type_traits.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace unittest
 {
 
@@ -92,5 +96,162 @@ thrust::host_vector<T> random_samples(const size_t N)
     return vec;
 }
 
+// the shapes of input which adaptive algorithms treat differently
+enum distribution
+{
+    uniform,         // independent uniform values, like random_integers
+    presorted,       // uniform values in ascending order
+    reverse_sorted,  // uniform values in descending order
+    few_unique,      // num_unique distinct values in random order
+    zipf,            // values whose frequencies follow Zipf's law with zipf_exponent
+    sawtooth,        // ascending runs of run_length uniform values
+    all_equal,       // a single value
+    nearly_sorted    // presorted, then a fraction unsorted_fraction of the values displaced
+};
+
+const distribution all_distributions[] = {uniform, presorted, reverse_sorted, few_unique, zipf, sawtooth, all_equal, nearly_sorted};
+
+inline const char *distribution_name(distribution d)
+{
+    const char *names[] = {"uniform", "presorted", "reverse_sorted", "few_unique", "zipf", "sawtooth", "all_equal", "nearly_sorted"};
+    return names[d];
+}
+
+struct distribution_parameters
+{
+    // vectors made with different seeds have different values, except for
+    // the shared pools of few_unique, zipf and all_equal; seed 0 reproduces random_integers
+    unsigned int seed;
+
+    // the number of distinct values of few_unique
+    size_t num_unique;
+
+    // the skew of zipf, and the number of distinct values it draws from
+    double zipf_exponent;
+    size_t zipf_domain;
+
+    // the length of the runs of sawtooth
+    size_t run_length;
+
+    // the fraction of the values of nearly_sorted out of place
+    double unsorted_fraction;
+
+    distribution_parameters(unsigned int seed = 0)
+      : seed(seed), num_unique(16), zipf_exponent(1.0), zipf_domain(1 << 16), run_length(1024), unsorted_fraction(0.01)
+    {}
+};
+
+template<typename T>
+thrust::host_vector<T> random_distribution(distribution d, const size_t N, const distribution_parameters &p = distribution_parameters())
+{
+    random_integer<T> value;
+
+    // the i-th random number of this seed
+    const unsigned int offset = static_cast<unsigned int>(p.seed * N);
+
+    thrust::host_vector<T> vec(N);
+
+    switch(d)
+    {
+        case uniform:
+        case presorted:
+        case reverse_sorted:
+        case sawtooth:
+        case nearly_sorted:
+        {
+            for(size_t i = 0; i < N; i++)
+                vec[i] = value(offset + i);
+            break;
+        }
+
+        case few_unique:
+        {
+            const size_t num_unique = std::max<size_t>(1, p.num_unique);
+
+            for(size_t i = 0; i < N; i++)
+                vec[i] = value(hash(offset + i) % num_unique);
+            break;
+        }
+
+        case zipf:
+        {
+            // draw ranks by inverting the cumulative distribution of their frequencies
+            const size_t domain = std::max<size_t>(1, std::min(N, p.zipf_domain));
+
+            std::vector<double> cumulative(domain);
+            double total = 0;
+            for(size_t k = 0; k < domain; k++)
+            {
+                total += 1.0 / std::pow(double(k + 1), p.zipf_exponent);
+                cumulative[k] = total;
+            }
+
+            for(size_t i = 0; i < N; i++)
+            {
+                thrust::default_random_engine rng(hash(offset + i));
+                thrust::uniform_real_distribution<double> dist(0, total);
+
+                const size_t rank = std::upper_bound(cumulative.begin(), cumulative.end(), dist(rng)) - cumulative.begin();
+
+                vec[i] = value(static_cast<unsigned int>(std::min(rank, domain - 1)));
+            }
+            break;
+        }
+
+        case all_equal:
+        {
+            std::fill(vec.begin(), vec.end(), value(0));
+            break;
+        }
+    }
+
+    switch(d)
+    {
+        case presorted:
+        case nearly_sorted:
+        {
+            std::sort(vec.begin(), vec.end());
+            break;
+        }
+
+        case reverse_sorted:
+        {
+            std::sort(vec.begin(), vec.end());
+            std::reverse(vec.begin(), vec.end());
+            break;
+        }
+
+        case sawtooth:
+        {
+            const size_t run_length = std::max<size_t>(1, p.run_length);
+
+            for(size_t i = 0; i < N; i += run_length)
+                std::sort(vec.begin() + i, vec.begin() + std::min(N, i + run_length));
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    // displace values by swapping random pairs
+    if(d == nearly_sorted && N > 1)
+    {
+        const size_t num_swaps = static_cast<size_t>(p.unsorted_fraction * N / 2);
+
+        thrust::default_random_engine rng(hash(offset + 1));
+        thrust::uniform_int_distribution<unsigned int> dist(0, static_cast<unsigned int>(N - 1));
+
+        for(size_t j = 0; j < num_swaps; j++)
+        {
+            const size_t a = dist(rng);
+            const size_t b = dist(rng);
+            std::swap(vec[a], vec[b]);
+        }
+    }
+
+    return vec;
+}
+
 }; //end namespace unittest
 
@@ -754,3 +754,107 @@ void TestVectorReversed(void)
 }
 DECLARE_VECTOR_UNITTEST(TestVectorReversed);
 
+
+
+template <typename Vector>
+void TestVectorDefaultInit(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(3, thrust::default_init);
+  ASSERT_EQUAL(3, v.size());
+
+  v[0] = 0; v[1] = 1; v[2] = 2;
+
+  // existing elements survive growth
+  v.resize(100, thrust::default_init);
+  ASSERT_EQUAL(100, v.size());
+  ASSERT_EQUAL(0, v[0]);
+  ASSERT_EQUAL(1, v[1]);
+  ASSERT_EQUAL(2, v[2]);
+
+  v.resize(2, thrust::first_touch);
+  ASSERT_EQUAL(2, v.size());
+  ASSERT_EQUAL(1, v[1]);
+
+  v.resize(5000, thrust::first_touch);
+  ASSERT_EQUAL(5000, v.size());
+  ASSERT_EQUAL(1, v[1]);
+
+  Vector w(10000, thrust::first_touch);
+  thrust::sequence(w.begin(), w.end());
+  ASSERT_EQUAL(T(9999), w[9999]);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInit);
+
+
+void TestVectorDefaultInitNonTrivial(void)
+{
+  // elements of types with constructors are still constructed
+  thrust::host_vector< std::vector<int> > v(2, thrust::default_init);
+  v.resize(4, thrust::first_touch);
+
+  ASSERT_EQUAL(4, v.size());
+  ASSERT_EQUAL(true, static_cast< std::vector<int> >(v[3]).empty());
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNonTrivial);
+
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template <typename Vector>
+void TestVectorMove(void)
+{
+  Vector v1(3);
+  v1[0] = 0; v1[1] = 1; v1[2] = 2;
+
+  typename Vector::pointer data = v1.data();
+
+  // the elements change hands without being copied
+  Vector v2(std::move(v1));
+
+  ASSERT_EQUAL(0, v1.size());
+  ASSERT_EQUAL(3, v2.size());
+  ASSERT_EQUAL(true, v2.data() == data);
+  ASSERT_EQUAL(2, v2[2]);
+
+  Vector v3(2);
+  v3 = std::move(v2);
+
+  ASSERT_EQUAL(0, v2.size());
+  ASSERT_EQUAL(3, v3.size());
+  ASSERT_EQUAL(true, v3.data() == data);
+
+  // a moved-from vector may be used again
+  v2.push_back(7);
+  ASSERT_EQUAL(1, v2.size());
+  ASSERT_EQUAL(7, v2[0]);
+
+  // vectors of vectors move rather than copy their elements as they grow
+  std::vector<Vector> vv;
+  vv.push_back(std::move(v3));
+  vv.resize(64);
+
+  ASSERT_EQUAL(true, vv[0].data() == data);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorMove);
+
+
+template <typename Vector>
+void TestVectorEmplace(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v;
+  v.emplace_back(T(1));
+  v.emplace_back(T(3));
+
+  typename Vector::iterator i = v.emplace(v.begin() + 1, T(2));
+
+  ASSERT_EQUAL(1, i - v.begin());
+  ASSERT_EQUAL(3, v.size());
+  ASSERT_EQUAL(1, v[0]);
+  ASSERT_EQUAL(2, v[1]);
+  ASSERT_EQUAL(3, v[2]);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorEmplace);
+#endif
@@ -21,6 +21,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/adjacent_difference.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -37,6 +38,8 @@ OutputIterator adjacent_difference(InputIterator first, InputIterator last,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("adjacent_difference", select_system(system1(), system2()), first, last);
+
   return adjacent_difference(select_system(system1(), system2()), first, last, result);
 } // end adjacent_difference()
 
@@ -51,6 +54,8 @@ OutputIterator adjacent_difference(InputIterator first, InputIterator last,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("adjacent_difference", select_system(system1(), system2()), first, last);
+
   return adjacent_difference(select_system(system1(), system2()), first, last, result, binary_op);
 } // end adjacent_difference()
 
@@ -0,0 +1,60 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/detail/allocator/tagged_allocator.h>
+#include <thrust/detail/allocator/allocator_alignment.h>
+#include <thrust/detail/static_assert.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace detail
+{
+
+// like malloc_allocator, but the storage it allocates begins on a multiple of Alignment bytes
+template<typename T, typename Tag, typename Pointer, std::size_t Alignment>
+  class aligned_malloc_allocator
+    : public thrust::detail::tagged_allocator<
+               T, Tag, Pointer
+             >
+{
+  private:
+    typedef thrust::detail::tagged_allocator<
+      T, Tag, Pointer
+    > super_t;
+
+    THRUST_STATIC_ASSERT((Alignment >= sizeof(void*)) && ((Alignment & (Alignment - 1)) == 0));
+
+  public:
+    typedef typename super_t::pointer   pointer;
+    typedef typename super_t::size_type size_type;
+
+    // the alignment of the storage allocate returns, see allocator_alignment
+    static const std::size_t alignment = Alignment;
+
+    pointer allocate(size_type cnt);
+
+    void deallocate(pointer p, size_type n);
+};
+
+} // end detail
+} // end thrust
+
+#include <thrust/detail/allocator/aligned_malloc_allocator.inl>
+
@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/aligned_malloc_allocator.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/malloc_and_free_adl_helper.h>
+
+namespace thrust
+{
+namespace detail
+{
+
+
+template<typename T, typename Tag, typename Pointer, std::size_t Alignment>
+  const std::size_t aligned_malloc_allocator<T,Tag,Pointer,Alignment>::alignment;
+
+
+template<typename T, typename Tag, typename Pointer, std::size_t Alignment>
+  typename aligned_malloc_allocator<T,Tag,Pointer,Alignment>::pointer
+    aligned_malloc_allocator<T,Tag,Pointer,Alignment>
+      ::allocate(typename aligned_malloc_allocator<T,Tag,Pointer,Alignment>::size_type cnt)
+{
+  using thrust::system::detail::generic::select_system;
+
+  T* result = static_cast<T*>(aligned_malloc(select_system(Tag()), sizeof(typename super_t::value_type) * cnt, Alignment));
+
+  if(result == 0)
+  {
+    throw thrust::system::detail::bad_alloc("aligned_malloc_allocator::allocate: aligned_malloc failed");
+  } // end if
+
+  return pointer(result);
+} // end aligned_malloc_allocator::allocate()
+
+
+template<typename T, typename Tag, typename Pointer, std::size_t Alignment>
+  void aligned_malloc_allocator<T,Tag,Pointer,Alignment>
+    ::deallocate(typename aligned_malloc_allocator<T,Tag,Pointer,Alignment>::pointer p, typename aligned_malloc_allocator<T,Tag,Pointer,Alignment>::size_type)
+{
+  using thrust::system::detail::generic::select_system;
+
+  aligned_free(select_system(Tag()), p);
+} // end aligned_malloc_allocator::deallocate()
+
+
+} // end detail
+} // end thrust
+
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace detail
+{
+namespace allocator_alignment_detail
+{
+
+template<typename Allocator>
+  struct has_alignment
+{
+  typedef char yes_type;
+  typedef int  no_type;
+  template<typename S> static yes_type test(char (*)[S::alignment]);
+  template<typename S> static no_type  test(...);
+  static bool const value = sizeof(test<Allocator>(0)) == sizeof(yes_type);
+};
+
+template<typename Allocator, bool = has_alignment<Allocator>::value>
+  struct alignment
+    : thrust::detail::integral_constant<std::size_t, 1>
+{};
+
+template<typename Allocator>
+  struct alignment<Allocator,true>
+    : thrust::detail::integral_constant<std::size_t, Allocator::alignment>
+{};
+
+} // end allocator_alignment_detail
+
+// the alignment in bytes which the storage Allocator allocates is guaranteed to begin on,
+// Allocator::alignment for the aligned allocators, and 1 for those which guarantee no more
+// than the alignment of their value_type. Code which receives the storage of a container
+// can use it to choose aligned SIMD loads and stores at compile time, instead of checking
+// the address of the storage at run time.
+template<typename Allocator>
+  struct allocator_alignment
+    : allocator_alignment_detail::alignment<Allocator>
+{};
+
+} // end detail
+} // end thrust
+
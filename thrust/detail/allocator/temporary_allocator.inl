@@ -18,9 +18,12 @@
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/memory.h>
+#include <thrust/detail/temporary_buffer_adl_helper.h>
 #include <thrust/system/detail/bad_alloc.h>
 #include <thrust/pair.h>
 #include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/trace.h>
+#include <thrust/temporary_memory_monitor.h>
 
 namespace thrust
 {
@@ -47,19 +50,23 @@ template<typename T, typename Tag>
 {
   using thrust::system::detail::generic::select_system;
   using thrust::system::detail::generic::get_temporary_buffer;
+  using thrust::system::detail::generic::return_temporary_buffer;
 
   pointer_and_size result = allocate_helper(get_temporary_buffer<T>(select_system(Tag()), cnt));
 
   // handle failure
   if(result.second < cnt)
   {
-    // deallocate and throw
-    // note that we pass cnt to deallocate, not a value derived from result.second
-    deallocate(result.first, cnt);
+    // return the buffer, which was never counted, and throw
+    return_temporary_buffer(select_system(Tag()), result.first);
 
     throw thrust::system::detail::bad_alloc("temporary_buffer::allocate: get_temporary_buffer failed");
   } // end if
 
+  thrust::detail::temporary_memory_monitor_access::record_allocation(cnt * sizeof(T));
+
+  THRUST_TRACE_TEMPORARY_ALLOCATION(cnt * sizeof(T));
+
   return result.first;
 } // end temporary_allocator::allocate()
 
@@ -71,6 +78,8 @@ template<typename T, typename Tag>
   using thrust::system::detail::generic::return_temporary_buffer;
 
   return_temporary_buffer(select_system(Tag()), p);
+
+  thrust::detail::temporary_memory_monitor_access::record_deallocation(n * sizeof(T));
 } // end temporary_allocator
 
 } // end detail
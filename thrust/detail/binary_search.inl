@@ -23,6 +23,7 @@
 #include <thrust/binary_search.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/binary_search.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -43,6 +44,8 @@ ForwardIterator lower_bound(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system; 
 
+    THRUST_TRACE_ALGORITHM("lower_bound", select_system(system()), first, last);
+
     return lower_bound(select_system(system()), first, last, value);
 }
 
@@ -57,6 +60,8 @@ ForwardIterator lower_bound(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system; 
 
+    THRUST_TRACE_ALGORITHM("lower_bound", select_system(system()), first, last);
+
     return lower_bound(select_system(system()), first, last, value, comp);
 }
 
@@ -70,6 +75,8 @@ ForwardIterator upper_bound(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("upper_bound", select_system(system()), first, last);
+
     return upper_bound(select_system(system()), first, last, value);
 }
 
@@ -84,6 +91,8 @@ ForwardIterator upper_bound(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("upper_bound", select_system(system()), first, last);
+
     return upper_bound(select_system(system()), first, last, value, comp);
 }
 
@@ -97,6 +106,8 @@ bool binary_search(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("binary_search", select_system(system()), first, last);
+
     return binary_search(select_system(system()), first, last, value);
 }
 
@@ -111,6 +122,8 @@ bool binary_search(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("binary_search", select_system(system()), first, last);
+
     return binary_search(select_system(system()), first, last, value, comp);
 }
 
@@ -125,6 +138,8 @@ equal_range(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("equal_range", select_system(system()), first, last);
+
     return equal_range(select_system(system()), first, last, value);
 }
 
@@ -140,6 +155,8 @@ equal_range(ForwardIterator first,
 
     typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("equal_range", select_system(system()), first, last);
+
     return equal_range(select_system(system()), first, last, value, comp);
 }
 
@@ -161,6 +178,8 @@ OutputIterator lower_bound(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("lower_bound", select_system(system1(),system2(),system3()), first, last);
+
     return lower_bound(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output);
 }
 
@@ -179,6 +198,8 @@ OutputIterator lower_bound(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("lower_bound", select_system(system1(),system2(),system3()), first, last);
+
     return lower_bound(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output, comp);
 }
     
@@ -196,6 +217,8 @@ OutputIterator upper_bound(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("upper_bound", select_system(system1(),system2(),system3()), first, last);
+
     return upper_bound(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output);
 }
 
@@ -214,6 +237,8 @@ OutputIterator upper_bound(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("upper_bound", select_system(system1(),system2(),system3()), first, last);
+
     return upper_bound(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output, comp);
 }
 
@@ -231,6 +256,8 @@ OutputIterator binary_search(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("binary_search", select_system(system1(),system2(),system3()), first, last);
+
     return binary_search(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output);
 }
 
@@ -249,6 +276,8 @@ OutputIterator binary_search(ForwardIterator first,
     typedef typename thrust::iterator_system<InputIterator>::type   system2;
     typedef typename thrust::iterator_system<OutputIterator>::type  system3;
 
+    THRUST_TRACE_ALGORITHM("binary_search", select_system(system1(),system2(),system3()), first, last);
+
     return binary_search(select_system(system1(),system2(),system3()), first, last, values_first, values_last, output, comp);
 }
 
@@ -74,6 +74,13 @@
 #define THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE THRUST_FALSE
 #endif // _OPENMP
 
+// does the host compiler support c++11's rvalue references, noexcept, and variadic templates?
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && (_MSC_VER >= 1900))
+#define THRUST_HOST_COMPILER_IS_CXX11_CAPABLE THRUST_TRUE
+#else
+#define THRUST_HOST_COMPILER_IS_CXX11_CAPABLE THRUST_FALSE
+#endif
+
 // disable specific MSVC warnings
 #if (THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC) && !defined(__CUDA_ARCH__)
 #define __THRUST_DISABLE_MSVC_WARNING_BEGIN(x) \
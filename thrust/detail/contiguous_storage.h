@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <thrust/detail/config.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 
 namespace thrust
@@ -44,6 +45,14 @@ template<typename T, typename Alloc>
 
     explicit contiguous_storage(size_type n);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    // takes x's allocation, leaving x empty
+    contiguous_storage(contiguous_storage &&x) noexcept;
+
+    // releases this storage's allocation and takes x's, leaving x empty
+    contiguous_storage &operator=(contiguous_storage &&x) noexcept;
+#endif
+
     ~contiguous_storage(void);
 
     size_type size(void) const;
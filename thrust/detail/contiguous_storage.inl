@@ -46,6 +46,32 @@ template<typename T, typename Alloc>
   allocate(n);
 } // end contiguous_storage::contiguous_storage()
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template<typename T, typename Alloc>
+  contiguous_storage<T,Alloc>
+    ::contiguous_storage(contiguous_storage &&x) noexcept
+      :m_allocator(),
+       m_begin(pointer(static_cast<T*>(0))),
+       m_size(0)
+{
+  swap(x);
+} // end contiguous_storage::contiguous_storage()
+
+template<typename T, typename Alloc>
+  contiguous_storage<T,Alloc> &
+    contiguous_storage<T,Alloc>
+      ::operator=(contiguous_storage &&x) noexcept
+{
+  if(this != &x)
+  {
+    deallocate();
+    swap(x);
+  } // end if
+
+  return *this;
+} // end contiguous_storage::operator=()
+#endif
+
 template<typename T, typename Alloc>
   contiguous_storage<T,Alloc>
     ::~contiguous_storage(void)
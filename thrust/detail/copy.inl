@@ -18,6 +18,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/detail/copy.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -37,6 +38,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("copy", select_system(system1(),system2()), first, last);
+
   return copy(select_system(system1(),system2()), first, last, result);
 } // end copy()
 
@@ -54,6 +57,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("copy_n", select_system(system1(),system2()), first, n);
+
   return copy_n(select_system(system1(),system2()), first, n, result);
 } // end copy_n()
 
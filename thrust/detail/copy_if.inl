@@ -19,6 +19,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/detail/adl_helper.h>
 
 namespace thrust
@@ -39,6 +40,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("copy_if", select_system(system1(),system2()), first, last);
+
   return copy_if(select_system(system1(),system2()), first, last, result, pred);
 } // end copy_if()
 
@@ -60,6 +63,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("copy_if", select_system(system1(),system2(),system3()), first, last);
+
   return copy_if(select_system(system1(),system2(),system3()), first, last, stencil, result, pred);
 } // end copy_if()
 
@@ -23,6 +23,7 @@
 #include <thrust/count.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/count.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -38,6 +39,8 @@ count(InputIterator first, InputIterator last, const EqualityComparable& value)
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("count", select_system(system()), first, last);
+
   return count(select_system(system()), first, last, value);
 } // end count()
 
@@ -50,6 +53,8 @@ count_if(InputIterator first, InputIterator last, Predicate pred)
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("count_if", select_system(system()), first, last);
+
   return count_if(select_system(system()), first, last, pred);
 } // end count_if()
 
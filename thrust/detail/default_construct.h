@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file default_construct.h
+ *  \brief Defines the interface to functions for
+ *         default-constructing the elements of uninitialized storage.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/system/cpp/detail/page_placement.h>
+#include <thrust/uninitialized_fill.h>
+#include <cstddef>
+
+namespace thrust
+{
+
+namespace detail
+{
+
+namespace default_construct_detail
+{
+
+
+template<typename Pointer, typename Size>
+  void first_touch_n(Pointer first, Size n, thrust::detail::true_type) // is_convertible<System, cpp::tag>
+{
+  typedef typename thrust::iterator_system<Pointer>::type System;
+
+  using thrust::system::detail::generic::select_system;
+
+  // the host system which owns the memory decides which of its threads fault in each page
+  place_pages(select_system(System()), thrust::raw_pointer_cast(&*first), std::ptrdiff_t(n));
+} // end first_touch_n()
+
+
+template<typename Pointer, typename Size>
+  void first_touch_n(Pointer, Size, thrust::detail::false_type) // is_convertible<System, cpp::tag>
+{
+  // the host does not place this system's memory; nothing to do
+  ;
+} // end first_touch_n()
+
+
+template<typename Pointer, typename Size>
+  void default_construct_n(Pointer first, Size n, bool touch, thrust::detail::true_type) // has_trivial_constructor
+{
+  typedef typename thrust::iterator_system<Pointer>::type System;
+
+  // trivial elements need no initialization, so their pages are left
+  // to be mapped by whichever thread first writes to them
+  if(touch && n > 0)
+  {
+    first_touch_n(first, n, typename thrust::detail::is_convertible<System, thrust::system::cpp::tag>::type());
+  } // end if
+} // end default_construct_n()
+
+
+template<typename Pointer, typename Size>
+  void default_construct_n(Pointer first, Size n, bool, thrust::detail::false_type) // has_trivial_constructor
+{
+  typedef typename thrust::iterator_value<Pointer>::type value_type;
+
+  thrust::uninitialized_fill_n(first, n, value_type());
+} // end default_construct_n()
+
+
+} // end default_construct_detail
+
+
+// default-constructs the n elements of uninitialized storage beginning at first,
+// which leaves elements of types with trivial constructors uninitialized
+template<typename Pointer, typename Size>
+  void default_construct_n(Pointer first, Size n)
+{
+  typedef typename thrust::iterator_value<Pointer>::type value_type;
+
+  default_construct_detail::default_construct_n(first, n, false,
+    typename thrust::detail::has_trivial_constructor<value_type>::type());
+} // end default_construct_n()
+
+
+// as default_construct_n, but also maps each page of host memory through the
+// system which owns it, in parallel, before returning
+template<typename Pointer, typename Size>
+  void first_touch_construct_n(Pointer first, Size n)
+{
+  typedef typename thrust::iterator_value<Pointer>::type value_type;
+
+  default_construct_detail::default_construct_n(first, n, true,
+    typename thrust::detail::has_trivial_constructor<value_type>::type());
+} // end first_touch_construct_n()
+
+
+} // end detail
+
+} // end thrust
+
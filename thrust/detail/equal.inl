@@ -22,6 +22,7 @@
 #include <thrust/equal.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/equal.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -38,6 +39,8 @@ bool equal(InputIterator1 first1, InputIterator1 last1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("equal", select_system(system1(),system2()), first1, last1);
+
   return equal(select_system(system1(),system2()), first1, last1, first2);
 }
 
@@ -52,6 +55,8 @@ bool equal(InputIterator1 first1, InputIterator1 last1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("equal", select_system(system1(),system2()), first1, last1);
+
   return equal(select_system(system1(),system2()), first1, last1, first2, binary_pred);
 }
 
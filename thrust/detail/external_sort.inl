@@ -0,0 +1,684 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/external_sort.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/functional.h>
+#include <thrust/system_error.h>
+#include <thrust/detail/type_traits.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+namespace external_sort_detail
+{
+
+
+// the Value of a sort without values
+struct no_value {};
+
+
+// merges read blocks of at least this many bytes from each run, so that
+// reading a block takes much longer than seeking to it
+const std::size_t min_block_bytes = 1 << 16;
+
+
+template<typename Key, typename Value>
+  struct record_size
+{
+  static const std::size_t value = sizeof(Key) + (is_same<Value,no_value>::value ? 0 : sizeof(Value));
+};
+
+
+inline void throw_errno(const char *what_arg)
+{
+  throw thrust::system_error(errno, thrust::system_category(), what_arg);
+} // end throw_errno()
+
+
+inline void throw_io_error(const char *what_arg)
+{
+  throw thrust::system_error(thrust::errc::io_error, thrust::generic_category(), what_arg);
+} // end throw_io_error()
+
+
+// I/O of records to the caller's streams and to the runs' temporary files
+// returns the number of whole records read
+template<typename T>
+  std::size_t read_records(std::istream &input, T *result, std::size_t n)
+{
+  input.read(reinterpret_cast<char*>(result), n * sizeof(T));
+
+  if(input.bad()) throw_io_error("external_sort: read failed");
+
+  return static_cast<std::size_t>(input.gcount()) / sizeof(T);
+} // end read_records()
+
+
+template<typename T>
+  std::size_t read_records(std::FILE *input, T *result, std::size_t n)
+{
+  std::size_t num_read = std::fread(result, sizeof(T), n, input);
+
+  if(std::ferror(input)) throw_errno("external_sort: fread failed");
+
+  return num_read;
+} // end read_records()
+
+
+inline std::size_t read_records(std::istream &, no_value *, std::size_t n)
+{
+  return n;
+} // end read_records()
+
+
+inline std::size_t read_records(std::FILE *, no_value *, std::size_t n)
+{
+  return n;
+} // end read_records()
+
+
+template<typename T>
+  void write_records(std::ostream &output, const T *first, std::size_t n)
+{
+  output.write(reinterpret_cast<const char*>(first), n * sizeof(T));
+
+  if(!output) throw_io_error("external_sort: write failed");
+} // end write_records()
+
+
+template<typename T>
+  void write_records(std::FILE *output, const T *first, std::size_t n)
+{
+  if(std::fwrite(first, sizeof(T), n, output) != n) throw_errno("external_sort: fwrite failed");
+} // end write_records()
+
+
+inline void write_records(std::ostream &, const no_value *, std::size_t)
+{
+} // end write_records()
+
+
+inline void write_records(std::FILE *, const no_value *, std::size_t)
+{
+} // end write_records()
+
+
+inline bool at_end(std::istream &input)
+{
+  return input.peek() == std::istream::traits_type::eof();
+} // end at_end()
+
+
+// asks the system to read the next num_bytes of file in the background
+inline void prefetch(std::FILE *file, std::size_t num_bytes)
+{
+#if defined(POSIX_FADV_WILLNEED)
+  if(file != 0 && num_bytes > 0)
+  {
+    // runs are unbuffered, so the position of the stream is that of the file
+    ::posix_fadvise(fileno(file), std::ftell(file), num_bytes, POSIX_FADV_WILLNEED);
+  } // end if
+#endif
+} // end prefetch()
+
+
+// a block of records in memory
+template<typename Key, typename Value>
+  struct record_buffer
+{
+  thrust::host_vector<Key>   keys;
+  thrust::host_vector<Value> values;
+
+  void resize(std::size_t n)
+  {
+    keys.resize(n, thrust::default_init);
+    values.resize(n, thrust::default_init);
+  }
+
+  Key   *key_data()   { return thrust::raw_pointer_cast(keys.data()); }
+  Value *value_data() { return thrust::raw_pointer_cast(values.data()); }
+
+  template<typename StrictWeakOrdering>
+  void sort(std::size_t n, StrictWeakOrdering comp)
+  {
+    thrust::stable_sort_by_key(keys.begin(), keys.begin() + n, values.begin(), comp);
+  }
+
+  void copy(std::size_t i, const record_buffer &other, std::size_t j)
+  {
+    keys[i]   = other.keys[j];
+    values[i] = other.values[j];
+  }
+}; // end record_buffer
+
+
+template<typename Key>
+  struct record_buffer<Key,no_value>
+{
+  thrust::host_vector<Key> keys;
+
+  void resize(std::size_t n)
+  {
+    keys.resize(n, thrust::default_init);
+  }
+
+  Key      *key_data()   { return thrust::raw_pointer_cast(keys.data()); }
+  no_value *value_data() { return 0; }
+
+  template<typename StrictWeakOrdering>
+  void sort(std::size_t n, StrictWeakOrdering comp)
+  {
+    thrust::stable_sort(keys.begin(), keys.begin() + n, comp);
+  }
+
+  void copy(std::size_t i, const record_buffer &other, std::size_t j)
+  {
+    keys[i] = other.keys[j];
+  }
+}; // end record_buffer
+
+
+// returns the number of records read, which is less than n only at the end of the input
+template<typename Key, typename Value, typename KeySource, typename ValueSource>
+  std::size_t read_block(KeySource &keys_input, ValueSource &values_input, record_buffer<Key,Value> &buffer, std::size_t n)
+{
+  std::size_t num_keys   = read_records(keys_input,   buffer.key_data(),   n);
+  std::size_t num_values = read_records(values_input, buffer.value_data(), num_keys);
+
+  if(num_values != num_keys)
+  {
+    throw thrust::system_error(thrust::errc::invalid_argument, thrust::generic_category(), "external_sort_by_key: fewer values than keys");
+  } // end if
+
+  return num_keys;
+} // end read_block()
+
+
+template<typename Key, typename Value, typename KeySink, typename ValueSink>
+  void write_block(KeySink &keys_output, ValueSink &values_output, record_buffer<Key,Value> &buffer, std::size_t n)
+{
+  write_records(keys_output,   buffer.key_data(),   n);
+  write_records(values_output, buffer.value_data(), n);
+} // end write_block()
+
+
+// a sorted run spilled to temporary files
+struct run
+{
+  std::FILE *keys;
+  std::FILE *values;
+  std::size_t size;
+};
+
+
+// owns the temporary files of a list of runs
+class run_list
+{
+  public:
+    run_list() {}
+
+    ~run_list()
+    {
+      close(0, m_runs.size());
+    }
+
+    run &create(bool with_values)
+    {
+      run r = {0, 0, 0};
+      m_runs.push_back(r);
+
+      run &result = m_runs.back();
+      result.keys = open_temporary_file();
+
+      if(with_values)
+      {
+        result.values = open_temporary_file();
+      } // end if
+
+      return result;
+    }
+
+    void close(std::size_t first, std::size_t n)
+    {
+      for(std::size_t i = first; i < first + n; ++i)
+      {
+        if(m_runs[i].keys)   std::fclose(m_runs[i].keys);
+        if(m_runs[i].values) std::fclose(m_runs[i].values);
+
+        m_runs[i].keys   = 0;
+        m_runs[i].values = 0;
+      } // end for
+    }
+
+    std::size_t size() const { return m_runs.size(); }
+
+    bool empty() const { return m_runs.empty(); }
+
+    run &operator[](std::size_t i) { return m_runs[i]; }
+
+    void swap(run_list &other) { m_runs.swap(other.m_runs); }
+
+  private:
+    // run_lists own their files, so they may not be copied
+    run_list(const run_list &);
+    run_list &operator=(const run_list &);
+
+    static std::FILE *open_temporary_file()
+    {
+      // removed when closed
+      std::FILE *result = std::tmpfile();
+
+      if(result == 0) throw_errno("external_sort: tmpfile failed");
+
+      // runs are read and written in large blocks, which need no buffering
+      std::setvbuf(result, 0, _IONBF, 0);
+
+      return result;
+    }
+
+    std::vector<run> m_runs;
+}; // end run_list
+
+
+// reads the records of a run one block at a time, reading ahead the next block
+template<typename Key, typename Value>
+  class run_reader
+{
+  public:
+    void open(const run &r, std::size_t block_size)
+    {
+      m_run        = r;
+      m_block_size = block_size;
+      m_remaining  = r.size;
+      m_position   = 0;
+      m_count      = 0;
+
+      std::rewind(m_run.keys);
+      if(m_run.values) std::rewind(m_run.values);
+
+      m_buffer.resize(block_size);
+
+      prefetch_next_block();
+      refill();
+    }
+
+    bool empty() const { return m_position == m_count; }
+
+    const Key &key() const { return m_buffer.keys[m_position]; }
+
+    const record_buffer<Key,Value> &buffer() const { return m_buffer; }
+
+    std::size_t position() const { return m_position; }
+
+    // returns false when the run is exhausted
+    bool advance()
+    {
+      ++m_position;
+
+      if(m_position == m_count) refill();
+
+      return !empty();
+    }
+
+  private:
+    void prefetch_next_block()
+    {
+      std::size_t n = (std::min)(m_block_size, m_remaining);
+
+      prefetch(m_run.keys,   n * sizeof(Key));
+      prefetch(m_run.values, n * sizeof(Value));
+    }
+
+    void refill()
+    {
+      std::size_t n = (std::min)(m_block_size, m_remaining);
+
+      if(read_block(m_run.keys, m_run.values, m_buffer, n) != n)
+      {
+        throw_io_error("external_sort: run is shorter than written");
+      } // end if
+
+      m_remaining -= n;
+      m_position   = 0;
+      m_count      = n;
+
+      // the system reads the next block while this one is merged
+      prefetch_next_block();
+    }
+
+    run m_run;
+    record_buffer<Key,Value> m_buffer;
+    std::size_t m_block_size;
+    std::size_t m_remaining;
+    std::size_t m_position;
+    std::size_t m_count;
+}; // end run_reader
+
+
+// orders the readers of a merge by their next keys, with ties broken by the order of
+// their runs, which keeps the merge stable
+// std::push_heap and friends keep the greatest element at the front, so the
+// reader whose key comes last is "less"
+template<typename Reader, typename StrictWeakOrdering>
+  struct reader_comes_after
+{
+  const std::vector<Reader> *readers;
+  StrictWeakOrdering comp;
+
+  reader_comes_after(const std::vector<Reader> &readers, StrictWeakOrdering comp)
+    : readers(&readers), comp(comp)
+  {}
+
+  bool operator()(std::size_t i, std::size_t j)
+  {
+    if(comp((*readers)[j].key(), (*readers)[i].key())) return true;
+    if(comp((*readers)[i].key(), (*readers)[j].key())) return false;
+    return i > j;
+  }
+}; // end reader_comes_after
+
+
+// merges the n runs beginning at runs[first] to the sinks, returning the number of records
+template<typename Key, typename Value, typename KeySink, typename ValueSink, typename StrictWeakOrdering>
+  std::size_t merge_runs(run_list &runs, std::size_t first, std::size_t n,
+                         KeySink &keys_output, ValueSink &values_output,
+                         std::size_t memory_bytes,
+                         StrictWeakOrdering comp)
+{
+  typedef run_reader<Key,Value> reader;
+
+  // divide memory between a block of each run and a block of output
+  const std::size_t block_size = (std::max<std::size_t>)(1, memory_bytes / ((n + 1) * record_size<Key,Value>::value));
+
+  std::vector<reader> readers(n);
+
+  std::vector<std::size_t> heap;
+  heap.reserve(n);
+
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    readers[i].open(runs[first + i], block_size);
+
+    if(!readers[i].empty()) heap.push_back(i);
+  } // end for
+
+  reader_comes_after<reader,StrictWeakOrdering> heap_comp(readers, comp);
+
+  std::make_heap(heap.begin(), heap.end(), heap_comp);
+
+  record_buffer<Key,Value> output;
+  output.resize(block_size);
+
+  std::size_t num_buffered = 0;
+  std::size_t num_merged   = 0;
+
+  while(!heap.empty())
+  {
+    std::pop_heap(heap.begin(), heap.end(), heap_comp);
+
+    reader &next = readers[heap.back()];
+
+    output.copy(num_buffered, next.buffer(), next.position());
+    ++num_buffered;
+
+    if(num_buffered == block_size)
+    {
+      write_block(keys_output, values_output, output, num_buffered);
+      num_merged  += num_buffered;
+      num_buffered = 0;
+    } // end if
+
+    if(next.advance())
+    {
+      std::push_heap(heap.begin(), heap.end(), heap_comp);
+    } // end if
+    else
+    {
+      heap.pop_back();
+    } // end else
+  } // end while
+
+  write_block(keys_output, values_output, output, num_buffered);
+
+  return num_merged + num_buffered;
+} // end merge_runs()
+
+
+template<typename Key, typename Value, typename KeySink, typename ValueSink, typename StrictWeakOrdering>
+  void external_sort(std::istream &keys_input, std::istream &values_input,
+                     KeySink &keys_output, ValueSink &values_output,
+                     std::size_t memory_bytes,
+                     StrictWeakOrdering comp)
+{
+  const bool with_values = !is_same<Value,no_value>::value;
+  const std::size_t record_bytes = record_size<Key,Value>::value;
+
+  run_list runs;
+
+  // form sorted runs, leaving half of memory to the sort's temporary storage
+  {
+    const std::size_t chunk_size = (std::max<std::size_t>)(1, memory_bytes / (2 * record_bytes));
+
+    record_buffer<Key,Value> chunk;
+    chunk.resize(chunk_size);
+
+    std::size_t n = chunk_size;
+
+    while(n == chunk_size)
+    {
+      n = read_block(keys_input, values_input, chunk, chunk_size);
+
+      if(n == 0) break;
+
+      chunk.sort(n, comp);
+
+      // an input which fits in memory needs no runs
+      if(runs.empty() && (n < chunk_size || at_end(keys_input)))
+      {
+        write_block(keys_output, values_output, chunk, n);
+        return;
+      } // end if
+
+      run &r = runs.create(with_values);
+      write_block(r.keys, r.values, chunk, n);
+      r.size = n;
+    } // end while
+  }
+
+  if(runs.empty()) return;
+
+  // merge groups of runs until few enough remain to merge at once with blocks of about min_block_bytes
+  const std::size_t max_fan_in = (std::max<std::size_t>)(2, memory_bytes / min_block_bytes);
+
+  while(runs.size() > max_fan_in)
+  {
+    run_list merged;
+
+    for(std::size_t first = 0; first < runs.size(); first += max_fan_in)
+    {
+      std::size_t n = (std::min)(max_fan_in, runs.size() - first);
+
+      run &r = merged.create(with_values);
+      r.size = merge_runs<Key,Value>(runs, first, n, r.keys, r.values, memory_bytes, comp);
+
+      // release the disk space of the merged runs before merging the next group
+      runs.close(first, n);
+    } // end for
+
+    runs.swap(merged);
+  } // end while
+
+  merge_runs<Key,Value>(runs, 0, runs.size(), keys_output, values_output, memory_bytes, comp);
+} // end external_sort()
+
+
+inline void open(std::ifstream &stream, const char *filename)
+{
+  stream.open(filename, std::ios::in | std::ios::binary);
+
+  if(!stream) throw_errno("external_sort: could not open input file");
+} // end open()
+
+
+inline void open(std::ofstream &stream, const char *filename)
+{
+  stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if(!stream) throw_errno("external_sort: could not open output file");
+} // end open()
+
+
+inline void close(std::ofstream &stream)
+{
+  stream.close();
+
+  if(!stream) throw_io_error("external_sort: could not close output file");
+} // end close()
+
+
+} // end external_sort_detail
+} // end detail
+
+
+template<typename T>
+  void external_sort(std::istream &input,
+                     std::ostream &output,
+                     std::size_t memory_bytes)
+{
+  thrust::external_sort<T>(input, output, memory_bytes, thrust::less<T>());
+} // end external_sort()
+
+
+template<typename T, typename StrictWeakOrdering>
+  void external_sort(std::istream &input,
+                     std::ostream &output,
+                     std::size_t memory_bytes,
+                     StrictWeakOrdering comp)
+{
+  using thrust::detail::external_sort_detail::no_value;
+
+  // values are neither read nor written, so the keys' streams stand in for them
+  thrust::detail::external_sort_detail::external_sort<T,no_value>(input, input, output, output, memory_bytes, comp);
+} // end external_sort()
+
+
+template<typename T>
+  void external_sort(const char *input_filename,
+                     const char *output_filename,
+                     std::size_t memory_bytes)
+{
+  thrust::external_sort<T>(input_filename, output_filename, memory_bytes, thrust::less<T>());
+} // end external_sort()
+
+
+template<typename T, typename StrictWeakOrdering>
+  void external_sort(const char *input_filename,
+                     const char *output_filename,
+                     std::size_t memory_bytes,
+                     StrictWeakOrdering comp)
+{
+  namespace external_sort_detail = thrust::detail::external_sort_detail;
+
+  std::ifstream input;
+  external_sort_detail::open(input, input_filename);
+
+  std::ofstream output;
+  external_sort_detail::open(output, output_filename);
+
+  thrust::external_sort<T>(input, output, memory_bytes, comp);
+
+  external_sort_detail::close(output);
+} // end external_sort()
+
+
+template<typename Key, typename Value>
+  void external_sort_by_key(std::istream &keys_input,
+                            std::istream &values_input,
+                            std::ostream &keys_output,
+                            std::ostream &values_output,
+                            std::size_t memory_bytes)
+{
+  thrust::external_sort_by_key<Key,Value>(keys_input, values_input, keys_output, values_output, memory_bytes, thrust::less<Key>());
+} // end external_sort_by_key()
+
+
+template<typename Key, typename Value, typename StrictWeakOrdering>
+  void external_sort_by_key(std::istream &keys_input,
+                            std::istream &values_input,
+                            std::ostream &keys_output,
+                            std::ostream &values_output,
+                            std::size_t memory_bytes,
+                            StrictWeakOrdering comp)
+{
+  thrust::detail::external_sort_detail::external_sort<Key,Value>(keys_input, values_input, keys_output, values_output, memory_bytes, comp);
+} // end external_sort_by_key()
+
+
+template<typename Key, typename Value>
+  void external_sort_by_key(const char *keys_input_filename,
+                            const char *values_input_filename,
+                            const char *keys_output_filename,
+                            const char *values_output_filename,
+                            std::size_t memory_bytes)
+{
+  thrust::external_sort_by_key<Key,Value>(keys_input_filename, values_input_filename,
+                                          keys_output_filename, values_output_filename,
+                                          memory_bytes, thrust::less<Key>());
+} // end external_sort_by_key()
+
+
+template<typename Key, typename Value, typename StrictWeakOrdering>
+  void external_sort_by_key(const char *keys_input_filename,
+                            const char *values_input_filename,
+                            const char *keys_output_filename,
+                            const char *values_output_filename,
+                            std::size_t memory_bytes,
+                            StrictWeakOrdering comp)
+{
+  namespace external_sort_detail = thrust::detail::external_sort_detail;
+
+  std::ifstream keys_input, values_input;
+  external_sort_detail::open(keys_input,   keys_input_filename);
+  external_sort_detail::open(values_input, values_input_filename);
+
+  std::ofstream keys_output, values_output;
+  external_sort_detail::open(keys_output,   keys_output_filename);
+  external_sort_detail::open(values_output, values_output_filename);
+
+  thrust::external_sort_by_key<Key,Value>(keys_input, values_input, keys_output, values_output, memory_bytes, comp);
+
+  external_sort_detail::close(keys_output);
+  external_sort_detail::close(values_output);
+} // end external_sort_by_key()
+
+
+} // end thrust
+
@@ -19,6 +19,7 @@
 #include <thrust/extrema.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/extrema.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -34,6 +35,8 @@ ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("min_element", select_system(system()), first, last);
+
   return min_element(select_system(system()), first, last);
 } // end min_element()
 
@@ -47,6 +50,8 @@ ForwardIterator min_element(ForwardIterator first, ForwardIterator last,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("min_element", select_system(system()), first, last);
+
   return min_element(select_system(system()), first, last, comp);
 } // end min_element()
 
@@ -59,6 +64,8 @@ ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("max_element", select_system(system()), first, last);
+
   return max_element(select_system(system()), first, last);
 } // end max_element()
 
@@ -72,6 +79,8 @@ ForwardIterator max_element(ForwardIterator first, ForwardIterator last,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("max_element", select_system(system()), first, last);
+
   return max_element(select_system(system()), first, last, comp);
 } // end max_element()
 
@@ -85,6 +94,8 @@ minmax_element(ForwardIterator first, ForwardIterator last)
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("minmax_element", select_system(system()), first, last);
+
   return minmax_element(select_system(system()), first, last);
 } // end minmax_element()
 
@@ -98,6 +109,8 @@ minmax_element(ForwardIterator first, ForwardIterator last, BinaryPredicate comp
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("minmax_element", select_system(system()), first, last);
+
   return minmax_element(select_system(system()), first, last, comp);
 } // end minmax_element()
 
@@ -22,6 +22,7 @@
 #include <thrust/fill.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/fill.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -38,6 +39,8 @@ template<typename ForwardIterator, typename T>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("fill", select_system(system()), first, last);
+
   fill(select_system(system()), first, last, value);
 } // end fill()
 
@@ -51,6 +54,8 @@ template<typename OutputIterator, typename Size, typename T>
 
   typedef typename thrust::iterator_system<OutputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("fill_n", select_system(system()), first, n);
+
   return fill_n(select_system(system()), first, n, value);
 } // end fill()
 
@@ -22,6 +22,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/find.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -38,6 +39,8 @@ InputIterator find(InputIterator first,
 
     typedef typename thrust::iterator_system<InputIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("find", select_system(system()), first, last);
+
     return find(select_system(system()), first, last, value);
 }
 
@@ -51,6 +54,8 @@ InputIterator find_if(InputIterator first,
 
     typedef typename thrust::iterator_system<InputIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("find_if", select_system(system()), first, last);
+
     return find_if(select_system(system()), first, last, pred);
 }
 
@@ -64,6 +69,8 @@ InputIterator find_if_not(InputIterator first,
 
     typedef typename thrust::iterator_system<InputIterator>::type system;
 
+    THRUST_TRACE_ALGORITHM("find_if_not", select_system(system()), first, last);
+
     return find_if_not(select_system(system()), first, last, pred);
 }
 
@@ -23,6 +23,7 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/for_each.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ InputIterator for_each(InputIterator first,
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("for_each", select_system(system()), first, last);
+
   return for_each(select_system(system()), first, last, f);
 } // end for_each()
 
@@ -55,6 +58,8 @@ InputIterator for_each_n(InputIterator first,
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("for_each_n", select_system(system()), first, n);
+
   return for_each_n(select_system(system()), first, n, f);
 } // end for_each_n()
 
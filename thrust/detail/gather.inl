@@ -22,6 +22,7 @@
 #include <thrust/gather.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/gather.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -43,6 +44,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system2; 
   typedef typename thrust::iterator_system<OutputIterator>::type       system3; 
 
+  THRUST_TRACE_ALGORITHM("gather", select_system(system1(),system2(),system3()), map_first, map_last);
+
   return gather(select_system(system1(),system2(),system3()), map_first, map_last, input_first, result);
 } // end gather()
 
@@ -65,6 +68,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system3; 
   typedef typename thrust::iterator_system<OutputIterator>::type       system4; 
 
+  THRUST_TRACE_ALGORITHM("gather_if", select_system(system1(),system2(),system3(),system4()), map_first, map_last);
+
   return gather_if(select_system(system1(),system2(),system3(),system4()), map_first, map_last, stencil, input_first, result);
 } // end gather_if()
 
@@ -89,6 +94,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system3; 
   typedef typename thrust::iterator_system<OutputIterator>::type       system4; 
 
+  THRUST_TRACE_ALGORITHM("gather_if", select_system(system1(),system2(),system3(),system4()), map_first, map_last);
+
   return gather_if(select_system(system1(),system2(),system3(),system4()), map_first, map_last, stencil, input_first, result, pred);
 } // end gather_if()
 
@@ -23,6 +23,7 @@
 #include <thrust/generate.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/generate.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type type;
 
+  THRUST_TRACE_ALGORITHM("generate", select_system(type()), first, last);
+
   return generate(select_system(type()), first, last, gen);
 } // end generate()
 
@@ -56,6 +59,8 @@ template<typename OutputIterator,
 
   typedef typename thrust::iterator_system<OutputIterator>::type type;
 
+  THRUST_TRACE_ALGORITHM("generate_n", select_system(type()), first, n);
+
   return generate_n(select_system(type()), first, n, gen);
 } // end generate_n()
 
@@ -22,6 +22,7 @@
 #include <thrust/generate.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/inner_product.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ inner_product(InputIterator1 first1, InputIterator1 last1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("inner_product", select_system(system1(),system2()), first1, last1);
+
   return inner_product(select_system(system1(),system2()), first1, last1, first2, init);
 } // end inner_product()
 
@@ -56,6 +59,8 @@ inner_product(InputIterator1 first1, InputIterator1 last1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("inner_product", select_system(system1(),system2()), first1, last1);
+
   return inner_product(select_system(system1(),system2()), first1, last1, first2, init, binary_op1, binary_op2);
 } // end inner_product()
 
@@ -22,6 +22,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/logical.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -36,6 +37,8 @@ bool all_of(InputIterator first, InputIterator last, Predicate pred)
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("all_of", select_system(system()), first, last);
+
   return all_of(select_system(system()), first, last, pred);
 }
 
@@ -47,6 +50,8 @@ bool any_of(InputIterator first, InputIterator last, Predicate pred)
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("any_of", select_system(system()), first, last);
+
   return any_of(select_system(system()), first, last, pred);
 }
 
@@ -58,6 +63,8 @@ bool none_of(InputIterator first, InputIterator last, Predicate pred)
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("none_of", select_system(system()), first, last);
+
   return none_of(select_system(system()), first, last, pred);
 }
 
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/low_memory_monitor.h>
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+#define __THRUST_LOW_MEMORY_MONITOR_THREAD_LOCAL thread_local
+#elif THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#define __THRUST_LOW_MEMORY_MONITOR_THREAD_LOCAL __declspec(thread)
+#else
+#define __THRUST_LOW_MEMORY_MONITOR_THREAD_LOCAL __thread
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+
+
+struct low_memory_monitor_access
+{
+  // returns the innermost low_memory_monitor bound to the calling thread, or null
+  static low_memory_monitor *&current()
+  {
+    static __THRUST_LOW_MEMORY_MONITOR_THREAD_LOCAL low_memory_monitor *result = 0;
+    return result;
+  }
+
+  // records num_fallbacks fallbacks, the worst to mode, in the monitors bound to the calling thread
+  static void record(low_memory_monitor::mode mode, std::size_t num_fallbacks = 1)
+  {
+    if(mode == low_memory_monitor::full_buffer) return;
+
+    for(low_memory_monitor *monitor = current(); monitor; monitor = monitor->m_enclosing)
+    {
+      if(mode > monitor->m_worst_mode)
+      {
+        monitor->m_worst_mode = mode;
+      } // end if
+
+      monitor->m_num_fallbacks += num_fallbacks;
+
+      if(!monitor->m_propagates) return;
+    } // end for
+  }
+
+  // keeps monitor's records from its enclosing monitors, so that the work of a
+  // parallel algorithm's threads may be observed separately and then recorded
+  // once by the thread which dispatched it
+  static void detach(low_memory_monitor &monitor)
+  {
+    monitor.m_propagates = false;
+  }
+
+  static void record(const low_memory_monitor &monitor)
+  {
+    if(monitor.m_num_fallbacks > 0)
+    {
+      record(monitor.m_worst_mode, monitor.m_num_fallbacks);
+    } // end if
+  }
+}; // end low_memory_monitor_access
+
+
+} // end detail
+
+
+low_memory_monitor
+  ::low_memory_monitor()
+    : m_worst_mode(full_buffer),
+      m_num_fallbacks(0),
+      m_propagates(true),
+      m_enclosing(thrust::detail::low_memory_monitor_access::current())
+{
+  thrust::detail::low_memory_monitor_access::current() = this;
+} // end low_memory_monitor::low_memory_monitor()
+
+
+low_memory_monitor
+  ::~low_memory_monitor()
+{
+  thrust::detail::low_memory_monitor_access::current() = m_enclosing;
+} // end low_memory_monitor::~low_memory_monitor()
+
+
+low_memory_monitor::mode low_memory_monitor
+  ::worst_mode() const
+{
+  return m_worst_mode;
+} // end low_memory_monitor::worst_mode()
+
+
+std::size_t low_memory_monitor
+  ::num_fallbacks() const
+{
+  return m_num_fallbacks;
+} // end low_memory_monitor::num_fallbacks()
+
+
+} // end thrust
+
+#undef __THRUST_LOW_MEMORY_MONITOR_THREAD_LOCAL
+
@@ -25,9 +25,9 @@
 #if   THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_CPP
 #include <thrust/system/cpp/detail/malloc_and_free.h>
 #elif THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP
-// omp has no malloc_and_free.h
+#include <thrust/system/omp/detail/malloc_and_free.h>
 #elif THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
-// tbb has no malloc_and_free.h
+#include <thrust/system/tbb/detail/malloc_and_free.h>
 #else
 #error "Unknown host system."
 #endif // THRUST_HOST_SYSTEM
@@ -36,9 +36,9 @@
 #if   THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 #include <thrust/system/cuda/detail/malloc_and_free.h>
 #elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
-// omp has no malloc_and_free.h
+#include <thrust/system/omp/detail/malloc_and_free.h>
 #elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
-// tbb has no malloc_and_free.h
+#include <thrust/system/tbb/detail/malloc_and_free.h>
 #else
 #error "Unknown device system."
 #endif // THRUST_DEVICE_SYSTEM
@@ -0,0 +1,316 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/mapped_vector.h>
+#include <thrust/system_error.h>
+#include <thrust/detail/util/align.h>
+#include <algorithm>
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define __THRUST_MAPPED_VECTOR_HAS_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+namespace mapped_vector_detail
+{
+
+#ifdef __THRUST_MAPPED_VECTOR_HAS_MMAP
+
+// closes fd, if it is open, and reports the error which preceded the call
+inline void throw_errno(int fd, const char *what_arg)
+{
+  int error = errno;
+
+  if(fd != -1)
+  {
+    ::close(fd);
+  } // end if
+
+  throw thrust::system_error(error, thrust::system_category(), what_arg);
+} // end throw_errno()
+
+
+inline int advice(int pattern)
+{
+  // the order of mapped_vector's access_pattern
+  const int advice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED};
+
+  return advice[pattern];
+} // end advice()
+
+#endif // __THRUST_MAPPED_VECTOR_HAS_MMAP
+
+} // end mapped_vector_detail
+} // end detail
+
+
+template<typename T, typename System>
+  mapped_vector<T,System>
+    ::mapped_vector(const char *filename, access_mode mode)
+      : m_begin(0),
+        m_size(0),
+        m_mapped_bytes(0),
+        m_mode(mode)
+{
+  map(filename, mode, false, 0);
+} // end mapped_vector::mapped_vector()
+
+
+template<typename T, typename System>
+  mapped_vector<T,System>
+    ::mapped_vector(const char *filename, size_type n)
+      : m_begin(0),
+        m_size(0),
+        m_mapped_bytes(0),
+        m_mode(read_write)
+{
+  map(filename, read_write, true, n);
+} // end mapped_vector::mapped_vector()
+
+
+template<typename T, typename System>
+  mapped_vector<T,System>
+    ::~mapped_vector()
+{
+#ifdef __THRUST_MAPPED_VECTOR_HAS_MMAP
+  if(m_mapped_bytes > 0)
+  {
+    ::munmap(m_begin, m_mapped_bytes);
+  } // end if
+#endif // __THRUST_MAPPED_VECTOR_HAS_MMAP
+} // end mapped_vector::~mapped_vector()
+
+
+template<typename T, typename System>
+  void mapped_vector<T,System>
+    ::map(const char *filename, access_mode mode, bool resize, size_type n)
+{
+#ifdef __THRUST_MAPPED_VECTOR_HAS_MMAP
+  using thrust::detail::mapped_vector_detail::throw_errno;
+
+  int flags = (mode == read_only) ? O_RDONLY : O_RDWR;
+  if(resize) flags |= O_CREAT;
+
+  int fd = ::open(filename, flags, 0666);
+  if(fd == -1) throw_errno(fd, "mapped_vector: open failed");
+
+  if(resize)
+  {
+    if(::ftruncate(fd, static_cast<off_t>(n * sizeof(T))) == -1)
+    {
+      throw_errno(fd, "mapped_vector: ftruncate failed");
+    } // end if
+
+    m_size = n;
+  } // end if
+  else
+  {
+    struct stat status;
+
+    if(::fstat(fd, &status) == -1)
+    {
+      throw_errno(fd, "mapped_vector: fstat failed");
+    } // end if
+
+    // trailing bytes which do not make up a whole element are ignored
+    m_size = static_cast<size_type>(status.st_size) / sizeof(T);
+  } // end else
+
+  m_mapped_bytes = m_size * sizeof(T);
+
+  // empty files cannot be mapped; leave m_begin null
+  if(m_mapped_bytes > 0)
+  {
+    int protection = (mode == read_only) ? PROT_READ : (PROT_READ | PROT_WRITE);
+
+    void *ptr = ::mmap(0, m_mapped_bytes, protection, MAP_SHARED, fd, 0);
+
+    if(ptr == MAP_FAILED)
+    {
+      m_size = 0;
+      m_mapped_bytes = 0;
+      throw_errno(fd, "mapped_vector: mmap failed");
+    } // end if
+
+    m_begin = static_cast<T*>(ptr);
+  } // end if
+
+  // the mapping keeps the file open
+  ::close(fd);
+#else
+  throw thrust::system_error(thrust::errc::function_not_supported, thrust::generic_category(), "mapped_vector: memory-mapped files are not supported");
+#endif // __THRUST_MAPPED_VECTOR_HAS_MMAP
+} // end mapped_vector::map()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::size_type mapped_vector<T,System>
+    ::size() const
+{
+  return m_size;
+} // end mapped_vector::size()
+
+
+template<typename T, typename System>
+  bool mapped_vector<T,System>
+    ::empty() const
+{
+  return m_size == 0;
+} // end mapped_vector::empty()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::access_mode mapped_vector<T,System>
+    ::mode() const
+{
+  return m_mode;
+} // end mapped_vector::mode()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::iterator mapped_vector<T,System>
+    ::begin()
+{
+  return iterator(m_begin);
+} // end mapped_vector::begin()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::const_iterator mapped_vector<T,System>
+    ::begin() const
+{
+  return const_iterator(m_begin);
+} // end mapped_vector::begin()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::iterator mapped_vector<T,System>
+    ::end()
+{
+  return iterator(m_begin + m_size);
+} // end mapped_vector::end()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::const_iterator mapped_vector<T,System>
+    ::end() const
+{
+  return const_iterator(m_begin + m_size);
+} // end mapped_vector::end()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::pointer mapped_vector<T,System>
+    ::data()
+{
+  return m_begin;
+} // end mapped_vector::data()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::const_pointer mapped_vector<T,System>
+    ::data() const
+{
+  return m_begin;
+} // end mapped_vector::data()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::reference mapped_vector<T,System>
+    ::operator[](size_type i)
+{
+  return m_begin[i];
+} // end mapped_vector::operator[]()
+
+
+template<typename T, typename System>
+  typename mapped_vector<T,System>::const_reference mapped_vector<T,System>
+    ::operator[](size_type i) const
+{
+  return m_begin[i];
+} // end mapped_vector::operator[]()
+
+
+template<typename T, typename System>
+  void mapped_vector<T,System>
+    ::advise(access_pattern pattern)
+{
+  advise(pattern, 0, m_size);
+} // end mapped_vector::advise()
+
+
+template<typename T, typename System>
+  void mapped_vector<T,System>
+    ::advise(access_pattern pattern, size_type first, size_type n)
+{
+#ifdef __THRUST_MAPPED_VECTOR_HAS_MMAP
+  first = (std::min)(first, m_size);
+  n     = (std::min)(n, m_size - first);
+
+  if(n == 0) return;
+
+  // the mapping begins on a page boundary, so aligning down stays within it
+  std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+  char *begin = thrust::detail::util::align_down(reinterpret_cast<char*>(m_begin + first), page_size);
+  char *end   = reinterpret_cast<char*>(m_begin + first + n);
+
+  // advice is only a hint, so failure is not an error
+  ::madvise(begin, end - begin, thrust::detail::mapped_vector_detail::advice(pattern));
+#endif // __THRUST_MAPPED_VECTOR_HAS_MMAP
+} // end mapped_vector::advise()
+
+
+template<typename T, typename System>
+  void mapped_vector<T,System>
+    ::flush()
+{
+#ifdef __THRUST_MAPPED_VECTOR_HAS_MMAP
+  if(m_mode == read_write && m_mapped_bytes > 0)
+  {
+    if(::msync(m_begin, m_mapped_bytes, MS_SYNC) == -1)
+    {
+      thrust::detail::mapped_vector_detail::throw_errno(-1, "mapped_vector: msync failed");
+    } // end if
+  } // end if
+#endif // __THRUST_MAPPED_VECTOR_HAS_MMAP
+} // end mapped_vector::flush()
+
+
+template<typename T, typename System>
+  void mapped_vector<T,System>
+    ::swap(mapped_vector &other)
+{
+  std::swap(m_begin,        other.m_begin);
+  std::swap(m_size,         other.m_size);
+  std::swap(m_mapped_bytes, other.m_mapped_bytes);
+  std::swap(m_mode,         other.m_mode);
+} // end mapped_vector::swap()
+
+
+} // end thrust
+
+#undef __THRUST_MAPPED_VECTOR_HAS_MMAP
+
@@ -20,9 +20,12 @@
 
 #include <thrust/merge.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/functional.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/merge.h>
 #include <thrust/detail/adl_helper.h>
+#include <vector>
 
 namespace thrust
 {
@@ -45,6 +48,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("merge", select_system(system1(),system2(),system3()), first1, last1);
+
   return merge(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result, comp);
 } // end set_intersection()
 
@@ -64,8 +69,204 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("merge", select_system(system1(),system2(),system3()), first1, last1);
+
   return merge(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result);
 } // end merge()
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  typename thrust::detail::enable_if<
+    thrust::detail::is_integral<Size>::value,
+    OutputIterator
+  >::type
+    merge_n(RangeIterator ranges,
+            Size n,
+            OutputIterator result,
+            StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+  using thrust::system::detail::generic::merge_n;
+
+  typedef typename thrust::iterator_value<RangeIterator>::type::first_type InputIterator;
+
+  typedef typename thrust::iterator_system<InputIterator>::type  system1;
+  typedef typename thrust::iterator_system<OutputIterator>::type system2;
+
+  THRUST_TRACE_ALGORITHM("merge_n", select_system(system1(),system2()), ranges, n);
+
+  return merge_n(select_system(system1(),system2()), ranges, n, result, comp);
+} // end merge_n()
+
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator merge_n(RangeIterator ranges,
+                         Size n,
+                         OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type::first_type InputIterator;
+  typedef typename thrust::iterator_value<InputIterator>::type             value_type;
+
+  // dispatching on a tag here would be ambiguous with the version taking a comparison, which
+  // argument dependent lookup finds through thrust::pair, so supply the comparison instead
+  return thrust::merge_n(ranges, n, result, thrust::less<value_type>());
+} // end merge_n()
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  typename thrust::detail::enable_if<
+    thrust::detail::is_integral<Size>::value,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+  using thrust::system::detail::generic::merge_n_by_key;
+
+  typedef typename thrust::iterator_value<RangeIterator>::type::first_type InputIterator1;
+  typedef typename thrust::iterator_value<ValueIteratorIterator>::type     InputIterator2;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type  system1;
+  typedef typename thrust::iterator_system<InputIterator2>::type  system2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type system3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type system4;
+
+  THRUST_TRACE_ALGORITHM("merge_n_by_key", select_system(system1(),system2(),system3(),system4()), key_ranges, n);
+
+  return merge_n_by_key(select_system(system1(),system2(),system3(),system4()), key_ranges, values, n, keys_result, values_result, comp);
+} // end merge_n_by_key()
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type::first_type InputIterator1;
+  typedef typename thrust::iterator_value<InputIterator1>::type            key_type;
+
+  // see merge_n
+  return thrust::merge_n_by_key(key_ranges, values, n, keys_result, values_result, thrust::less<key_type>());
+} // end merge_n_by_key()
+
+template<typename InputIterator,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    OutputIterator
+  >::type
+    merge_n(InputIterator first,
+            OffsetIterator offsets,
+            Size num_ranges,
+            OutputIterator result,
+            StrictWeakOrdering comp)
+{
+  typedef thrust::pair<InputIterator,InputIterator> range;
+
+  // the offsets reside in host memory, as does the array of ranges they become
+  std::vector<range> ranges(num_ranges);
+  for(Size i = 0; i < num_ranges; ++i)
+  {
+    ranges[i] = range(first + offsets[i], first + offsets[i + 1]);
+  }
+
+  return thrust::merge_n(ranges.begin(), num_ranges, result, comp);
+} // end merge_n()
+
+template<typename InputIterator,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    OutputIterator
+  >::type
+    merge_n(InputIterator first,
+            OffsetIterator offsets,
+            Size num_ranges,
+            OutputIterator result)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+
+  return thrust::merge_n(first, offsets, num_ranges, result, thrust::less<value_type>());
+} // end merge_n()
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(InputIterator1 keys_first,
+                   InputIterator2 values_first,
+                   OffsetIterator offsets,
+                   Size num_ranges,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  typedef thrust::pair<InputIterator1,InputIterator1> range;
+
+  // see merge_n
+  std::vector<range>          key_ranges(num_ranges);
+  std::vector<InputIterator2> values(num_ranges);
+  for(Size i = 0; i < num_ranges; ++i)
+  {
+    key_ranges[i] = range(keys_first + offsets[i], keys_first + offsets[i + 1]);
+    values[i]     = values_first + offsets[i];
+  }
+
+  return thrust::merge_n_by_key(key_ranges.begin(), values.begin(), num_ranges, keys_result, values_result, comp);
+} // end merge_n_by_key()
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(InputIterator1 keys_first,
+                   InputIterator2 values_first,
+                   OffsetIterator offsets,
+                   Size num_ranges,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type key_type;
+
+  return thrust::merge_n_by_key(keys_first, values_first, offsets, num_ranges, keys_result, values_result, thrust::less<key_type>());
+} // end merge_n_by_key()
+
 } // end thrust
 
+
@@ -0,0 +1,52 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust
+{
+namespace detail
+{
+
+// enables the versions of merge_n and merge_n_by_key taking an array of offsets, whose
+// elements are integral, and disables them otherwise, so that they are not confused with
+// the versions taking an array of ranges, whose count is in the same position, nor with
+// the versions taking a system tag first, which argument dependent lookup finds through
+// the thrust::pairs of the array of ranges
+template<typename OffsetIterator,
+         typename Result,
+         bool = thrust::detail::is_integral<OffsetIterator>::value>
+  struct enable_if_merge_offsets
+{};
+
+template<typename OffsetIterator, typename Result>
+  struct enable_if_merge_offsets<OffsetIterator,Result,false>
+    : thrust::detail::enable_if<
+        thrust::detail::is_integral<
+          typename thrust::iterator_value<OffsetIterator>::type
+        >::value,
+        Result
+      >
+{};
+
+} // end detail
+} // end thrust
+
@@ -24,6 +24,7 @@
 #include <thrust/mismatch.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/mismatch.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -41,6 +42,8 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("mismatch", select_system(system1(),system2()), first1, last1);
+
   return mismatch(select_system(system1(),system2()), first1, last1, first2);
 } // end mismatch()
 
@@ -56,6 +59,8 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1,
   typedef typename thrust::iterator_system<InputIterator1>::type system1;
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("mismatch", select_system(system1(),system2()), first1, last1);
+
   return mismatch(select_system(system1(),system2()), first1, last1, first2, pred);
 } // end mismatch()
 
@@ -23,6 +23,7 @@
 #include <thrust/partition.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("partition", select_system(system()), first, last);
+
   return partition(select_system(system()), first, last, pred);
 } // end partition()
 
@@ -55,6 +58,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("stable_partition", select_system(system()), first, last);
+
   return stable_partition(select_system(system()), first, last, pred);
 } // end stable_partition()
 
@@ -77,6 +82,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<OutputIterator1>::type system2;
   typedef typename thrust::iterator_system<OutputIterator2>::type system3;
 
+  THRUST_TRACE_ALGORITHM("partition_copy", select_system(system1(),system2(),system3()), first, last);
+
   return partition_copy(select_system(system1(),system2(),system3()), first, last, out_true, out_false, pred);
 } // end partition_copy()
 
@@ -99,6 +106,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<OutputIterator1>::type system2;
   typedef typename thrust::iterator_system<OutputIterator2>::type system3;
 
+  THRUST_TRACE_ALGORITHM("stable_partition_copy", select_system(system1(),system2(),system3()), first, last);
+
   return stable_partition_copy(select_system(system1(),system2(),system3()), first, last, out_true, out_false, pred);
 } // end stable_partition_copy()
 
@@ -113,6 +122,8 @@ template<typename ForwardIterator, typename Predicate>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("partition_point", select_system(system()), first, last);
+
   return partition_point(select_system(system()), first, last, pred);
 } // end partition_point()
 
@@ -127,6 +138,8 @@ template<typename InputIterator, typename Predicate>
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("is_partitioned", select_system(system()), first, last);
+
   return is_partitioned(select_system(system()), first, last, pred);
 } // end is_partitioned()
 
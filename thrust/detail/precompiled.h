@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file precompiled.h
+ *  \brief Explicit instantiations of common algorithm calls, shared by
+ *         thrust/precompiled.h and the library which defines them
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/host_vector.h>
+#include <thrust/device_vector.h>
+
+// extern template is standard only as of c++11, but older gcc & msvc accept it as an extension
+#if (THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE) || (THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_GCC) || (THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC)
+#define __THRUST_PRECOMPILED_ENABLED 1
+#else
+#define __THRUST_PRECOMPILED_ENABLED 0
+#endif
+
+// each of the following emits the instantiations of a family of algorithms for
+// a sequence of Iterator whose value_type is T
+// PREFIX is "extern template" to declare them and "template" to define them
+
+#define __THRUST_PRECOMPILED_SORT(PREFIX, Iterator, T) \
+  PREFIX void thrust::sort<Iterator >(Iterator, Iterator); \
+  PREFIX void thrust::sort<Iterator, thrust::less<T> >(Iterator, Iterator, thrust::less<T>); \
+  PREFIX void thrust::sort<Iterator, thrust::greater<T> >(Iterator, Iterator, thrust::greater<T>); \
+  PREFIX void thrust::stable_sort<Iterator >(Iterator, Iterator); \
+  PREFIX void thrust::stable_sort<Iterator, thrust::less<T> >(Iterator, Iterator, thrust::less<T>); \
+  PREFIX void thrust::stable_sort<Iterator, thrust::greater<T> >(Iterator, Iterator, thrust::greater<T>);
+
+#define __THRUST_PRECOMPILED_REDUCE(PREFIX, Iterator, T) \
+  PREFIX T thrust::reduce<Iterator >(Iterator, Iterator); \
+  PREFIX T thrust::reduce<Iterator, T>(Iterator, Iterator, T); \
+  PREFIX T thrust::reduce<Iterator, T, thrust::plus<T> >(Iterator, Iterator, T, thrust::plus<T>); \
+  PREFIX T thrust::reduce<Iterator, T, thrust::maximum<T> >(Iterator, Iterator, T, thrust::maximum<T>); \
+  PREFIX T thrust::reduce<Iterator, T, thrust::minimum<T> >(Iterator, Iterator, T, thrust::minimum<T>);
+
+#define __THRUST_PRECOMPILED_SCAN(PREFIX, Iterator, T) \
+  PREFIX Iterator thrust::inclusive_scan<Iterator, Iterator >(Iterator, Iterator, Iterator); \
+  PREFIX Iterator thrust::inclusive_scan<Iterator, Iterator, thrust::plus<T> >(Iterator, Iterator, Iterator, thrust::plus<T>); \
+  PREFIX Iterator thrust::exclusive_scan<Iterator, Iterator >(Iterator, Iterator, Iterator); \
+  PREFIX Iterator thrust::exclusive_scan<Iterator, Iterator, T>(Iterator, Iterator, Iterator, T); \
+  PREFIX Iterator thrust::exclusive_scan<Iterator, Iterator, T, thrust::plus<T> >(Iterator, Iterator, Iterator, T, thrust::plus<T>);
+
+// emits ALGORITHM for each of the value types the library provides;
+// Sequence names a template whose iterator is Sequence<T>::iterator
+#define __THRUST_PRECOMPILED_FOR_EACH_TYPE(ALGORITHM, PREFIX, Sequence) \
+  ALGORITHM(PREFIX, Sequence<int>::type,                int) \
+  ALGORITHM(PREFIX, Sequence<unsigned int>::type,       unsigned int) \
+  ALGORITHM(PREFIX, Sequence<long long>::type,          long long) \
+  ALGORITHM(PREFIX, Sequence<unsigned long long>::type, unsigned long long) \
+  ALGORITHM(PREFIX, Sequence<float>::type,              float) \
+  ALGORITHM(PREFIX, Sequence<double>::type,             double)
+
+namespace thrust
+{
+namespace detail
+{
+namespace precompiled
+{
+
+// maps a value type to the iterator types the library provides
+template<typename T>
+  struct pointer_iterator
+{
+  typedef T* type;
+};
+
+template<typename T>
+  struct host_vector_iterator
+{
+  typedef typename thrust::host_vector<T>::iterator type;
+};
+
+template<typename T>
+  struct device_vector_iterator
+{
+  typedef typename thrust::device_vector<T>::iterator type;
+};
+
+} // end precompiled
+} // end detail
+} // end thrust
+
+// emits ALGORITHM for each of the (iterator, value type) pairs the library provides
+#define __THRUST_PRECOMPILED_HOST(ALGORITHM, PREFIX) \
+  __THRUST_PRECOMPILED_FOR_EACH_TYPE(ALGORITHM, PREFIX, thrust::detail::precompiled::pointer_iterator) \
+  __THRUST_PRECOMPILED_FOR_EACH_TYPE(ALGORITHM, PREFIX, thrust::detail::precompiled::host_vector_iterator)
+
+// the library only provides device_vector's instantiations for the host-compiled device systems
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+#define __THRUST_PRECOMPILED_INSTANTIATE(ALGORITHM, PREFIX) \
+  __THRUST_PRECOMPILED_HOST(ALGORITHM, PREFIX) \
+  __THRUST_PRECOMPILED_FOR_EACH_TYPE(ALGORITHM, PREFIX, thrust::detail::precompiled::device_vector_iterator)
+#else
+#define __THRUST_PRECOMPILED_INSTANTIATE(ALGORITHM, PREFIX) \
+  __THRUST_PRECOMPILED_HOST(ALGORITHM, PREFIX)
+#endif
+
@@ -22,6 +22,7 @@
 #include <thrust/reduce.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/reduce.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
 #include <thrust/detail/adl_helper.h>
@@ -39,6 +40,8 @@ typename thrust::iterator_traits<InputIterator>::value_type
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("reduce", select_system(system()), first, last);
+
   return reduce(select_system(system()), first, last);
 }
 
@@ -53,6 +56,8 @@ template<typename InputIterator,
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("reduce", select_system(system()), first, last);
+
   return reduce(select_system(system()), first, last, init);
 }
 
@@ -70,6 +75,8 @@ template<typename InputIterator,
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("reduce", select_system(system()), first, last);
+
   return reduce(select_system(system()), first, last, init, binary_op);
 }
 
@@ -92,6 +99,8 @@ template <typename InputIterator1,
   typedef typename thrust::iterator_system<OutputIterator1>::type system3;
   typedef typename thrust::iterator_system<OutputIterator2>::type system4;
 
+  THRUST_TRACE_ALGORITHM("reduce_by_key", select_system(system1(),system2(),system3(),system4()), keys_first, keys_last);
+
   return reduce_by_key(select_system(system1(),system2(),system3(),system4()), keys_first, keys_last, values_first, keys_output, values_output);
 }
 
@@ -116,6 +125,8 @@ template <typename InputIterator1,
   typedef typename thrust::iterator_system<OutputIterator1>::type system3;
   typedef typename thrust::iterator_system<OutputIterator2>::type system4;
 
+  THRUST_TRACE_ALGORITHM("reduce_by_key", select_system(system1(),system2(),system3(),system4()), keys_first, keys_last);
+
   return reduce_by_key(select_system(system1(),system2(),system3(),system4()), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 }
 
@@ -142,6 +153,8 @@ template <typename InputIterator1,
   typedef typename thrust::iterator_system<OutputIterator1>::type system3;
   typedef typename thrust::iterator_system<OutputIterator2>::type system4;
 
+  THRUST_TRACE_ALGORITHM("reduce_by_key", select_system(system1(),system2(),system3(),system4()), keys_first, keys_last);
+
   return reduce_by_key(select_system(system1(),system2(),system3(),system4()), keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
 }
 
@@ -23,6 +23,7 @@
 #include <thrust/remove.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/remove.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("remove", select_system(system()), first, last);
+
   return remove(select_system(system()), first, last, value);
 } // end remove()
 
@@ -57,6 +60,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("remove_copy", select_system(system1(),system2()), first, last);
+
   return remove_copy(select_system(system1(),system2()), first, last, result, value);
 } // end remove_copy()
 
@@ -71,6 +76,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("remove_if", select_system(system()), first, last);
+
   return remove_if(select_system(system()), first, last, pred);
 } // end remove_if()
 
@@ -88,6 +95,8 @@ template<typename ForwardIterator,
   typedef typename thrust::iterator_system<ForwardIterator>::type system1;
   typedef typename thrust::iterator_system<InputIterator>::type   system2;
 
+  THRUST_TRACE_ALGORITHM("remove_if", select_system(system1(),system2()), first, last);
+
   return remove_if(select_system(system1(),system2()), first, last, stencil, pred);
 } // end remove_if()
 
@@ -105,6 +114,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("remove_copy_if", select_system(system1(),system2()), first, last);
+
   return remove_copy_if(select_system(system1(),system2()), first, last, result, pred);
 } // end remove_copy_if()
 
@@ -125,6 +136,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("remove_copy_if", select_system(system1(),system2(),system3()), first, last);
+
   return remove_copy_if(select_system(system1(),system2(),system3()), first, last, stencil, result, pred);
 } // end remove_copy_if()
 
@@ -23,6 +23,7 @@
 #include <thrust/replace.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/replace.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -41,6 +42,8 @@ template<typename InputIterator, typename OutputIterator, typename Predicate, ty
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("replace_copy_if", select_system(system1(),system2()), first, last);
+
   return replace_copy_if(select_system(system1(),system2()), first, last, result, pred, new_value);
 } // end replace_copy_if()
 
@@ -58,6 +61,8 @@ template<typename InputIterator1, typename InputIterator2, typename OutputIterat
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("replace_copy_if", select_system(system1(),system2(),system3()), first, last);
+
   return replace_copy_if(select_system(system1(),system2(),system3()), first, last, stencil, result, pred, new_value);
 } // end replace_copy_if()
 
@@ -74,6 +79,8 @@ template<typename InputIterator, typename OutputIterator, typename T>
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("replace_copy", select_system(system1(),system2()), first, last);
+
   return replace_copy(select_system(system1(),system2()), first, last, result, old_value, new_value);
 } // end replace_copy()
 
@@ -87,6 +94,8 @@ template<typename ForwardIterator, typename Predicate, typename T>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("replace_if", select_system(system()), first, last);
+
   return replace_if(select_system(system()), first, last, pred, new_value);
 } // end replace_if()
 
@@ -102,6 +111,8 @@ template<typename ForwardIterator, typename InputIterator, typename Predicate, t
   typedef typename thrust::iterator_system<ForwardIterator>::type system1;
   typedef typename thrust::iterator_system<InputIterator>::type   system2;
 
+  THRUST_TRACE_ALGORITHM("replace_if", select_system(system1(),system2()), first, last);
+
   return replace_if(select_system(system1(),system2()), first, last, stencil, pred, new_value);
 } // end replace_if()
 
@@ -115,6 +126,8 @@ template<typename ForwardIterator, typename T>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("replace", select_system(system()), first, last);
+
   return replace(select_system(system()), first, last, old_value, new_value);
 } // end replace()
 
@@ -23,6 +23,7 @@
 #include <thrust/reverse.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/reverse.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -38,6 +39,8 @@ template<typename BidirectionalIterator>
 
   typedef typename thrust::iterator_system<BidirectionalIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("reverse", select_system(system()), first, last);
+
   return reverse(select_system(system()), first, last);
 } // end reverse()
 
@@ -53,6 +56,8 @@ template<typename BidirectionalIterator,
   typedef typename thrust::iterator_system<BidirectionalIterator>::type system1;
   typedef typename thrust::iterator_system<OutputIterator>::type        system2;
 
+  THRUST_TRACE_ALGORITHM("reverse_copy", select_system(system1(),system2()), first, last);
+
   return reverse_copy(select_system(system1(),system2()), first, last, result);
 } // end reverse_copy()
 
@@ -23,6 +23,7 @@
 #include <thrust/scan.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/scan.h>
 #include <thrust/system/detail/generic/scan_by_key.h>
 #include <thrust/detail/adl_helper.h>
@@ -42,6 +43,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("inclusive_scan", select_system(system1(),system2()), first, last);
+
   return inclusive_scan(select_system(system1(),system2()), first, last, result);
 } // end inclusive_scan()
 
@@ -59,6 +62,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("inclusive_scan", select_system(system1(),system2()), first, last);
+
   return inclusive_scan(select_system(system1(),system2()), first, last, result, binary_op);
 } // end inclusive_scan()
 
@@ -74,6 +79,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan", select_system(system1(),system2()), first, last);
+
   return exclusive_scan(select_system(system1(),system2()), first, last, result);
 } // end exclusive_scan()
 
@@ -91,6 +98,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan", select_system(system1(),system2()), first, last);
+
   return exclusive_scan(select_system(system1(),system2()), first, last, result, init);
 } // end exclusive_scan()
 
@@ -110,6 +119,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan", select_system(system1(),system2()), first, last);
+
   return exclusive_scan(select_system(system1(),system2()), first, last, result, init, binary_op);
 } // end exclusive_scan()
 
@@ -129,6 +140,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return inclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result);
 }
 
@@ -149,6 +162,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return inclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result, binary_pred);
 }
 
@@ -171,6 +186,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return inclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result, binary_pred, binary_op);
 }
 
@@ -190,6 +207,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return exclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result);
 }
 
@@ -210,6 +229,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return exclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result, init);
 }
 
@@ -232,6 +253,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return exclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result, init, binary_pred);
 }
 
@@ -256,6 +279,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", select_system(system1(),system2(),system3()), first1, last1);
+
   return exclusive_scan_by_key(select_system(system1(),system2(),system3()), first1, last1, first2, result, init, binary_pred, binary_op);
 }
 
@@ -22,6 +22,7 @@
 #include <thrust/scatter.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/scatter.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -43,6 +44,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type       system2; 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system3; 
 
+  THRUST_TRACE_ALGORITHM("scatter", select_system(system1(),system2(),system3()), first, last);
+
   return scatter(select_system(system1(),system2(),system3()), first, last, map, output);
 } // end scatter()
 
@@ -65,6 +68,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator3>::type       system3; 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system4; 
 
+  THRUST_TRACE_ALGORITHM("scatter_if", select_system(system1(),system2(),system3()), first, last);
+
   return scatter_if(select_system(system1(),system2(),system3()), first, last, map, stencil, output);
 } // end scatter_if()
 
@@ -89,6 +94,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator3>::type       system3; 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system4; 
 
+  THRUST_TRACE_ALGORITHM("scatter_if", select_system(system1(),system2(),system3()), first, last);
+
   return scatter_if(select_system(system1(),system2(),system3()), first, last, map, stencil, output, pred);
 } // end scatter_if()
 
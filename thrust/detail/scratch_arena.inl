@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/scratch_arena.h>
+#include <thrust/detail/util/align.h>
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+#define __THRUST_SCRATCH_ARENA_THREAD_LOCAL thread_local
+#elif THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#define __THRUST_SCRATCH_ARENA_THREAD_LOCAL __declspec(thread)
+#else
+#define __THRUST_SCRATCH_ARENA_THREAD_LOCAL __thread
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+namespace scratch_arena_detail
+{
+
+// blocks are aligned as malloc aligns them
+const std::size_t alignment = 16;
+
+// each block is preceded by a header which records the offset to restore
+// when the block is released, which is the offset before the block was carved
+struct block_header
+{
+  std::size_t previous_offset;
+  std::size_t size;
+};
+
+} // end scratch_arena_detail
+
+
+struct scratch_arena_access
+{
+  // returns the innermost scratch_arena bound to the calling thread, or null
+  static scratch_arena *&current()
+  {
+    static __THRUST_SCRATCH_ARENA_THREAD_LOCAL scratch_arena *result = 0;
+    return result;
+  }
+
+  static scratch_arena *enclosing(const scratch_arena &arena)
+  {
+    return arena.m_enclosing;
+  }
+
+  static bool falls_back(const scratch_arena &arena)
+  {
+    return arena.m_policy == scratch_arena::fall_back;
+  }
+
+  static void *allocate(scratch_arena &arena, std::size_t n)
+  {
+    return arena.allocate(n);
+  }
+
+  static bool deallocate(scratch_arena &arena, void *ptr)
+  {
+    return arena.deallocate(ptr);
+  }
+}; // end scratch_arena_access
+
+
+} // end detail
+
+
+scratch_arena
+  ::scratch_arena(void *storage, std::size_t size, exhaustion_policy policy)
+    : m_begin(static_cast<char*>(storage)),
+      m_size(size),
+      m_offset(0),
+      m_num_blocks(0),
+      m_peak_offset(0),
+      m_num_exhaustions(0),
+      m_policy(policy),
+      m_enclosing(thrust::detail::scratch_arena_access::current())
+{
+  thrust::detail::scratch_arena_access::current() = this;
+} // end scratch_arena::scratch_arena()
+
+
+scratch_arena
+  ::~scratch_arena()
+{
+  thrust::detail::scratch_arena_access::current() = m_enclosing;
+} // end scratch_arena::~scratch_arena()
+
+
+std::size_t scratch_arena
+  ::size() const
+{
+  return m_size;
+} // end scratch_arena::size()
+
+
+std::size_t scratch_arena
+  ::bytes_in_use() const
+{
+  return m_offset;
+} // end scratch_arena::bytes_in_use()
+
+
+std::size_t scratch_arena
+  ::peak_bytes_in_use() const
+{
+  return m_peak_offset;
+} // end scratch_arena::peak_bytes_in_use()
+
+
+std::size_t scratch_arena
+  ::num_exhaustions() const
+{
+  return m_num_exhaustions;
+} // end scratch_arena::num_exhaustions()
+
+
+void *scratch_arena
+  ::allocate(std::size_t n)
+{
+  typedef thrust::detail::scratch_arena_detail::block_header block_header;
+
+  using thrust::detail::scratch_arena_detail::alignment;
+
+  char *end = m_begin + m_size;
+
+  // place the block at the first aligned address with room for its header before it
+  char *block = thrust::detail::util::align_up(m_begin + m_offset + sizeof(block_header), alignment);
+
+  // blocks begin strictly inside the region, so that deallocate recognizes even empty ones
+  if(block >= end || n > static_cast<std::size_t>(end - block))
+  {
+    ++m_num_exhaustions;
+    return 0;
+  } // end if
+
+  block_header *header = reinterpret_cast<block_header*>(block) - 1;
+  header->previous_offset = m_offset;
+  header->size = n;
+
+  m_offset = (block + n) - m_begin;
+  ++m_num_blocks;
+
+  if(m_offset > m_peak_offset)
+  {
+    m_peak_offset = m_offset;
+  } // end if
+
+  return block;
+} // end scratch_arena::allocate()
+
+
+bool scratch_arena
+  ::deallocate(void *ptr)
+{
+  typedef thrust::detail::scratch_arena_detail::block_header block_header;
+
+  char *block = static_cast<char*>(ptr);
+
+  if(block < m_begin || block >= m_begin + m_size) return false;
+
+  const block_header *header = reinterpret_cast<const block_header*>(block) - 1;
+
+  --m_num_blocks;
+
+  if(m_num_blocks == 0)
+  {
+    // everything carved from the region has been released
+    m_offset = 0;
+  } // end if
+  else if(block + header->size == m_begin + m_offset)
+  {
+    // the last block carved is released, so the region behind it is free again
+    m_offset = header->previous_offset;
+  } // end else if
+
+  return true;
+} // end scratch_arena::deallocate()
+
+
+} // end thrust
+
@@ -23,6 +23,7 @@
 #include <thrust/sequence.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/sequence.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -39,6 +40,8 @@ template<typename ForwardIterator>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("sequence", select_system(system()), first, last);
+
   return sequence(select_system(system()), first, last);
 } // end sequence()
 
@@ -53,6 +56,8 @@ template<typename ForwardIterator, typename T>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("sequence", select_system(system()), first, last);
+
   return sequence(select_system(system()), first, last, init);
 } // end sequence()
 
@@ -68,6 +73,8 @@ template<typename ForwardIterator, typename T>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("sequence", select_system(system()), first, last);
+
   return sequence(select_system(system()), first, last, init, step);
 } // end sequence()
 
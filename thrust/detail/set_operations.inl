@@ -21,6 +21,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/set_operations.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -46,6 +47,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_difference", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_difference(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result, comp);
 } // end set_difference()
 
@@ -66,6 +69,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_difference", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_difference(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result);
 } // end set_difference()
 
@@ -88,6 +93,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_intersection", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_intersection(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result, comp);
 } // end set_intersection()
 
@@ -108,6 +115,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_intersection", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_intersection(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result);
 } // end set_intersection()
 
@@ -130,6 +139,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_symmetric_difference(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result, comp);
 } // end set_symmetric_difference()
 
@@ -150,6 +161,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_symmetric_difference(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result);
 } // end set_symmetric_difference()
 
@@ -172,6 +185,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_union", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_union(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result, comp);
 } // end set_union()
 
@@ -192,6 +207,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("set_union", select_system(system1(),system2(),system3()), first1, last1);
+
   return set_union(select_system(system1(),system2(),system3()), first1, last1, first2, last2, result);
 } // end set_union()
 
@@ -23,6 +23,7 @@
 #include <thrust/sort.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/sort.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -42,6 +43,8 @@ template<typename RandomAccessIterator>
 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("sort", select_system(system()), first, last);
+
   return sort(select_system(system()), first, last);
 } // end sort()
 
@@ -57,6 +60,8 @@ template<typename RandomAccessIterator,
 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("sort", select_system(system()), first, last);
+
   return sort(select_system(system()), first, last, comp);
 } // end sort()
 
@@ -70,6 +75,8 @@ template<typename RandomAccessIterator>
 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("stable_sort", select_system(system()), first, last);
+
   return stable_sort(select_system(system()), first, last);
 } // end stable_sort() 
 
@@ -85,6 +92,8 @@ template<typename RandomAccessIterator,
 
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("stable_sort", select_system(system()), first, last);
+
   return stable_sort(select_system(system()), first, last, comp);
 } // end stable_sort()
 
@@ -106,6 +115,8 @@ template<typename RandomAccessIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator1>::type system1;
   typedef typename thrust::iterator_system<RandomAccessIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("sort_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return sort_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first);
 } // end sort_by_key()
 
@@ -124,6 +135,8 @@ template<typename RandomAccessIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator1>::type system1;
   typedef typename thrust::iterator_system<RandomAccessIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("sort_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return sort_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first, comp);
 } // end sort_by_key()
 
@@ -140,6 +153,8 @@ template<typename RandomAccessIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator1>::type system1;
   typedef typename thrust::iterator_system<RandomAccessIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("stable_sort_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return stable_sort_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first);
 } // end stable_sort_by_key()
 
@@ -158,6 +173,8 @@ template<typename RandomAccessIterator1,
   typedef typename thrust::iterator_system<RandomAccessIterator1>::type system1;
   typedef typename thrust::iterator_system<RandomAccessIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("stable_sort_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return stable_sort_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
 
@@ -171,6 +188,8 @@ template<typename ForwardIterator>
   
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("is_sorted", select_system(system()), first, last);
+
   return is_sorted(select_system(system()), first, last);
 } // end is_sorted()
 
@@ -186,6 +205,8 @@ template<typename ForwardIterator,
   
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("is_sorted", select_system(system()), first, last);
+
   return is_sorted(select_system(system()), first, last, comp);
 } // end is_sorted()
 
@@ -199,6 +220,8 @@ template<typename ForwardIterator>
   
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("is_sorted_until", select_system(system()), first, last);
+
   return is_sorted_until(select_system(system()), first, last);
 } // end is_sorted_until()
 
@@ -214,6 +237,8 @@ template<typename ForwardIterator,
   
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("is_sorted_until", select_system(system()), first, last);
+
   return is_sorted_until(select_system(system()), first, last, comp);
 } // end is_sorted_until()
 
@@ -22,6 +22,7 @@
 #include <thrust/swap.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/swap_ranges.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -40,6 +41,8 @@ template<typename ForwardIterator1,
   typedef typename thrust::iterator_system<ForwardIterator1>::type system1;
   typedef typename thrust::iterator_system<ForwardIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("swap_ranges", select_system(system1(),system2()), first1, last1);
+
   return swap_ranges(select_system(system1(),system2()), first1, last1, first2);
 } // end swap_ranges()
 
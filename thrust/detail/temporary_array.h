@@ -26,8 +26,6 @@
 #include <thrust/detail/contiguous_storage.h>
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/detail/allocator/no_throw_allocator.h>
-#include <thrust/system/cpp/detail/tag.h>
-#include <memory>
 
 namespace thrust
 {
@@ -44,15 +42,8 @@ template<typename T, typename System>
         
         void,
 
-        eval_if<
-          // XXX this case shouldn't exist
-          is_same<System, thrust::cpp::tag>::value,
-
-          identity_< std::allocator<T> >,
-
-          // XXX add backend-specific allocators here?
-          identity_< no_throw_allocator<temporary_allocator<T,System> > >
-        >
+        // XXX add backend-specific allocators here?
+        identity_< no_throw_allocator<temporary_allocator<T,System> > >
       >
 {};
 
@@ -77,6 +68,10 @@ template<typename T, typename System>
 
     template<typename InputIterator>
     temporary_array(InputIterator first, InputIterator last);
+
+    // allocates storage for n elements if this temporary_array is empty,
+    // or leaves it empty and returns false if the storage is not available
+    bool try_allocate(size_type n);
 }; // end temporary_array
 
 
@@ -17,6 +17,7 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/detail/copy.h>
+#include <new>
 
 
 namespace thrust
@@ -45,6 +46,23 @@ template<typename T, typename System>
   thrust::copy(first, last, super_t::begin());
 } // end temporary_array::temporary_array()
 
+
+template<typename T, typename System>
+  bool temporary_array<T,System>
+    ::try_allocate(size_type n)
+{
+  try
+  {
+    super_t::allocate(n);
+  } // end try
+  catch(std::bad_alloc &)
+  {
+    return false;
+  } // end catch
+
+  return true;
+} // end temporary_array::try_allocate()
+
 } // end detail
 
 } // end thrust
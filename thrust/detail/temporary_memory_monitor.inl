@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/detail/config.h>
+#include <thrust/temporary_memory_monitor.h>
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+
+
+struct temporary_memory_monitor_access
+{
+  // the monitors which exist, on any thread, and the lock which guards them.
+  // both are plain-old-data which is zero before any constructor runs
+  struct registry
+  {
+    volatile long lock;
+    temporary_memory_monitor *volatile head;
+  };
+
+  static registry &get_registry()
+  {
+    static registry result;
+    return result;
+  }
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+  static void lock(volatile long &l)
+  {
+    while(_InterlockedExchange(&l, 1) != 0) {}
+  }
+
+  static void unlock(volatile long &l)
+  {
+    _InterlockedExchange(&l, 0);
+  }
+#else
+  static void lock(volatile long &l)
+  {
+    while(__sync_lock_test_and_set(&l, 1) != 0) {}
+  }
+
+  static void unlock(volatile long &l)
+  {
+    __sync_lock_release(&l);
+  }
+#endif
+
+  static void add(temporary_memory_monitor &monitor)
+  {
+    registry &r = get_registry();
+
+    lock(r.lock);
+    monitor.m_next = r.head;
+    r.head = &monitor;
+    unlock(r.lock);
+  }
+
+  static void remove(temporary_memory_monitor &monitor)
+  {
+    registry &r = get_registry();
+
+    lock(r.lock);
+
+    temporary_memory_monitor *volatile *link = &r.head;
+    while(*link != &monitor)
+    {
+      link = &(*link)->m_next;
+    }
+    *link = monitor.m_next;
+
+    unlock(r.lock);
+  }
+
+  // counts an allocation of num_bytes of temporary storage in every monitor
+  static void record_allocation(std::size_t num_bytes)
+  {
+    registry &r = get_registry();
+
+    // without monitors, allocations go uncounted and unserialized
+    if(!r.head) return;
+
+    lock(r.lock);
+
+    for(temporary_memory_monitor *monitor = r.head; monitor; monitor = monitor->m_next)
+    {
+      monitor->m_bytes_in_use += static_cast<std::ptrdiff_t>(num_bytes);
+      monitor->m_total_bytes += num_bytes;
+      ++monitor->m_num_allocations;
+
+      if(monitor->m_bytes_in_use > 0 && static_cast<std::size_t>(monitor->m_bytes_in_use) > monitor->m_peak_bytes_in_use)
+      {
+        monitor->m_peak_bytes_in_use = static_cast<std::size_t>(monitor->m_bytes_in_use);
+      } // end if
+    } // end for
+
+    unlock(r.lock);
+  }
+
+  // counts a deallocation of num_bytes of temporary storage in every monitor
+  static void record_deallocation(std::size_t num_bytes)
+  {
+    registry &r = get_registry();
+
+    if(!r.head) return;
+
+    lock(r.lock);
+
+    for(temporary_memory_monitor *monitor = r.head; monitor; monitor = monitor->m_next)
+    {
+      monitor->m_bytes_in_use -= static_cast<std::ptrdiff_t>(num_bytes);
+    } // end for
+
+    unlock(r.lock);
+  }
+}; // end temporary_memory_monitor_access
+
+
+} // end detail
+
+
+temporary_memory_monitor
+  ::temporary_memory_monitor()
+    : m_bytes_in_use(0),
+      m_peak_bytes_in_use(0),
+      m_total_bytes(0),
+      m_num_allocations(0),
+      m_next(0)
+{
+  thrust::detail::temporary_memory_monitor_access::add(*this);
+} // end temporary_memory_monitor::temporary_memory_monitor()
+
+
+temporary_memory_monitor
+  ::~temporary_memory_monitor()
+{
+  thrust::detail::temporary_memory_monitor_access::remove(*this);
+} // end temporary_memory_monitor::~temporary_memory_monitor()
+
+
+std::size_t temporary_memory_monitor
+  ::bytes_in_use() const
+{
+  return m_bytes_in_use > 0 ? static_cast<std::size_t>(m_bytes_in_use) : 0;
+} // end temporary_memory_monitor::bytes_in_use()
+
+
+std::size_t temporary_memory_monitor
+  ::peak_bytes_in_use() const
+{
+  return m_peak_bytes_in_use;
+} // end temporary_memory_monitor::peak_bytes_in_use()
+
+
+std::size_t temporary_memory_monitor
+  ::total_bytes() const
+{
+  return m_total_bytes;
+} // end temporary_memory_monitor::total_bytes()
+
+
+std::size_t temporary_memory_monitor
+  ::num_allocations() const
+{
+  return m_num_allocations;
+} // end temporary_memory_monitor::num_allocations()
+
+
+void temporary_memory_monitor
+  ::reset()
+{
+  typedef thrust::detail::temporary_memory_monitor_access access;
+
+  access::registry &r = access::get_registry();
+
+  access::lock(r.lock);
+
+  m_bytes_in_use = 0;
+  m_peak_bytes_in_use = 0;
+  m_total_bytes = 0;
+  m_num_allocations = 0;
+
+  access::unlock(r.lock);
+} // end temporary_memory_monitor::reset()
+
+
+} // end thrust
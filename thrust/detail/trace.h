@@ -0,0 +1,41 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+// THRUST_TRACE_ALGORITHM reports the call of an algorithm to the trace sink when the enclosing
+// function returns. THRUST_TRACE_TEMPORARY_ALLOCATION adds an allocation of temporary storage
+// to the innermost traced call. both expand to nothing unless THRUST_ENABLE_TRACING is defined
+#ifdef THRUST_ENABLE_TRACING
+
+#include <thrust/trace.h>
+
+#define THRUST_TRACE_ALGORITHM(name, system, first, last_or_n) \
+  thrust::trace::detail::algorithm_scope __thrust_trace_scope(name, thrust::trace::detail::system_name(system), thrust::trace::detail::num_elements(first, last_or_n))
+
+#define THRUST_TRACE_TEMPORARY_ALLOCATION(num_bytes) \
+  thrust::trace::detail::algorithm_scope::record_temporary_allocation(num_bytes)
+
+#else
+
+#define THRUST_TRACE_ALGORITHM(name, system, first, last_or_n)
+#define THRUST_TRACE_TEMPORARY_ALLOCATION(num_bytes)
+
+#endif // THRUST_ENABLE_TRACING
+
@@ -0,0 +1,367 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/detail/config.h>
+#include <thrust/trace.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/system/omp/detail/tag.h>
+#include <thrust/system/tbb/detail/tag.h>
+#include <thrust/system/cuda/detail/tag.h>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <time.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/time.h>
+#else
+#include <ctime>
+#endif
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+#define __THRUST_TRACE_THREAD_LOCAL thread_local
+#elif THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#define __THRUST_TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define __THRUST_TRACE_THREAD_LOCAL __thread
+#endif
+
+namespace thrust
+{
+namespace trace
+{
+namespace detail
+{
+
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+inline void lock(volatile long &l)
+{
+  while(_InterlockedExchange(&l, 1) != 0) {}
+}
+
+inline void unlock(volatile long &l)
+{
+  _InterlockedExchange(&l, 0);
+}
+
+inline long atomic_increment(volatile long &x)
+{
+  return _InterlockedIncrement(&x);
+}
+#else
+inline void lock(volatile long &l)
+{
+  while(__sync_lock_test_and_set(&l, 1) != 0) {}
+}
+
+inline void unlock(volatile long &l)
+{
+  __sync_lock_release(&l);
+}
+
+// returns the new value of x
+inline long atomic_increment(volatile long &x)
+{
+  return __sync_add_and_fetch(&x, 1);
+}
+#endif
+
+
+class scoped_lock
+{
+  public:
+    scoped_lock(volatile long &l) : m_lock(l) { lock(m_lock); }
+    ~scoped_lock() { unlock(m_lock); }
+
+  private:
+    volatile long &m_lock;
+};
+
+
+// seconds since an arbitrary point of time
+inline double now()
+{
+#if defined(__linux__)
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return static_cast<double>(t.tv_sec) + 1e-9 * static_cast<double>(t.tv_nsec);
+#elif defined(__unix__) || defined(__APPLE__)
+  timeval t;
+  gettimeofday(&t, 0);
+  return static_cast<double>(t.tv_sec) + 1e-6 * static_cast<double>(t.tv_usec);
+#else
+  return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+#endif
+}
+
+
+// numbers threads in the order they first report an event
+inline std::size_t thread_id()
+{
+  static volatile long num_threads = 0;
+  static __THRUST_TRACE_THREAD_LOCAL long id = 0;
+
+  if(id == 0)
+  {
+    id = atomic_increment(num_threads);
+  }
+
+  return static_cast<std::size_t>(id);
+}
+
+
+inline sink *&current_sink()
+{
+  static sink *result = 0;
+  return result;
+}
+
+
+// names the system an algorithm was dispatched to. other systems convert to any_system
+// and are unknown; systems derived from the known ones are named after their base
+struct any_system
+{
+  template<typename System> any_system(System) {}
+};
+
+inline const char *system_name(any_system)                  { return "unknown"; }
+inline const char *system_name(thrust::system::cpp::tag)  { return "cpp"; }
+inline const char *system_name(thrust::system::omp::tag)  { return "omp"; }
+inline const char *system_name(thrust::system::tbb::tag)  { return "tbb"; }
+inline const char *system_name(thrust::system::cuda::tag) { return "cuda"; }
+
+
+template<typename Iterator>
+  std::size_t num_elements(Iterator first, Iterator last, thrust::detail::true_type)
+{
+  return static_cast<std::size_t>(last - first);
+}
+
+template<typename Iterator>
+  std::size_t num_elements(Iterator, Iterator, thrust::detail::false_type)
+{
+  return 0;
+}
+
+// the number of elements of [first, last), if that is cheap to learn and does not consume
+// the range, or 0
+template<typename Iterator>
+  std::size_t num_elements(Iterator first, Iterator last)
+{
+  typedef typename thrust::detail::is_convertible<
+    typename thrust::iterator_traversal<Iterator>::type,
+    thrust::random_access_traversal_tag
+  >::type is_random_access;
+
+  return num_elements(first, last, is_random_access());
+}
+
+// the number of elements of [first, first + n)
+template<typename Iterator, typename Size>
+  std::size_t num_elements(Iterator, Size n)
+{
+  return static_cast<std::size_t>(n);
+}
+
+
+// reports the call of an algorithm to the current sink when it returns
+class algorithm_scope
+{
+  public:
+    algorithm_scope(const char *algorithm, const char *system, std::size_t num_elements)
+      : m_enclosing(current())
+    {
+      m_event.algorithm       = algorithm;
+      m_event.system          = system;
+      m_event.num_elements    = num_elements;
+      m_event.temporary_bytes = 0;
+      m_event.thread          = thread_id();
+      m_event.depth           = m_enclosing ? m_enclosing->m_event.depth + 1 : 0;
+
+      current() = this;
+
+      m_event.begin = now();
+    }
+
+    ~algorithm_scope()
+    {
+      m_event.duration = now() - m_event.begin;
+
+      current() = m_enclosing;
+
+      if(m_enclosing)
+      {
+        m_enclosing->m_event.temporary_bytes += m_event.temporary_bytes;
+      }
+
+      if(sink *s = current_sink())
+      {
+        s->record(m_event);
+      }
+    }
+
+    // the innermost call traced on the calling thread, or null
+    static algorithm_scope *&current()
+    {
+      static __THRUST_TRACE_THREAD_LOCAL algorithm_scope *result = 0;
+      return result;
+    }
+
+    static void record_temporary_allocation(std::size_t num_bytes)
+    {
+      if(algorithm_scope *scope = current())
+      {
+        scope->m_event.temporary_bytes += num_bytes;
+      }
+    }
+
+  private:
+    algorithm_scope *m_enclosing;
+    event m_event;
+
+    // non-copyable
+    algorithm_scope(const algorithm_scope &);
+    algorithm_scope &operator=(const algorithm_scope &);
+};
+
+
+} // end detail
+
+
+sink *set_sink(sink *s)
+{
+  sink *result = detail::current_sink();
+  detail::current_sink() = s;
+  return result;
+} // end set_sink()
+
+
+sink *get_sink()
+{
+  return detail::current_sink();
+} // end get_sink()
+
+
+counting_sink
+  ::counting_sink()
+    : m_lock(0)
+{
+} // end counting_sink::counting_sink()
+
+
+void counting_sink
+  ::record(const event &e)
+{
+  detail::scoped_lock guard(m_lock);
+
+  totals &t = m_totals[e.algorithm];
+
+  t.num_calls       += 1;
+  t.num_elements    += e.num_elements;
+  t.seconds         += e.duration;
+  t.temporary_bytes += e.temporary_bytes;
+} // end counting_sink::record()
+
+
+counting_sink::totals_map counting_sink
+  ::get_totals() const
+{
+  detail::scoped_lock guard(m_lock);
+
+  return m_totals;
+} // end counting_sink::get_totals()
+
+
+void counting_sink
+  ::write(std::ostream &os) const
+{
+  totals_map t = get_totals();
+
+  std::ios_base::fmtflags flags = os.flags();
+
+  os << std::left << std::setw(32) << "algorithm"
+     << std::right << std::setw(12) << "calls"
+     << std::setw(16) << "elements"
+     << std::setw(14) << "seconds"
+     << std::setw(18) << "temporary bytes" << std::endl;
+
+  for(totals_map::const_iterator i = t.begin(); i != t.end(); ++i)
+  {
+    os << std::left << std::setw(32) << i->first
+       << std::right << std::setw(12) << i->second.num_calls
+       << std::setw(16) << i->second.num_elements
+       << std::setw(14) << i->second.seconds
+       << std::setw(18) << i->second.temporary_bytes << std::endl;
+  }
+
+  os.flags(flags);
+} // end counting_sink::write()
+
+
+chrome_trace_sink
+  ::chrome_trace_sink(std::ostream &os)
+    : m_lock(0), m_os(os), m_first(true)
+{
+  m_os << "[" << std::endl;
+} // end chrome_trace_sink::chrome_trace_sink()
+
+
+chrome_trace_sink
+  ::~chrome_trace_sink()
+{
+  m_os << std::endl << "]" << std::endl;
+} // end chrome_trace_sink::~chrome_trace_sink()
+
+
+void chrome_trace_sink
+  ::record(const event &e)
+{
+  detail::scoped_lock guard(m_lock);
+
+  if(!m_first)
+  {
+    m_os << "," << std::endl;
+  }
+
+  m_first = false;
+
+  std::ios_base::fmtflags flags = m_os.flags();
+  std::streamsize precision = m_os.precision();
+
+  // times are in microseconds
+  m_os << std::fixed << std::setprecision(3)
+       << "{\"name\":\"" << e.algorithm << "\",\"cat\":\"" << e.system << "\",\"ph\":\"X\""
+       << ",\"ts\":" << 1e6 * e.begin << ",\"dur\":" << 1e6 * e.duration
+       << ",\"pid\":1,\"tid\":" << e.thread
+       << ",\"args\":{\"elements\":" << e.num_elements << ",\"temporary_bytes\":" << e.temporary_bytes << "}}";
+
+  m_os.flags(flags);
+  m_os.precision(precision);
+} // end chrome_trace_sink::record()
+
+
+} // end trace
+} // end thrust
+
+#undef __THRUST_TRACE_THREAD_LOCAL
+
@@ -22,6 +22,7 @@
 #include <thrust/transform.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/transform.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -42,6 +43,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("transform", select_system(system1(),system2()), first, last);
+
   return transform(select_system(system1(),system2()), first, last, result, op);
 } // end transform()
 
@@ -63,6 +66,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type system2;
   typedef typename thrust::iterator_system<OutputIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("transform", select_system(system1(),system2(),system3()), first1, last1);
+
   return transform(select_system(system1(),system2(),system3()), first1, last1, first2, result, op);
 } // end transform()
 
@@ -83,6 +88,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type   system1;
   typedef typename thrust::iterator_system<ForwardIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("transform_if", select_system(system1(),system2()), first, last);
+
   return transform_if(select_system(system1(),system2()), first, last, result, unary_op, pred);
 } // end transform_if()
 
@@ -106,6 +113,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator2>::type  system2;
   typedef typename thrust::iterator_system<ForwardIterator>::type system3;
 
+  THRUST_TRACE_ALGORITHM("transform_if", select_system(system1(),system2(),system3()), first, last);
+
   return transform_if(select_system(system1(),system2(),system3()), first, last, stencil, result, unary_op, pred);
 } // end transform_if()
 
@@ -131,6 +140,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<InputIterator3>::type  system3;
   typedef typename thrust::iterator_system<ForwardIterator>::type system4;
 
+  THRUST_TRACE_ALGORITHM("transform_if", select_system(system1(),system2(),system3(),system4()), first1, last1);
+
   return transform_if(select_system(system1(),system2(),system3(),system4()), first1, last1, first2, stencil, result, binary_op, pred);
 } // end transform_if()
 
@@ -22,6 +22,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/transform_reduce.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -43,6 +44,8 @@ template<typename InputIterator,
 
   typedef typename thrust::iterator_system<InputIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("transform_reduce", select_system(system()), first, last);
+
   return transform_reduce(select_system(system()), first, last, unary_op, init, binary_op);
 } // end transform_reduce()
 
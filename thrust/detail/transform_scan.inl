@@ -22,6 +22,7 @@
 #include <thrust/scan.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/transform_scan.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -44,6 +45,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("transform_inclusive_scan", select_system(system1(),system2()), first, last);
+
   return transform_inclusive_scan(select_system(system1(),system2()), first, last, result, unary_op, binary_op);
 } // end transform_inclusive_scan()
 
@@ -66,6 +69,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("transform_exclusive_scan", select_system(system1(),system2()), first, last);
+
   return transform_exclusive_scan(select_system(system1(),system2()), first, last, result, unary_op, init, binary_op);
 } // end transform_exclusive_scan()
 
@@ -22,6 +22,7 @@
 #include <thrust/uninitialized_copy.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/uninitialized_copy.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -41,6 +42,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type   system1;
   typedef typename thrust::iterator_system<ForwardIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("uninitialized_copy", select_system(system1(),system2()), first, last);
+
   return uninitialized_copy(select_system(system1(),system2()), first, last, result);
 } // end uninitialized_copy()
 
@@ -58,6 +61,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type   system1;
   typedef typename thrust::iterator_system<ForwardIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("uninitialized_copy_n", select_system(system1(),system2()), first, n);
+
   return uninitialized_copy_n(select_system(system1(),system2()), first, n, result);
 } // end uninitialized_copy_n()
 
@@ -22,6 +22,7 @@
 #include <thrust/uninitialized_fill.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/uninitialized_fill.h>
 #include <thrust/detail/adl_helper.h>
 
@@ -39,6 +40,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("uninitialized_fill", select_system(system()), first, last);
+
   uninitialized_fill(select_system(system()), first, last, x);
 } // end uninitialized_fill()
 
@@ -54,6 +57,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("uninitialized_fill_n", select_system(system()), first, n);
+
   return uninitialized_fill_n(select_system(system()), first, n, x);
 } // end uninitialized_fill_n()
 
@@ -23,6 +23,7 @@
 #include <thrust/unique.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/detail/trace.h>
 #include <thrust/system/detail/generic/unique.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
 #include <thrust/detail/adl_helper.h>
@@ -39,6 +40,8 @@ template<typename ForwardIterator>
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("unique", select_system(system()), first, last);
+
   return unique(select_system(system()), first, last);
 } // end unique()
 
@@ -54,6 +57,8 @@ template<typename ForwardIterator,
 
   typedef typename thrust::iterator_system<ForwardIterator>::type system;
 
+  THRUST_TRACE_ALGORITHM("unique", select_system(system()), first, last);
+
   return unique(select_system(system()), first, last, binary_pred);
 } // end unique()
 
@@ -70,6 +75,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("unique_copy", select_system(system1(),system2()), first, last);
+
   return unique_copy(select_system(system1(),system2()), first, last, output);
 } // end unique_copy()
 
@@ -88,6 +95,8 @@ template<typename InputIterator,
   typedef typename thrust::iterator_system<InputIterator>::type  system1;
   typedef typename thrust::iterator_system<OutputIterator>::type system2;
 
+  THRUST_TRACE_ALGORITHM("unique_copy", select_system(system1(),system2()), first, last);
+
   return unique_copy(select_system(system1(),system2()), first, last, output, binary_pred);
 } // end unique_copy()
 
@@ -105,6 +114,8 @@ template<typename ForwardIterator1,
   typedef typename thrust::iterator_system<ForwardIterator1>::type system1;
   typedef typename thrust::iterator_system<ForwardIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("unique_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return unique_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first);
 } // end unique_by_key()
 
@@ -124,6 +135,8 @@ template<typename ForwardIterator1,
   typedef typename thrust::iterator_system<ForwardIterator1>::type system1;
   typedef typename thrust::iterator_system<ForwardIterator2>::type system2;
 
+  THRUST_TRACE_ALGORITHM("unique_by_key", select_system(system1(),system2()), keys_first, keys_last);
+
   return unique_by_key(select_system(system1(),system2()), keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
 
@@ -147,6 +160,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<OutputIterator1>::type system3;
   typedef typename thrust::iterator_system<OutputIterator2>::type system4;
 
+  THRUST_TRACE_ALGORITHM("unique_by_key_copy", select_system(system1(),system2(),system3(),system4()), keys_first, keys_last);
+
   return unique_by_key_copy(select_system(system1(),system2(),system3(),system4()), keys_first, keys_last, values_first, keys_output, values_output);
 } // end unique_by_key_copy()
 
@@ -172,6 +187,8 @@ template<typename InputIterator1,
   typedef typename thrust::iterator_system<OutputIterator1>::type system3;
   typedef typename thrust::iterator_system<OutputIterator2>::type system4;
 
+  THRUST_TRACE_ALGORITHM("unique_by_key_copy", select_system(system1(),system2(),system3(),system4()), keys_first, keys_last);
+
   return unique_by_key_copy(select_system(system1(),system2(),system3(),system4()), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end unique_by_key_copy()
 
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <thrust/detail/config.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -32,6 +33,40 @@
 namespace thrust
 {
 
+/*! \addtogroup container_classes Container Classes
+ *  \{
+ */
+
+/*! \p default_init_t is the type of \p default_init, which selects the constructor
+ *  and \p resize of a vector which default-initialize new elements.
+ */
+struct default_init_t {};
+
+/*! Passed to the constructor or \p resize of a vector, \p default_init requests that
+ *  new elements be default-initialized rather than copied from an exemplar. Elements of
+ *  types with trivial constructors, such as \c int or \c float, are left uninitialized,
+ *  so that storage which is about to be overwritten costs nothing until it is written.
+ */
+const default_init_t default_init = default_init_t();
+
+/*! \p first_touch_t is the type of \p first_touch, which selects the constructor
+ *  and \p resize of a vector which default-initialize new elements and map their memory.
+ */
+struct first_touch_t {};
+
+/*! Passed to the constructor or \p resize of a vector, \p first_touch requests that new
+ *  elements be default-initialized as with \p default_init, and that the pages of new
+ *  elements in memory of the host be placed before returning by the system which owns it.
+ *  The \p omp and \p tbb systems touch each page in parallel, from the thread to which
+ *  their loops over the vector assign it, so that on machines with several memory nodes
+ *  the page is placed near that thread, unless their \p page_placement policy directs
+ *  otherwise.
+ */
+const first_touch_t first_touch = first_touch_t();
+
+/*! \}
+ */
+
 namespace detail
 {
 
@@ -69,6 +104,10 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const value_type &value = value_type());
 
+    vector_base(size_type n, default_init_t);
+
+    vector_base(size_type n, first_touch_t);
+
     /*! Copy constructor copies from an exemplar vector_base.
      *  \param v The vector_base to copy.
      */
@@ -79,6 +118,12 @@ template<typename T, typename Alloc>
      */
     vector_base &operator=(const vector_base &v);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    vector_base(vector_base &&v) noexcept;
+
+    vector_base &operator=(vector_base &&v) noexcept;
+#endif
+
     /*! Copy constructor copies from an exemplar vector_base with different
      *  type.
      *  \param v The vector_base to copy.
@@ -134,6 +179,10 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    void resize(size_type new_size, default_init_t);
+
+    void resize(size_type new_size, first_touch_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     size_type size(void) const;
@@ -304,6 +353,14 @@ template<typename T, typename Alloc>
      */
     void push_back(const value_type &x);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+
+    template<typename... Args>
+    iterator emplace(iterator position, Args&&... args);
+#endif
+
     /*! This method erases the last element of this vector_base, invalidating
      *  all iterators and references to it.
      */
@@ -407,6 +464,14 @@ template<typename T, typename Alloc>
 
     void fill_init(size_type n, const T &x);
 
+    // these methods default-construct n new elements at the end, as selected by the tag
+    template<typename InitTag>
+      void default_append(size_type n, InitTag init);
+
+    void default_construct(iterator first, size_type n, default_init_t);
+
+    void default_construct(iterator first, size_type n, first_touch_t);
+
     // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
     template<typename InputIteratorOrIntegralType>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType first, InputIteratorOrIntegralType last, false_type);
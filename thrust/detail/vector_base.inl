@@ -28,10 +28,12 @@
 #include <thrust/distance.h>
 #include <thrust/advance.h>
 #include <thrust/detail/destroy.h>
+#include <thrust/detail/default_construct.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/minmax.h>
 
 #include <stdexcept>
+#include <utility>
 
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -62,6 +64,24 @@ template<typename T, typename Alloc>
   fill_init(n,value);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, default_init_t init)
+      :m_storage(),
+       m_size(0)
+{
+  default_append(n, init);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, first_touch_t init)
+      :m_storage(),
+       m_size(0)
+{
+  default_append(n, init);
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(const vector_base &v)
@@ -84,6 +104,34 @@ template<typename T, typename Alloc>
   return *this;
 } // end vector_base::operator=()
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(vector_base &&v) noexcept
+      :m_storage(std::move(v.m_storage)),
+       m_size(v.m_size)
+{
+  v.m_size = 0;
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc> &
+    vector_base<T,Alloc>
+      ::operator=(vector_base &&v) noexcept
+{
+  if(this != &v)
+  {
+    // release our elements and storage before taking v's
+    thrust::detail::destroy(begin(), end());
+    m_storage = std::move(v.m_storage);
+    m_size = v.m_size;
+    v.m_size = 0;
+  } // end if
+
+  return *this;
+} // end vector_base::operator=()
+#endif
+
 template<typename T, typename Alloc>
   template<typename OtherT, typename OtherAlloc>
     vector_base<T,Alloc>
@@ -149,6 +197,71 @@ template<typename T, typename Alloc>
   } // end if
 } // end vector_base::fill_init()
 
+template<typename T, typename Alloc>
+  template<typename InitTag>
+    void vector_base<T,Alloc>
+      ::default_append(size_type n, InitTag init)
+{
+  if(n == 0) return;
+
+  if(capacity() - size() < n)
+  {
+    const size_type old_size = size();
+
+    // compute the new capacity after the allocation
+    size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, n);
+
+    // allocate exponentially larger new storage
+    new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
+
+    // do not exceed maximum storage
+    new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+
+    storage_type new_storage(new_capacity);
+
+    // record how many constructors we invoke in the try block below
+    iterator new_end = new_storage.begin();
+
+    try
+    {
+      new_end = cross_system_uninitialized_copy(begin(), end(), new_storage.begin(), has_trivial_copy_constructor());
+    } // end try
+    catch(...)
+    {
+      // something went wrong, so destroy & deallocate the new storage
+      thrust::detail::destroy(new_storage.begin(), new_end);
+      new_storage.deallocate();
+
+      // rethrow
+      throw;
+    } // end catch
+
+    // call destructors on the elements in the old storage
+    thrust::detail::destroy(begin(), end());
+
+    // record the vector's new state
+    m_storage.swap(new_storage);
+  } // end if
+
+  default_construct(end(), n, init);
+
+  m_size += n;
+} // end vector_base::default_append()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::default_construct(iterator first, size_type n, default_init_t)
+{
+  thrust::detail::default_construct_n(first.base(), n);
+} // end vector_base::default_construct()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::default_construct(iterator first, size_type n, first_touch_t)
+{
+  thrust::detail::first_touch_construct_n(first.base(), n);
+} // end vector_base::default_construct()
+
 template<typename T, typename Alloc>
   template<typename InputIterator>
     void vector_base<T,Alloc>
@@ -224,6 +337,38 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, default_init_t init)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    default_append(new_size - size(), init);
+  } // end else
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, first_touch_t init)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    default_append(new_size - size(), init);
+  } // end else
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   typename vector_base<T,Alloc>::size_type
     vector_base<T,Alloc>
@@ -464,6 +609,27 @@ template<typename T, typename Alloc>
   insert(end(), x);
 } // end vector_base::push_back()
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template<typename T, typename Alloc>
+  template<typename... Args>
+    void vector_base<T,Alloc>
+      ::emplace_back(Args&&... args)
+{
+  // the element may reside in memory the host cannot construct into,
+  // so construct it here and copy it into place
+  push_back(value_type(std::forward<Args>(args)...));
+} // end vector_base::emplace_back()
+
+template<typename T, typename Alloc>
+  template<typename... Args>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::emplace(iterator position, Args&&... args)
+{
+  return insert(position, value_type(std::forward<Args>(args)...));
+} // end vector_base::emplace()
+#endif
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::pop_back(void)
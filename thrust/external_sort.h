@@ -0,0 +1,257 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file external_sort.h
+ *  \brief Functions for sorting sequences of records too large to fit in memory
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef>
+#include <iosfwd>
+
+namespace thrust
+{
+
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p external_sort reads a sequence of objects of type \p T from \p input, sorts them
+ *  into ascending order, and writes the result to \p output, using no more than
+ *  about \p memory_bytes of memory, however long the sequence is.
+ *
+ *  The sequence is read in chunks which fit in \p memory_bytes. Each chunk is sorted by
+ *  \p stable_sort on the host system, and, unless it is the whole sequence, written as a
+ *  sorted run to a temporary file created by \c std::tmpfile. The runs are then merged,
+ *  in several passes if there are too many to merge at once. While the runs are merged, the
+ *  next block of each is read ahead of its use in the background, where the system supports it.
+ *
+ *  Objects are read and written as their raw bytes, so \p T must be trivially copyable.
+ *  Trailing bytes of \p input which do not make up a whole object are ignored.
+ *  \p external_sort is stable: equivalent objects keep their relative order.
+ *
+ *  This version of \p external_sort compares objects using \c operator<.
+ *
+ *  \param input The stream to read from, opened in binary mode.
+ *  \param output The stream to write to, opened in binary mode.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \throw system_error If reading, writing, or creating a temporary file fails.
+ *
+ *  \tparam T is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>,
+ *          and must be specified explicitly.
+ *
+ *  The following code snippet demonstrates how to sort a file of integers which does not fit
+ *  in memory, using 1 GB.
+ *
+ *  \code
+ *  #include <thrust/external_sort.h>
+ *  ...
+ *  thrust::external_sort<int>("keys.bin", "sorted_keys.bin", std::size_t(1) << 30);
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ *  \see \p external_sort_by_key
+ */
+template<typename T>
+  void external_sort(std::istream &input,
+                     std::ostream &output,
+                     std::size_t memory_bytes);
+
+
+/*! \p external_sort reads a sequence of objects of type \p T from \p input, sorts them
+ *  into ascending order, and writes the result to \p output, using no more than
+ *  about \p memory_bytes of memory.
+ *
+ *  This version of \p external_sort compares objects using a function object \p comp.
+ *
+ *  \param input The stream to read from, opened in binary mode.
+ *  \param output The stream to write to, opened in binary mode.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \param comp Comparison operator.
+ *  \throw system_error If reading, writing, or creating a temporary file fails.
+ *
+ *  \tparam T must be specified explicitly.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>,
+ *          and \p T is convertible to \p StrictWeakOrdering's \c first_argument_type and \c second_argument_type.
+ *
+ *  \see \p external_sort
+ */
+template<typename T, typename StrictWeakOrdering>
+  void external_sort(std::istream &input,
+                     std::ostream &output,
+                     std::size_t memory_bytes,
+                     StrictWeakOrdering comp);
+
+
+/*! \p external_sort sorts the objects of type \p T stored in the file named \p input_filename
+ *  into ascending order and stores the result in the file named \p output_filename, which is
+ *  created or replaced.
+ *
+ *  This version of \p external_sort compares objects using \c operator<.
+ *
+ *  \param input_filename The name of the file to read from.
+ *  \param output_filename The name of the file to write to. It must differ from \p input_filename.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \throw system_error If either file could not be opened, or reading, writing, or creating
+ *         a temporary file fails.
+ *
+ *  \see \p external_sort
+ */
+template<typename T>
+  void external_sort(const char *input_filename,
+                     const char *output_filename,
+                     std::size_t memory_bytes);
+
+
+/*! \p external_sort sorts the objects of type \p T stored in the file named \p input_filename
+ *  and stores the result in the file named \p output_filename, which is created or replaced.
+ *
+ *  This version of \p external_sort compares objects using a function object \p comp.
+ *
+ *  \param input_filename The name of the file to read from.
+ *  \param output_filename The name of the file to write to. It must differ from \p input_filename.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \param comp Comparison operator.
+ *  \throw system_error If either file could not be opened, or reading, writing, or creating
+ *         a temporary file fails.
+ *
+ *  \see \p external_sort
+ */
+template<typename T, typename StrictWeakOrdering>
+  void external_sort(const char *input_filename,
+                     const char *output_filename,
+                     std::size_t memory_bytes,
+                     StrictWeakOrdering comp);
+
+
+/*! \p external_sort_by_key performs a key-value sort of sequences too large to fit in memory.
+ *  It reads a sequence of keys of type \p Key from \p keys_input and a sequence of values of
+ *  type \p Value from \p values_input, sorts the keys into ascending order, and writes them
+ *  to \p keys_output and their values, in the same order, to \p values_output.
+ *
+ *  Keys and values are sorted as \p external_sort sorts objects, using no more than about
+ *  \p memory_bytes of memory for both. \p external_sort_by_key is stable.
+ *
+ *  This version of \p external_sort_by_key compares keys using \c operator<.
+ *
+ *  \param keys_input The stream to read keys from, opened in binary mode.
+ *  \param values_input The stream to read values from, opened in binary mode.
+ *  \param keys_output The stream to write keys to, opened in binary mode.
+ *  \param values_output The stream to write values to, opened in binary mode.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \throw system_error If the inputs hold different numbers of keys and values, or reading,
+ *         writing, or creating a temporary file fails.
+ *
+ *  \tparam Key is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>,
+ *          and must be specified explicitly.
+ *  \tparam Value must be specified explicitly.
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p external_sort
+ */
+template<typename Key, typename Value>
+  void external_sort_by_key(std::istream &keys_input,
+                            std::istream &values_input,
+                            std::ostream &keys_output,
+                            std::ostream &values_output,
+                            std::size_t memory_bytes);
+
+
+/*! \p external_sort_by_key performs a key-value sort of sequences too large to fit in memory.
+ *
+ *  This version of \p external_sort_by_key compares keys using a function object \p comp.
+ *
+ *  \param keys_input The stream to read keys from, opened in binary mode.
+ *  \param values_input The stream to read values from, opened in binary mode.
+ *  \param keys_output The stream to write keys to, opened in binary mode.
+ *  \param values_output The stream to write values to, opened in binary mode.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \param comp Comparison operator.
+ *  \throw system_error If the inputs hold different numbers of keys and values, or reading,
+ *         writing, or creating a temporary file fails.
+ *
+ *  \see \p external_sort_by_key
+ */
+template<typename Key, typename Value, typename StrictWeakOrdering>
+  void external_sort_by_key(std::istream &keys_input,
+                            std::istream &values_input,
+                            std::ostream &keys_output,
+                            std::ostream &values_output,
+                            std::size_t memory_bytes,
+                            StrictWeakOrdering comp);
+
+
+/*! \p external_sort_by_key performs a key-value sort of the keys of type \p Key stored in the
+ *  file named \p keys_input_filename and the values of type \p Value stored in the file named
+ *  \p values_input_filename, and stores the results in the files named \p keys_output_filename
+ *  and \p values_output_filename, which are created or replaced.
+ *
+ *  This version of \p external_sort_by_key compares keys using \c operator<.
+ *
+ *  \param keys_input_filename The name of the file to read keys from.
+ *  \param values_input_filename The name of the file to read values from.
+ *  \param keys_output_filename The name of the file to write keys to.
+ *  \param values_output_filename The name of the file to write values to.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \throw system_error If a file could not be opened, the inputs hold different numbers of
+ *         keys and values, or reading, writing, or creating a temporary file fails.
+ *
+ *  \see \p external_sort_by_key
+ */
+template<typename Key, typename Value>
+  void external_sort_by_key(const char *keys_input_filename,
+                            const char *values_input_filename,
+                            const char *keys_output_filename,
+                            const char *values_output_filename,
+                            std::size_t memory_bytes);
+
+
+/*! \p external_sort_by_key performs a key-value sort of the keys and values stored in two files.
+ *
+ *  This version of \p external_sort_by_key compares keys using a function object \p comp.
+ *
+ *  \param keys_input_filename The name of the file to read keys from.
+ *  \param values_input_filename The name of the file to read values from.
+ *  \param keys_output_filename The name of the file to write keys to.
+ *  \param values_output_filename The name of the file to write values to.
+ *  \param memory_bytes The amount of memory to sort with.
+ *  \param comp Comparison operator.
+ *  \throw system_error If a file could not be opened, the inputs hold different numbers of
+ *         keys and values, or reading, writing, or creating a temporary file fails.
+ *
+ *  \see \p external_sort_by_key
+ */
+template<typename Key, typename Value, typename StrictWeakOrdering>
+  void external_sort_by_key(const char *keys_input_filename,
+                            const char *values_input_filename,
+                            const char *keys_output_filename,
+                            const char *values_output_filename,
+                            std::size_t memory_bytes,
+                            StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+
+} // end thrust
+
+#include <thrust/detail/external_sort.inl>
+
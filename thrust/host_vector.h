@@ -25,6 +25,7 @@
 #include <memory>
 #include <thrust/detail/vector_base.h>
 #include <vector>
+#include <utility>
 
 namespace thrust
 {
@@ -76,6 +77,23 @@ template<typename T, typename Alloc = std::allocator<T> >
     explicit host_vector(size_type n, const value_type &value = value_type())
       :Parent(n,value) {}
 
+    /*! This constructor creates a \p host_vector with \p n default-initialized
+     *  elements, which are left uninitialized if their type has a trivial constructor.
+     *  \param n The number of elements to initially create.
+     */
+    __host__
+    host_vector(size_type n, default_init_t)
+      :Parent(n,default_init) {}
+
+    /*! This constructor creates a \p host_vector with \p n default-initialized
+     *  elements, whose memory is first touched in parallel if it resides on the host.
+     *  \param n The number of elements to initially create.
+     *  \see first_touch
+     */
+    __host__
+    host_vector(size_type n, first_touch_t)
+      :Parent(n,first_touch) {}
+
     /*! Copy constructor copies from an exemplar \p host_vector.
      *  \param v The \p host_vector to copy.
      */
@@ -83,6 +101,16 @@ template<typename T, typename Alloc = std::allocator<T> >
     host_vector(const host_vector &v)
       :Parent(v) {}
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move constructor takes the elements of another \p host_vector, leaving it empty.
+     *  No elements are copied.
+     *  \param v The \p host_vector to move from.
+     */
+    __host__
+    host_vector(host_vector &&v) noexcept
+      :Parent(std::move(v)) {}
+#endif
+
     /*! Assign operator copies from an exemplar \p host_vector.
      *  \param v The \p host_vector to copy.
      */
@@ -90,6 +118,16 @@ template<typename T, typename Alloc = std::allocator<T> >
     host_vector &operator=(const host_vector &v)
     { Parent::operator=(v); return *this; }
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move assign operator releases the elements of this \p host_vector and takes
+     *  those of another, leaving it empty. No elements are copied.
+     *  \param v The \p host_vector to move from.
+     */
+    __host__
+    host_vector &operator=(host_vector &&v) noexcept
+    { Parent::operator=(std::move(v)); return *this; }
+#endif
+
     /*! Copy constructor copies from an exemplar \p host_vector with different type.
      *  \param v The \p host_vector to copy.
      */
@@ -153,6 +191,23 @@ template<typename T, typename Alloc = std::allocator<T> >
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements, default-initializing
+     *         new elements. New elements of types with trivial constructors are left
+     *         uninitialized.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     */
+    void resize(size_type new_size, default_init_t);
+
+    /*! \brief Resizes this vector to the specified number of elements, default-initializing
+     *         new elements and first touching their memory in parallel if it resides on
+     *         the host.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *  \see first_touch
+     */
+    void resize(size_type new_size, first_touch_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size(void) const;
@@ -323,6 +378,22 @@ template<typename T, typename Alloc = std::allocator<T> >
      */
     void push_back(const value_type &x);
 
+    /*! This method appends an element constructed from the given arguments
+     *  to the end of this vector. It is available in C++11 and later.
+     *  \param args The arguments with which to construct the element.
+     */
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+
+    /*! This method inserts an element constructed from the given arguments
+     *  before the given position. It is available in C++11 and later.
+     *  \param position The insertion position.
+     *  \param args The arguments with which to construct the element.
+     *  \return An iterator pointing to the new element.
+     */
+    template<typename... Args>
+    iterator emplace(iterator position, Args&&... args);
+
     /*! This method erases the last element of this vector, invalidating
      *  all iterators and references to it.
      */
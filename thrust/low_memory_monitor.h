@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file low_memory_monitor.h
+ *  \brief Reports whether algorithms ran short of temporary storage
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef> // for std::size_t
+
+namespace thrust
+{
+
+namespace detail
+{
+
+struct low_memory_monitor_access;
+
+} // end detail
+
+/*! \addtogroup memory_management Memory Management
+ *  \addtogroup memory_management_classes Memory Management Classes
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! \p low_memory_monitor observes how the algorithms dispatched by the calling thread cope
+ *  with a shortage of temporary storage.
+ *
+ *  When the temporary storage an algorithm requests is not available, the algorithm
+ *  throws \p std::bad_alloc, unless it has a slower way to finish with less storage.
+ *  The \p cpp, \p omp, and \p tbb systems' \p sort, \p stable_sort, and their \p by_key
+ *  variants retry their merges with a smaller buffer, and then with none, merging in place
+ *  by rotation. Their \p stable_partition partitions pieces which fit in a smaller buffer,
+ *  or none, and rotates the pieces into place. \p reduce_by_key processes its input in
+ *  chunks which fit in the storage available. Merges and set operations on these systems
+ *  need no temporary storage at all.
+ *
+ *  While a \p low_memory_monitor exists, it records the most degraded \p mode any such
+ *  algorithm ran in, and how many times an algorithm fell back to a less demanding mode.
+ *
+ *  The following code snippet demonstrates how to learn whether a sort had all the
+ *  temporary storage it wanted.
+ *
+ *  \code
+ *  #include <thrust/low_memory_monitor.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<int> keys = ...
+ *
+ *  thrust::low_memory_monitor monitor;
+ *
+ *  thrust::stable_sort(keys.begin(), keys.end());
+ *
+ *  if(monitor.worst_mode() != thrust::low_memory_monitor::full_buffer)
+ *  {
+ *    // the sort was slowed by a shortage of memory
+ *  }
+ *  \endcode
+ *
+ *  \p low_memory_monitors may be nested. A fallback is recorded by every \p low_memory_monitor
+ *  which exists on the thread where it happens. A \p low_memory_monitor must be destroyed by the
+ *  thread which created it, in the reverse order of creation.
+ *
+ *  \see scratch_arena
+ */
+class low_memory_monitor
+{
+  public:
+    /*! \p mode describes how much temporary storage an algorithm ran with, in order of
+     *  increasing degradation.
+     */
+    enum mode
+    {
+      /*! The algorithm had all the temporary storage it requested.
+       */
+      full_buffer,
+
+      /*! The algorithm ran with less temporary storage than it requested, in more passes
+       *  or in chunks.
+       */
+      reduced_buffer,
+
+      /*! The algorithm ran without temporary storage, in place.
+       */
+      no_buffer
+    };
+
+    /*! This constructor begins observing the algorithms dispatched by the calling thread.
+     */
+    inline low_memory_monitor();
+
+    /*! The destructor stops observing.
+     */
+    inline ~low_memory_monitor();
+
+    /*! \return The most degraded \p mode an algorithm ran in while this \p low_memory_monitor
+     *          existed, or \p full_buffer if none fell back.
+     */
+    inline mode worst_mode() const;
+
+    /*! \return The number of times an algorithm made do with less temporary storage than it
+     *          requested while this \p low_memory_monitor existed.
+     */
+    inline std::size_t num_fallbacks() const;
+
+  private:
+    friend struct thrust::detail::low_memory_monitor_access;
+
+    // low_memory_monitors are bound by address, so they may not be copied
+    low_memory_monitor(const low_memory_monitor &);
+    low_memory_monitor &operator=(const low_memory_monitor &);
+
+    mode m_worst_mode;
+    std::size_t m_num_fallbacks;
+    bool m_propagates;
+    low_memory_monitor *m_enclosing;
+}; // end low_memory_monitor
+
+/*! \}
+ */
+
+} // end thrust
+
+#include <thrust/detail/low_memory_monitor.inl>
+
@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file mapped_vector.h
+ *  \brief A fixed-size array of elements which reside in a file mapped into
+ *         the memory of the host
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/detail/host_system_tag.h>
+#include <thrust/iterator/detail/tagged_iterator.h>
+#include <cstddef>
+
+namespace thrust
+{
+
+/*! \addtogroup container_classes Container Classes
+ *  \addtogroup host_containers Host Containers
+ *  \ingroup container_classes
+ *  \{
+ */
+
+/*! A \p mapped_vector is a container whose elements are the contents of a file mapped
+ *  into the memory of the host. Its iterators are random access, so that any algorithm may
+ *  be dispatched on the file directly: the operating system reads each page of the file when
+ *  it is first accessed, and writes modified pages back, so files larger than the memory of
+ *  the host may be sorted, scanned, or reduced without explicit I/O.
+ *
+ *  The number of elements of a \p mapped_vector is the size of the file divided by
+ *  <tt>sizeof(T)</tt>, and does not change over its lifetime. \p T must be trivially
+ *  copyable, since its objects are stored as the raw bytes of the file.
+ *
+ *  Algorithms are dispatched on a \p mapped_vector's iterators to \p System, which is the
+ *  host system by default.
+ *
+ *  The following code snippet demonstrates how to sort a file of integers in place.
+ *
+ *  \code
+ *  #include <thrust/mapped_vector.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::mapped_vector<int> keys("keys.bin", thrust::mapped_vector<int>::read_write);
+ *
+ *  // the sort reads the file sequentially at first
+ *  keys.advise(thrust::mapped_vector<int>::sequential);
+ *
+ *  thrust::sort(keys.begin(), keys.end());
+ *
+ *  // wait until the sorted keys reach the file
+ *  keys.flush();
+ *  \endcode
+ *
+ *  \note \p mapped_vector is supported on POSIX hosts. Elsewhere, its constructors throw
+ *        \p system_error.
+ *
+ *  \see host_vector
+ */
+template<typename T, typename System = thrust::host_system_tag>
+  class mapped_vector
+{
+  public:
+    /*! \p access_mode selects whether the file may be modified through the
+     *  \p mapped_vector.
+     */
+    enum access_mode
+    {
+      /*! The file is opened and mapped for reading only. Writing to its elements
+       *  terminates the program.
+       */
+      read_only,
+
+      /*! The file is opened and mapped for reading and writing, and modifications to
+       *  its elements are written back to it.
+       */
+      read_write
+    };
+
+    /*! \p access_pattern describes how elements will be accessed, so that the operating
+     *  system may read the file ahead of the accesses or release pages no longer needed.
+     */
+    enum access_pattern
+    {
+      /*! No particular pattern; the operating system's default.
+       */
+      normal,
+
+      /*! Elements will be accessed in increasing order, as by a scan or reduction. Pages are
+       *  read aggressively ahead of the accesses and may be released soon after them.
+       */
+      sequential,
+
+      /*! Elements will be accessed in no particular order, as by a gather or binary search.
+       *  Pages are not read ahead.
+       */
+      random,
+
+      /*! Elements will be accessed soon. Their pages are read in the background.
+       */
+      will_need,
+
+      /*! Elements will not be accessed soon. Their pages may be released; those of a
+       *  \p read_only \p mapped_vector are read from the file again if accessed.
+       */
+      dont_need
+    };
+
+    /*! \cond */
+    typedef T                                                        value_type;
+    typedef T*                                                       pointer;
+    typedef const T*                                                 const_pointer;
+    typedef T&                                                       reference;
+    typedef const T&                                                 const_reference;
+    typedef thrust::detail::tagged_iterator<T*,System>               iterator;
+    typedef thrust::detail::tagged_iterator<const T*,System>         const_iterator;
+    typedef std::size_t                                              size_type;
+    typedef std::ptrdiff_t                                           difference_type;
+    /*! \endcond */
+
+    /*! This constructor maps an existing file.
+     *  \param filename The name of the file.
+     *  \param mode Whether the file may be modified.
+     *  \throw system_error If the file could not be opened or mapped.
+     */
+    inline explicit mapped_vector(const char *filename, access_mode mode = read_only);
+
+    /*! This constructor creates a file, or resizes an existing one, to hold \p n elements
+     *  and maps it for reading and writing. Elements beyond the previous end of the file
+     *  are zero.
+     *  \param filename The name of the file.
+     *  \param n The number of elements of the file.
+     *  \throw system_error If the file could not be created, resized, or mapped.
+     */
+    inline mapped_vector(const char *filename, size_type n);
+
+    /*! The destructor unmaps the file. Modified elements are written back to the file
+     *  eventually, but not necessarily before the destructor returns.
+     */
+    inline ~mapped_vector();
+
+    /*! \return The number of elements of the file.
+     */
+    inline size_type size() const;
+
+    /*! \return <tt>size() == 0</tt>
+     */
+    inline bool empty() const;
+
+    /*! \return The \p access_mode the file was mapped with.
+     */
+    inline access_mode mode() const;
+
+    /*! \return An \p iterator pointing to the first element of the file.
+     */
+    inline iterator begin();
+
+    /*! \return A \p const_iterator pointing to the first element of the file.
+     */
+    inline const_iterator begin() const;
+
+    /*! \return An \p iterator pointing one past the last element of the file.
+     */
+    inline iterator end();
+
+    /*! \return A \p const_iterator pointing one past the last element of the file.
+     */
+    inline const_iterator end() const;
+
+    /*! \return A pointer to the first element of the file.
+     */
+    inline pointer data();
+
+    /*! \return A pointer to the first element of the file.
+     */
+    inline const_pointer data() const;
+
+    /*! \return A reference to the element of the file at position \p i.
+     */
+    inline reference operator[](size_type i);
+
+    /*! \return A reference to the element of the file at position \p i.
+     */
+    inline const_reference operator[](size_type i) const;
+
+    /*! This method tells the operating system how all elements of the file will be
+     *  accessed. It is only a hint: no \p access_pattern changes the values of the elements.
+     *  \param pattern The expected pattern of accesses.
+     */
+    inline void advise(access_pattern pattern);
+
+    /*! This method tells the operating system how the elements of the file in
+     *  <tt>[first, first + n)</tt> will be accessed.
+     *  \param pattern The expected pattern of accesses.
+     *  \param first The position of the first element.
+     *  \param n The number of elements.
+     */
+    inline void advise(access_pattern pattern, size_type first, size_type n);
+
+    /*! This method writes modified elements back to the file and waits until
+     *  they have been written. It does nothing if the file is mapped \p read_only.
+     *  \throw system_error If the elements could not be written.
+     */
+    inline void flush();
+
+    /*! This method swaps the files mapped by this \p mapped_vector and another.
+     *  \param other The other \p mapped_vector.
+     */
+    inline void swap(mapped_vector &other);
+
+  private:
+    // a mapped_vector owns its mapping, so it may not be copied
+    mapped_vector(const mapped_vector &);
+    mapped_vector &operator=(const mapped_vector &);
+
+    inline void map(const char *filename, access_mode mode, bool resize, size_type n);
+
+    T *m_begin;
+    size_type m_size;
+    std::size_t m_mapped_bytes;
+    access_mode m_mode;
+}; // end mapped_vector
+
+/*! Exchanges the files mapped by two \p mapped_vectors.
+ *  \param a The first \p mapped_vector.
+ *  \param b The second \p mapped_vector.
+ */
+template<typename T, typename System>
+  inline void swap(mapped_vector<T,System> &a, mapped_vector<T,System> &b)
+{
+  a.swap(b);
+} // end swap()
+
+/*! \}
+ */
+
+} // end thrust
+
+#include <thrust/detail/mapped_vector.inl>
+
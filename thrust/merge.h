@@ -21,6 +21,9 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/pair.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/merge_n_offsets.h>
 
 namespace thrust
 {
@@ -147,6 +150,373 @@ template<typename InputIterator1,
                        OutputIterator result,
                        StrictWeakCompare comp);
 
+/*! \p merge_n combines \p n sorted ranges into a single sorted range in one pass over
+ *  their elements. The ranges are given by an array of \p n pairs of iterators, the
+ *  <tt>i</tt>th of which is <tt>[ranges[i].first, ranges[i].second)</tt>. \p merge_n copies
+ *  their elements into <tt>[result, result + N)</tt>, where \c N is their total length, such
+ *  that the resulting range is in ascending order. \p merge_n is stable: the relative order of
+ *  elements within each range is preserved, and of equivalent elements of different ranges,
+ *  the one from the earlier range precedes. The return value is <tt>result + N</tt>.
+ *
+ *  Each element is selected from among the next elements of all ranges with a tournament
+ *  tree in about <tt>log2(n)</tt> comparisons, so merging many ranges at once is much cheaper
+ *  than merging them pairwise, which passes over the data <tt>log2(n)</tt> times. The \p omp
+ *  and \p tbb systems split the output among their threads, each of which merges the ranges'
+ *  elements destined for its part of the output.
+ *
+ *  This version of \p merge_n compares elements using \c operator<.
+ *
+ *  \param ranges The beginning of the array of ranges to merge, which resides in host memory.
+ *  \param n The number of ranges.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \tparam RangeIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is a \p pair of the same model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable">LessThan Comparable</a>
+ *          and is convertable to a type in \p OutputIterator's set of \c value_types.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p merge_n to merge three sorted
+ *  ranges of integers.
+ *
+ *  \code
+ *  #include <thrust/merge.h>
+ *  #include <thrust/pair.h>
+ *  ...
+ *  int A1[3] = {1, 4, 7};
+ *  int A2[4] = {2, 5, 8, 9};
+ *  int A3[2] = {3, 6};
+ *
+ *  thrust::pair<int*,int*> ranges[3] = {thrust::make_pair(A1, A1 + 3),
+ *                                       thrust::make_pair(A2, A2 + 4),
+ *                                       thrust::make_pair(A3, A3 + 2)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::merge_n(ranges, 3, result);
+ *  // result = {1, 2, 3, 4, 5, 6, 7, 8, 9}
+ *  \endcode
+ *
+ *  \see \p merge
+ *  \see \p merge_n_by_key
+ */
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator merge_n(RangeIterator ranges,
+                         Size n,
+                         OutputIterator result);
+
+/*! \p merge_n combines \p n sorted ranges into a single sorted range in one pass over
+ *  their elements, as the version of \p merge_n which compares with \c operator< does.
+ *
+ *  This version of \p merge_n compares elements using a function object \p comp.
+ *
+ *  \param ranges The beginning of the array of ranges to merge, which resides in host memory.
+ *  \param n The number of ranges.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam RangeIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is a \p pair of the same model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is convertable to \p StrictWeakCompare's \c first_argument_type and \c second_argument_type
+ *          and to a type in \p OutputIterator's set of \c value_types.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *  \tparam StrictWeakCompare is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \see \p merge_n
+ */
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakCompare>
+  typename thrust::detail::enable_if<
+    thrust::detail::is_integral<Size>::value,
+    OutputIterator
+  >::type
+    merge_n(RangeIterator ranges,
+            Size n,
+            OutputIterator result,
+            StrictWeakCompare comp);
+
+/*! \p merge_n combines \p num_ranges sorted ranges which lie one after another in a single
+ *  sequence into a single sorted range, as the versions of \p merge_n taking an array of ranges
+ *  do. The ranges are given by an array of <tt>num_ranges + 1</tt> offsets into the sequence
+ *  beginning at \p first: the <tt>i</tt>th range is
+ *  <tt>[first + offsets[i], first + offsets[i + 1])</tt>.
+ *
+ *  This version of \p merge_n compares elements using \c operator<.
+ *
+ *  \param first The beginning of the sequence containing the ranges to merge.
+ *  \param offsets The beginning of the array of <tt>num_ranges + 1</tt> nondecreasing offsets
+ *         of the ranges, which resides in host memory.
+ *  \param num_ranges The number of ranges.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable">LessThan Comparable</a>
+ *          and is convertable to a type in \p OutputIterator's set of \c value_types.
+ *  \tparam OffsetIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p merge_n to merge three sorted
+ *  ranges of integers stored one after another.
+ *
+ *  \code
+ *  #include <thrust/merge.h>
+ *  ...
+ *  int A[9] = {1, 4, 7, 2, 5, 8, 9, 3, 6};
+ *  int offsets[4] = {0, 3, 7, 9};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::merge_n(A, offsets, 3, result);
+ *  // result = {1, 2, 3, 4, 5, 6, 7, 8, 9}
+ *  \endcode
+ *
+ *  \see \p merge_n
+ */
+template<typename InputIterator,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    OutputIterator
+  >::type
+    merge_n(InputIterator first,
+            OffsetIterator offsets,
+            Size num_ranges,
+            OutputIterator result);
+
+/*! \p merge_n combines \p num_ranges sorted ranges which lie one after another in a single
+ *  sequence into a single sorted range, as the version of \p merge_n taking offsets and
+ *  comparing with \c operator< does.
+ *
+ *  This version of \p merge_n compares elements using a function object \p comp.
+ *
+ *  \param first The beginning of the sequence containing the ranges to merge.
+ *  \param offsets The beginning of the array of <tt>num_ranges + 1</tt> nondecreasing offsets
+ *         of the ranges, which resides in host memory.
+ *  \param num_ranges The number of ranges.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam StrictWeakCompare is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \see \p merge_n
+ */
+template<typename InputIterator,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakCompare>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    OutputIterator
+  >::type
+    merge_n(InputIterator first,
+            OffsetIterator offsets,
+            Size num_ranges,
+            OutputIterator result,
+            StrictWeakCompare comp);
+
+/*! \p merge_n_by_key performs a key-value merge of \p n sorted ranges of keys. The keys are
+ *  merged as \p merge_n merges elements, and the value of each key is copied to the position
+ *  of the key in the output: <tt>[key_ranges[i].first, key_ranges[i].second)</tt> are the
+ *  keys of the <tt>i</tt>th range, and the values of those keys begin at <tt>values[i]</tt>.
+ *  The return value is a \p pair of the ends of the output ranges of keys and values.
+ *
+ *  This version of \p merge_n_by_key compares keys using \c operator<.
+ *
+ *  \param key_ranges The beginning of the array of ranges of keys to merge, which resides in host memory.
+ *  \param values The beginning of the array of iterators to the values of each range of keys, which
+ *         resides in host memory.
+ *  \param n The number of ranges.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys
+ *          and <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam RangeIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is a \p pair of the same model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable">LessThan Comparable</a>
+ *          and is convertable to a type in \p OutputIterator1's set of \c value_types.
+ *  \tparam ValueIteratorIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is convertable to a type in \p OutputIterator2's set of \c value_types.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p merge_n_by_key to merge two sorted
+ *  ranges of integer keys with their character values.
+ *
+ *  \code
+ *  #include <thrust/merge.h>
+ *  #include <thrust/pair.h>
+ *  ...
+ *  int  K1[3] = {1, 3, 5};
+ *  char V1[3] = {'a', 'b', 'c'};
+ *  int  K2[3] = {1, 2, 6};
+ *  char V2[3] = {'d', 'e', 'f'};
+ *
+ *  thrust::pair<int*,int*> key_ranges[2] = {thrust::make_pair(K1, K1 + 3),
+ *                                           thrust::make_pair(K2, K2 + 3)};
+ *  char *values[2] = {V1, V2};
+ *
+ *  int  keys_result[6];
+ *  char values_result[6];
+ *
+ *  thrust::merge_n_by_key(key_ranges, values, 2, keys_result, values_result);
+ *  // keys_result   = {1, 1, 2, 3, 5, 6}
+ *  // values_result = {'a', 'd', 'e', 'b', 'c', 'f'}
+ *  \endcode
+ *
+ *  \see \p merge_n
+ */
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result);
+
+/*! \p merge_n_by_key performs a key-value merge of \p n sorted ranges of keys.
+ *
+ *  This version of \p merge_n_by_key compares keys using a function object \p comp.
+ *
+ *  \param key_ranges The beginning of the array of ranges of keys to merge, which resides in host memory.
+ *  \param values The beginning of the array of iterators to the values of each range of keys, which
+ *         resides in host memory.
+ *  \param n The number of ranges.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys
+ *          and <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam StrictWeakCompare is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \see \p merge_n_by_key
+ */
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  typename thrust::detail::enable_if<
+    thrust::detail::is_integral<Size>::value,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakCompare comp);
+
+/*! \p merge_n_by_key performs a key-value merge of \p num_ranges sorted ranges of keys which lie
+ *  one after another in a single sequence, as the versions of \p merge_n_by_key taking arrays
+ *  of ranges do. The <tt>i</tt>th range of keys is
+ *  <tt>[keys_first + offsets[i], keys_first + offsets[i + 1])</tt>, and the values of those
+ *  keys begin at <tt>values_first + offsets[i]</tt>.
+ *
+ *  This version of \p merge_n_by_key compares keys using \c operator<.
+ *
+ *  \param keys_first The beginning of the sequence containing the ranges of keys to merge.
+ *  \param values_first The beginning of the sequence of values of the keys.
+ *  \param offsets The beginning of the array of <tt>num_ranges + 1</tt> nondecreasing offsets
+ *         of the ranges, which resides in host memory.
+ *  \param num_ranges The number of ranges.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys
+ *          and <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam InputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable">LessThan Comparable</a>
+ *          and is convertable to a type in \p OutputIterator1's set of \c value_types.
+ *  \tparam InputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          whose \c value_type is convertable to a type in \p OutputIterator2's set of \c value_types.
+ *  \tparam OffsetIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam OutputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/OutputIterator.html">Output Iterator</a>.
+ *
+ *  \see \p merge_n_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(InputIterator1 keys_first,
+                   InputIterator2 values_first,
+                   OffsetIterator offsets,
+                   Size num_ranges,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result);
+
+/*! \p merge_n_by_key performs a key-value merge of \p num_ranges sorted ranges of keys which lie
+ *  one after another in a single sequence.
+ *
+ *  This version of \p merge_n_by_key compares keys using a function object \p comp.
+ *
+ *  \param keys_first The beginning of the sequence containing the ranges of keys to merge.
+ *  \param values_first The beginning of the sequence of values of the keys.
+ *  \param offsets The beginning of the array of <tt>num_ranges + 1</tt> nondecreasing offsets
+ *         of the ranges, which resides in host memory.
+ *  \param num_ranges The number of ranges.
+ *  \param keys_result The beginning of the merged output of keys.
+ *  \param values_result The beginning of the merged output of values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the output range of keys
+ *          and <tt>p.second</tt> is the end of the output range of values.
+ *
+ *  \tparam StrictWeakCompare is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \see \p merge_n_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OffsetIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakCompare>
+  typename thrust::detail::enable_if_merge_offsets<
+    OffsetIterator,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    merge_n_by_key(InputIterator1 keys_first,
+                   InputIterator2 values_first,
+                   OffsetIterator offsets,
+                   Size num_ranges,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakCompare comp);
+
 /*! \} // merging
  */
 
@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file precompiled.h
+ *  \brief Declares the algorithm instantiations provided by the
+ *         precompiled Thrust library
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/precompiled.h>
+
+/*! \addtogroup precompiled Precompiled Instantiations
+ *  \{
+ */
+
+/*! Including \p thrust/precompiled.h declares the instantiations of Thrust's most common
+ *  algorithm calls as <tt>extern template</tt>s, so that a translation unit which calls them
+ *  compiles only the call, rather than the algorithm's implementation. The program must then
+ *  link against the \c thrust_precompiled library built by \c precompiled/SConstruct, which
+ *  defines them.
+ *
+ *  The library provides
+ *
+ *  - \p sort and \p stable_sort, with no comparator, \p less, or \p greater
+ *  - \p reduce, with no initial value, or with an initial value and no operator,
+ *    \p plus, \p maximum, or \p minimum
+ *  - \p inclusive_scan, with no operator or \p plus, and \p exclusive_scan, with no
+ *    initial value, or with an initial value and no operator or \p plus
+ *
+ *  for ranges of <tt>int</tt>, <tt>unsigned int</tt>, <tt>long long</tt>, <tt>unsigned long long</tt>,
+ *  <tt>float</tt>, and <tt>double</tt>, given as raw pointers, \p host_vector iterators, and
+ *  \p device_vector iterators. The instantiations for \p device_vector are omitted when the
+ *  device system is CUDA. Other calls are compiled as usual.
+ *
+ *  The library must be built with the same host and device systems, the same OpenMP setting,
+ *  and the same definition of \c THRUST_ENABLE_TRACING as the program, because the program
+ *  uses its instantiations in place of its own. \p thrust/precompiled.h should be included
+ *  before the algorithms are called.
+ *
+ *  The following code snippet demonstrates how to use the precompiled instantiations.
+ *
+ *  \code
+ *  #include <thrust/precompiled.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::device_vector<int> keys(n);
+ *  ...
+ *  // calls the instantiation in the library
+ *  thrust::sort(keys.begin(), keys.end(), thrust::greater<int>());
+ *  \endcode
+ *
+ *  \see performance/compile_time.py, which measures how much compilation time this saves
+ */
+
+/*! \} // precompiled
+ */
+
+#if __THRUST_PRECOMPILED_ENABLED
+__THRUST_PRECOMPILED_INSTANTIATE(__THRUST_PRECOMPILED_SORT,   extern template)
+__THRUST_PRECOMPILED_INSTANTIATE(__THRUST_PRECOMPILED_REDUCE, extern template)
+__THRUST_PRECOMPILED_INSTANTIATE(__THRUST_PRECOMPILED_SCAN,   extern template)
+#endif
+
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file scratch_arena.h
+ *  \brief Supplies algorithms' temporary storage from memory owned by the caller
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef> // for std::size_t
+
+namespace thrust
+{
+
+namespace detail
+{
+
+struct scratch_arena_access;
+
+} // end detail
+
+/*! \addtogroup memory_management Memory Management
+ *  \addtogroup memory_management_classes Memory Management Classes
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! \p scratch_arena binds a region of memory owned by the caller to the calling thread.
+ *  While a \p scratch_arena exists, the temporary storage that algorithms dispatched by that
+ *  thread to the \p cpp, \p omp, and \p tbb systems would otherwise request from the heap
+ *  is carved from the region instead.
+ *
+ *  Storage is carved by advancing a pointer through the region, so each request costs a
+ *  few instructions. Storage released in the reverse order of its allocation, as an
+ *  algorithm's temporary storage usually is, is reclaimed immediately. The rest is
+ *  reclaimed at once when no storage from the region remains in use.
+ *
+ *  When a request does not fit in the remainder of the region, the \p scratch_arena's
+ *  \p exhaustion_policy determines whether the algorithm fails with \p std::bad_alloc or
+ *  takes the storage from the heap.
+ *
+ *  \p scratch_arenas may be nested. Each binds its region until it is destroyed, when the
+ *  enclosing \p scratch_arena, if any, is bound again. A \p scratch_arena must be destroyed
+ *  by the thread which created it, in the reverse order of creation.
+ *
+ *  The following code snippet demonstrates how to sort with temporary storage
+ *  taken from a region allocated once at startup.
+ *
+ *  \code
+ *  #include <thrust/scratch_arena.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/host_vector.h>
+ *  #include <vector>
+ *  ...
+ *  std::vector<char> region(1 << 24);
+ *
+ *  thrust::host_vector<int> keys = ...
+ *
+ *  {
+ *    thrust::scratch_arena arena(&region[0], region.size(), thrust::scratch_arena::fail);
+ *
+ *    // throws std::bad_alloc rather than touch the heap if the region is too small
+ *    thrust::stable_sort(keys.begin(), keys.end());
+ *  }
+ *  \endcode
+ *
+ *  \note Threads other than the one which created the \p scratch_arena, such as the
+ *        workers of the \p tbb system, take their temporary storage from the heap.
+ */
+class scratch_arena
+{
+  public:
+    /*! \p exhaustion_policy selects what happens to a request which does not fit in
+     *  the remainder of the region.
+     */
+    enum exhaustion_policy
+    {
+      /*! The request fails, and the algorithm which made it throws \p std::bad_alloc.
+       */
+      fail,
+
+      /*! The request is satisfied from the heap, as if no \p scratch_arena were bound.
+       */
+      fall_back
+    };
+
+    /*! This constructor binds a region of memory to the calling thread.
+     *  \param storage The beginning of the region.
+     *  \param size The size of the region in bytes.
+     *  \param policy What to do with requests which do not fit in the region.
+     */
+    inline scratch_arena(void *storage, std::size_t size, exhaustion_policy policy = fall_back);
+
+    /*! The destructor binds the enclosing \p scratch_arena, if any, to the calling thread.
+     */
+    inline ~scratch_arena();
+
+    /*! \return The size of the region in bytes.
+     */
+    inline std::size_t size() const;
+
+    /*! \return The number of bytes of the region between its beginning and the end of
+     *          the last storage in use.
+     */
+    inline std::size_t bytes_in_use() const;
+
+    /*! \return The greatest value of \p bytes_in_use over the lifetime of this
+     *          \p scratch_arena. A region of this size would have satisfied every request.
+     */
+    inline std::size_t peak_bytes_in_use() const;
+
+    /*! \return The number of requests which did not fit in the region.
+     */
+    inline std::size_t num_exhaustions() const;
+
+  private:
+    friend struct thrust::detail::scratch_arena_access;
+
+    // scratch_arenas are bound by address, so they may not be copied
+    scratch_arena(const scratch_arena &);
+    scratch_arena &operator=(const scratch_arena &);
+
+    inline void *allocate(std::size_t n);
+
+    inline bool deallocate(void *ptr);
+
+    char *m_begin;
+    std::size_t m_size;
+    std::size_t m_offset;
+    std::size_t m_num_blocks;
+    std::size_t m_peak_offset;
+    std::size_t m_num_exhaustions;
+    exhaustion_policy m_policy;
+    scratch_arena *m_enclosing;
+}; // end scratch_arena
+
+/*! \}
+ */
+
+} // end thrust
+
+#include <thrust/detail/scratch_arena.inl>
+
@@ -19,6 +19,13 @@
 #include <thrust/detail/config.h>
 #include <thrust/detail/raw_pointer_cast.h>
 #include <cstdlib> // for malloc & free
+#include <cstddef>
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#include <malloc.h> // for _aligned_malloc & _aligned_free
+#elif defined(__linux__)
+#include <sys/mman.h> // for madvise
+#endif
 
 namespace thrust
 {
@@ -45,6 +52,64 @@ inline void free(tag, Pointer ptr)
 } // end free()
 
 
+namespace malloc_and_free_detail
+{
+
+// allocations at least this large are backed by huge pages where the system allows
+const std::size_t huge_page_size = 2 << 20;
+
+} // end malloc_and_free_detail
+
+
+// returns n bytes aligned to alignment, a power of two no smaller than sizeof(void*)
+// allocations of huge_page_size bytes or more are aligned to and padded to a multiple of
+// huge_page_size, and the system is advised to back them with transparent huge pages
+// the result must be released with aligned_free
+inline void *aligned_malloc(tag, std::size_t n, std::size_t alignment)
+{
+  const std::size_t huge_page_size = malloc_and_free_detail::huge_page_size;
+
+  if(n >= huge_page_size)
+  {
+    n = (n + huge_page_size - 1) / huge_page_size * huge_page_size;
+
+    if(alignment < huge_page_size) alignment = huge_page_size;
+  } // end if
+
+  void *result = 0;
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+  result = _aligned_malloc(n, alignment);
+#else
+  if(posix_memalign(&result, alignment, n) != 0)
+  {
+    result = 0;
+  } // end if
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if(result && n >= huge_page_size)
+  {
+    // this is only advice, so failure is harmless
+    madvise(result, n, MADV_HUGEPAGE);
+  } // end if
+#endif // MADV_HUGEPAGE
+#endif // THRUST_HOST_COMPILER
+
+  return result;
+} // end aligned_malloc()
+
+
+template<typename Pointer>
+inline void aligned_free(tag, Pointer ptr)
+{
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+  _aligned_free(thrust::raw_pointer_cast(ptr));
+#else
+  std::free(thrust::raw_pointer_cast(ptr));
+#endif // THRUST_HOST_COMPILER
+} // end aligned_free()
+
+
 } // end detail
 } // end cpp
 } // end system
@@ -18,6 +18,7 @@
 #include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/system/cpp/memory.h>
 #include <thrust/system/cpp/detail/malloc_and_free.h>
+#include <thrust/system/cpp/detail/temporary_buffer.h>
 #include <thrust/detail/swap.h>
 #include <limits>
 
@@ -108,6 +109,40 @@ void free(pointer<void> ptr)
   return thrust::system::cpp::detail::free(tag(), ptr);
 } // end free()
 
+temporary_buffer_statistics get_temporary_buffer_statistics()
+{
+  const detail::temporary_buffer_cache_detail::cache_state &state = detail::temporary_buffer_cache_detail::get_cache_state();
+
+  temporary_buffer_statistics result;
+  result.hits              = state.hits;
+  result.misses            = state.misses;
+  result.bytes_in_use      = state.bytes_in_use;
+  result.peak_bytes_in_use = state.peak_bytes_in_use;
+  result.bytes_cached      = state.bytes_cached;
+
+  return result;
+} // end get_temporary_buffer_statistics()
+
+void reset_temporary_buffer_statistics()
+{
+  detail::temporary_buffer_cache_detail::reset_statistics();
+} // end reset_temporary_buffer_statistics()
+
+std::size_t get_temporary_buffer_cache_limit()
+{
+  return detail::temporary_buffer_cache_detail::limit();
+} // end get_temporary_buffer_cache_limit()
+
+void set_temporary_buffer_cache_limit(std::size_t bytes)
+{
+  detail::temporary_buffer_cache_detail::set_limit(bytes);
+} // end set_temporary_buffer_cache_limit()
+
+void trim_temporary_buffer_cache()
+{
+  detail::temporary_buffer_cache_detail::trim();
+} // end trim_temporary_buffer_cache()
+
 } // end cpp
 } // end system
 
@@ -20,6 +20,10 @@
 #include <thrust/pair.h>
 #include <thrust/system/cpp/detail/tag.h>
 #include <thrust/system/detail/internal/scalar/merge.h>
+#include <thrust/system/detail/internal/scalar/multiway_merge.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
 
 namespace thrust
 {
@@ -67,6 +71,54 @@ thrust::pair<OutputIterator1,OutputIterator2>
   return thrust::system::detail::internal::scalar::merge_by_key(first1, last1, first2, last2, first3, first4, output1, output2, comp);
 }
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge_n(tag,
+                       RangeIterator ranges,
+                       Size n,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type range_type;
+
+  // the merge advances the ranges, so it works on a copy
+  thrust::detail::temporary_array<range_type, tag> temp(ranges, ranges + n);
+
+  return thrust::system::detail::internal::scalar::multiway_merge(thrust::raw_pointer_cast(temp.begin().base()), n, result, comp);
+}
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type         range_type;
+  typedef typename thrust::iterator_value<ValueIteratorIterator>::type value_iterator;
+
+  // the merge advances the ranges, so it works on copies
+  thrust::detail::temporary_array<range_type, tag>     temp_key_ranges(key_ranges, key_ranges + n);
+  thrust::detail::temporary_array<value_iterator, tag> temp_values(values, values + n);
+
+  return thrust::system::detail::internal::scalar::multiway_merge_by_key(thrust::raw_pointer_cast(temp_key_ranges.begin().base()),
+                                                                         thrust::raw_pointer_cast(temp_values.begin().base()),
+                                                                         n,
+                                                                         keys_result,
+                                                                         values_result,
+                                                                         comp);
+}
+
 } // end namespace detail
 } // end namespace cpp
 } // end namespace system
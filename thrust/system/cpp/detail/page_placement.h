@@ -0,0 +1,54 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file page_placement.h
+ *  \brief Placement of the pages of the cpp system's memory.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/page_placement.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+
+
+// the cpp system has a single thread, which faults in the pages of the
+// uninitialized array [first, first + n) itself
+template<typename T>
+  void place_pages(tag, T *first, std::ptrdiff_t n)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  internal::touch_pages(first, internal::index_range<std::ptrdiff_t>(0, n));
+} // end place_pages()
+
+
+} // end detail
+} // end cpp
+} // end system
+} // end thrust
+
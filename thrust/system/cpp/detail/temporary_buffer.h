@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file temporary_buffer.h
+ *  \brief Temporary buffers carved from a scratch_arena or recycled
+ *         through a cache. Since the omp and tbb tags derive from the
+ *         cpp tag, they are found by their algorithms too.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/system/cpp/detail/temporary_buffer_cache.h>
+#include <thrust/scratch_arena.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/pair.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+namespace temporary_buffer_detail
+{
+
+
+// takes storage from the innermost scratch_arena bound to the calling thread,
+// or from the cache if there is none or it permits falling back
+// *is_new, if given, is set when the storage comes fresh from the system
+inline void *allocate(std::size_t n, bool *is_new = 0)
+{
+  typedef thrust::detail::scratch_arena_access access;
+
+  if(thrust::scratch_arena *arena = access::current())
+  {
+    void *result = access::allocate(*arena, n);
+
+    if(result || !access::falls_back(*arena)) return result;
+  } // end if
+
+  return temporary_buffer_cache_detail::allocate(n, is_new);
+} // end allocate()
+
+
+inline void deallocate(void *ptr)
+{
+  typedef thrust::detail::scratch_arena_access access;
+
+  for(thrust::scratch_arena *arena = access::current(); arena; arena = access::enclosing(*arena))
+  {
+    if(access::deallocate(*arena, ptr)) return;
+  } // end for
+
+  temporary_buffer_cache_detail::deallocate(ptr);
+} // end deallocate()
+
+
+} // end temporary_buffer_detail
+
+
+// note that get_temporary_buffer returns a raw pointer to avoid
+// depending on the heavyweight thrust/system/cpp/memory.h header
+template<typename T>
+  thrust::pair<T*, std::ptrdiff_t>
+    get_temporary_buffer(tag, std::ptrdiff_t n)
+{
+  T *result = static_cast<T*>(temporary_buffer_detail::allocate(sizeof(T) * n));
+
+  return thrust::make_pair(result, result ? n : std::ptrdiff_t(0));
+} // end get_temporary_buffer()
+
+
+template<typename Pointer>
+  void return_temporary_buffer(tag, Pointer p)
+{
+  temporary_buffer_detail::deallocate(thrust::raw_pointer_cast(p));
+} // end return_temporary_buffer()
+
+
+} // end detail
+} // end cpp
+} // end system
+} // end thrust
+
@@ -0,0 +1,550 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file temporary_buffer_cache.h
+ *  \brief A cache of released temporary buffers, shared by the cpp, omp
+ *         and tbb systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstdlib>
+#include <cstddef>
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+// buffers are cached only where the compiler offers the atomic operations
+// the cache needs to be shared among threads
+#if (THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_GCC) || (THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC)
+#define __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED 1
+#else
+#define __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED 0
+#endif
+
+// each thread keeps a cache of its own where the compiler can destroy it
+// when the thread exits
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+#define __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+#else
+#define __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD 0
+#endif
+
+namespace thrust
+{
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+namespace temporary_buffer_cache_detail
+{
+
+
+// the number of bytes of released buffers retained unless the user says otherwise
+const std::size_t default_limit = std::size_t(1) << 28;
+
+// size classes are spaced four to each power of two, so rounding
+// a request up to its class wastes at most a fifth of the block
+const unsigned int log2_min_size     = 6;
+const unsigned int classes_per_power = 4;
+const unsigned int num_bits          = 8 * sizeof(std::size_t);
+const unsigned int num_classes       = classes_per_power * (num_bits - 2 - log2_min_size) + 1;
+
+// blocks larger than this are returned to the system as soon as they are released
+const std::size_t max_cached_size = std::size_t(1) << (num_bits - 2);
+
+// each thread keeps at most this many blocks of each class to itself,
+// and only of classes small enough that keeping them is cheap
+const unsigned int thread_cache_depth  = 4;
+const std::size_t max_thread_cached_size = std::size_t(1) << 20;
+
+
+// every block begins with a header which records its size and, while the
+// block is cached, links it to the next block of its class. the header is
+// padded to the alignment of malloc, which the buffer after it inherits
+struct block_header_fields
+{
+  std::size_t size;
+  void *next;
+};
+
+union block_header
+{
+  block_header_fields fields;
+  char padding[16];
+};
+
+
+inline unsigned int floor_log2(std::size_t x)
+{
+  unsigned int result = 0;
+
+  while(x >>= 1)
+  {
+    ++result;
+  }
+
+  return result;
+} // end floor_log2()
+
+
+// returns the smallest class whose blocks hold n bytes
+inline unsigned int size_class(std::size_t n)
+{
+  if(n <= (std::size_t(1) << log2_min_size)) return 0;
+
+  const std::size_t m = n - 1;
+  const unsigned int e = floor_log2(m);
+
+  // the two bits below the leading one select the quarter within [2^e, 2^(e+1))
+  const unsigned int quarter = static_cast<unsigned int>(m >> (e - 2)) & 3;
+
+  return classes_per_power * (e - log2_min_size) + quarter + 1;
+} // end size_class()
+
+
+// returns the size of the blocks of class c
+inline std::size_t class_size(unsigned int c)
+{
+  if(c == 0) return std::size_t(1) << log2_min_size;
+
+  const unsigned int e       = (c - 1) / classes_per_power + log2_min_size;
+  const unsigned int quarter = (c - 1) % classes_per_power;
+
+  return std::size_t(quarter + 5) << (e - 2);
+} // end class_size()
+
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#if defined(_WIN64)
+inline std::size_t atomic_add(volatile std::size_t &x, std::size_t y)
+{
+  return static_cast<std::size_t>(_InterlockedExchangeAdd64(reinterpret_cast<volatile __int64*>(&x), static_cast<__int64>(y))) + y;
+}
+
+inline std::size_t atomic_compare_and_swap(volatile std::size_t &x, std::size_t compare, std::size_t y)
+{
+  return static_cast<std::size_t>(_InterlockedCompareExchange64(reinterpret_cast<volatile __int64*>(&x), static_cast<__int64>(y), static_cast<__int64>(compare)));
+}
+#else
+inline std::size_t atomic_add(volatile std::size_t &x, std::size_t y)
+{
+  return static_cast<std::size_t>(_InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&x), static_cast<long>(y))) + y;
+}
+
+inline std::size_t atomic_compare_and_swap(volatile std::size_t &x, std::size_t compare, std::size_t y)
+{
+  return static_cast<std::size_t>(_InterlockedCompareExchange(reinterpret_cast<volatile long*>(&x), static_cast<long>(y), static_cast<long>(compare)));
+}
+#endif // _WIN64
+
+inline bool try_lock(volatile long &lock)
+{
+  return _InterlockedExchange(&lock, 1) == 0;
+}
+
+inline void unlock(volatile long &lock)
+{
+  _InterlockedExchange(&lock, 0);
+}
+#else
+// returns the new value of x
+inline std::size_t atomic_add(volatile std::size_t &x, std::size_t y)
+{
+  return __sync_add_and_fetch(&x, y);
+}
+
+// returns the old value of x
+inline std::size_t atomic_compare_and_swap(volatile std::size_t &x, std::size_t compare, std::size_t y)
+{
+  return __sync_val_compare_and_swap(&x, compare, y);
+}
+
+inline bool try_lock(volatile long &lock)
+{
+  return __sync_lock_test_and_set(&lock, 1) == 0;
+}
+
+inline void unlock(volatile long &lock)
+{
+  __sync_lock_release(&lock);
+}
+#endif // THRUST_HOST_COMPILER
+
+inline std::size_t atomic_sub(volatile std::size_t &x, std::size_t y)
+{
+  return atomic_add(x, std::size_t(0) - y);
+}
+
+inline void atomic_max(volatile std::size_t &x, std::size_t y)
+{
+  std::size_t old = x;
+
+  while(old < y)
+  {
+    const std::size_t observed = atomic_compare_and_swap(x, old, y);
+
+    if(observed == old) break;
+
+    old = observed;
+  }
+}
+
+// the shared free lists are only touched for a few instructions at a time,
+// so waiting threads spin rather than sleep
+inline void lock(volatile long &lock)
+{
+  while(!try_lock(lock))
+  {
+    while(lock) {}
+  }
+}
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+
+
+// the state of the cache is plain-old-data which is zero before any
+// constructor runs, so it may be used from any thread at any time
+struct cache_state
+{
+  volatile long lock;
+
+  block_header *free_lists[num_classes];
+
+  volatile std::size_t hits;
+  volatile std::size_t misses;
+  volatile std::size_t bytes_in_use;
+  volatile std::size_t peak_bytes_in_use;
+  volatile std::size_t bytes_cached;
+
+  // limit is meaningful only once limit_is_set
+  volatile std::size_t limit;
+  volatile bool limit_is_set;
+};
+
+template<typename Unused>
+  struct cache_state_holder
+{
+  static cache_state state;
+};
+
+template<typename Unused>
+  cache_state cache_state_holder<Unused>::state;
+
+inline cache_state &get_cache_state()
+{
+  return cache_state_holder<void>::state;
+}
+
+
+inline std::size_t limit()
+{
+  const cache_state &s = get_cache_state();
+
+  return s.limit_is_set ? s.limit : default_limit;
+} // end limit()
+
+
+inline block_header *system_allocate(std::size_t size)
+{
+  return static_cast<block_header*>(std::malloc(size));
+}
+
+
+inline void system_deallocate(block_header *block)
+{
+  std::free(block);
+}
+
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+inline block_header *shared_pop(unsigned int c)
+{
+  cache_state &s = get_cache_state();
+
+  lock(s.lock);
+
+  block_header *result = s.free_lists[c];
+
+  if(result)
+  {
+    s.free_lists[c] = static_cast<block_header*>(result->fields.next);
+  }
+
+  unlock(s.lock);
+
+  return result;
+} // end shared_pop()
+
+
+inline void shared_push(block_header *block)
+{
+  cache_state &s = get_cache_state();
+
+  const unsigned int c = size_class(block->fields.size);
+
+  lock(s.lock);
+
+  block->fields.next = s.free_lists[c];
+  s.free_lists[c] = block;
+
+  unlock(s.lock);
+} // end shared_push()
+
+
+// releases cached blocks, largest first, until no more than target bytes remain cached
+inline void shared_trim(std::size_t target)
+{
+  cache_state &s = get_cache_state();
+
+  for(unsigned int c = num_classes; c > 0 && s.bytes_cached > target; --c)
+  {
+    lock(s.lock);
+
+    block_header *list = s.free_lists[c - 1];
+    s.free_lists[c - 1] = 0;
+
+    unlock(s.lock);
+
+    while(list)
+    {
+      block_header *next = static_cast<block_header*>(list->fields.next);
+
+      atomic_sub(s.bytes_cached, list->fields.size);
+      system_deallocate(list);
+
+      list = next;
+    }
+  }
+} // end shared_trim()
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+class thread_cache
+{
+  public:
+    thread_cache()
+    {
+      for(unsigned int c = 0; c < num_classes; ++c)
+      {
+        m_free_lists[c] = 0;
+        m_counts[c] = 0;
+      }
+    }
+
+    // a thread's blocks outlive it in the shared cache
+    ~thread_cache()
+    {
+      flush();
+    }
+
+    static bool holds(std::size_t size)
+    {
+      return size <= max_thread_cached_size;
+    }
+
+    block_header *pop(unsigned int c)
+    {
+      block_header *result = m_free_lists[c];
+
+      if(result)
+      {
+        m_free_lists[c] = static_cast<block_header*>(result->fields.next);
+        --m_counts[c];
+      }
+
+      return result;
+    }
+
+    bool push(block_header *block)
+    {
+      const unsigned int c = size_class(block->fields.size);
+
+      if(m_counts[c] == thread_cache_depth) return false;
+
+      block->fields.next = m_free_lists[c];
+      m_free_lists[c] = block;
+      ++m_counts[c];
+
+      return true;
+    }
+
+    void flush()
+    {
+      for(unsigned int c = 0; c < num_classes; ++c)
+      {
+        while(block_header *block = pop(c))
+        {
+          shared_push(block);
+        }
+      }
+    }
+
+  private:
+    block_header *m_free_lists[num_classes];
+    unsigned int  m_counts[num_classes];
+};
+
+
+inline thread_cache &get_thread_cache()
+{
+  static thread_local thread_cache result;
+  return result;
+}
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+
+
+// returns a buffer of at least n bytes, or null if the system has no memory to give
+// *is_new, if given, is set when the buffer comes from the system rather than the cache
+inline void *allocate(std::size_t n, bool *is_new = 0)
+{
+  cache_state &s = get_cache_state();
+
+  if(n > max_cached_size - sizeof(block_header)) return 0;
+
+  const unsigned int c = size_class(n + sizeof(block_header));
+  const std::size_t size = class_size(c);
+
+  block_header *block = 0;
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+#if __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+  if(thread_cache::holds(size))
+  {
+    block = get_thread_cache().pop(c);
+  }
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+
+  if(!block)
+  {
+    block = shared_pop(c);
+  }
+
+  if(block)
+  {
+    atomic_add(s.hits, 1);
+    atomic_sub(s.bytes_cached, size);
+  }
+  else
+  {
+    block = system_allocate(size);
+
+    // memory sitting idle in the cache is better spent on this request
+    if(!block)
+    {
+      shared_trim(0);
+      block = system_allocate(size);
+    }
+
+    if(!block) return 0;
+
+    atomic_add(s.misses, 1);
+
+    if(is_new) *is_new = true;
+  }
+
+  atomic_max(s.peak_bytes_in_use, atomic_add(s.bytes_in_use, size));
+#else
+  block = system_allocate(size);
+
+  if(!block) return 0;
+
+  if(is_new) *is_new = true;
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+
+  block->fields.size = size;
+
+  return block + 1;
+} // end allocate()
+
+
+inline void deallocate(void *ptr)
+{
+  if(!ptr) return;
+
+  block_header *block = static_cast<block_header*>(ptr) - 1;
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+  cache_state &s = get_cache_state();
+
+  const std::size_t size = block->fields.size;
+
+  atomic_sub(s.bytes_in_use, size);
+
+  // past the high-water mark, released blocks go back to the system
+  if(atomic_add(s.bytes_cached, size) > limit())
+  {
+    atomic_sub(s.bytes_cached, size);
+    system_deallocate(block);
+    return;
+  }
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+  if(thread_cache::holds(size) && get_thread_cache().push(block)) return;
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+
+  shared_push(block);
+#else
+  system_deallocate(block);
+#endif // __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+} // end deallocate()
+
+
+inline void set_limit(std::size_t bytes)
+{
+  cache_state &s = get_cache_state();
+
+  s.limit = bytes;
+  s.limit_is_set = true;
+
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+  shared_trim(bytes);
+#endif
+} // end set_limit()
+
+
+inline void reset_statistics()
+{
+  cache_state &s = get_cache_state();
+
+  s.hits   = 0;
+  s.misses = 0;
+  s.peak_bytes_in_use = s.bytes_in_use;
+} // end reset_statistics()
+
+
+inline void trim()
+{
+#if __THRUST_TEMPORARY_BUFFER_CACHE_ENABLED
+#if __THRUST_TEMPORARY_BUFFER_CACHE_PER_THREAD
+  get_thread_cache().flush();
+#endif
+  shared_trim(0);
+#endif
+} // end trim()
+
+
+} // end temporary_buffer_cache_detail
+} // end detail
+} // end cpp
+} // end system
+} // end thrust
+
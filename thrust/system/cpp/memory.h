@@ -25,6 +25,7 @@
 #include <thrust/memory.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/allocator/malloc_allocator.h>
+#include <thrust/detail/allocator/aligned_malloc_allocator.h>
 #include <ostream>
 
 namespace thrust
@@ -331,6 +332,64 @@ inline pointer<void> malloc(std::size_t n);
  */
 inline void free(pointer<void> ptr);
 
+/*! \p temporary_buffer_statistics describes the activity of the cache through which
+ *  Thrust's algorithms obtain temporary storage in the <tt>cpp</tt>, <tt>omp</tt>, and
+ *  <tt>tbb</tt> systems. Storage an algorithm releases is kept in the cache, sorted into
+ *  size classes, so that the next algorithm to need storage of a similar size does not
+ *  ask the system for it again.
+ *  \see get_temporary_buffer_statistics
+ */
+struct temporary_buffer_statistics
+{
+  /*! The number of requests satisfied by storage in the cache.
+   */
+  std::size_t hits;
+
+  /*! The number of requests satisfied by new storage from the system.
+   */
+  std::size_t misses;
+
+  /*! The number of bytes held by algorithms.
+   */
+  std::size_t bytes_in_use;
+
+  /*! The greatest value of \p bytes_in_use since the statistics were last reset.
+   */
+  std::size_t peak_bytes_in_use;
+
+  /*! The number of bytes released by algorithms and kept in the cache.
+   */
+  std::size_t bytes_cached;
+}; // end temporary_buffer_statistics
+
+/*! Returns the statistics of the temporary storage cache.
+ *  \return A \p temporary_buffer_statistics describing every thread's requests.
+ *  \see reset_temporary_buffer_statistics
+ */
+inline temporary_buffer_statistics get_temporary_buffer_statistics();
+
+/*! Zeroes the counts of hits and misses of the temporary storage cache and lowers its
+ *  peak to the number of bytes currently in use.
+ */
+inline void reset_temporary_buffer_statistics();
+
+/*! Returns the most storage the temporary storage cache retains.
+ *  \return The limit in bytes. The default is 256 MB.
+ */
+inline std::size_t get_temporary_buffer_cache_limit();
+
+/*! Sets the most storage the temporary storage cache retains. Storage released while
+ *  the cache is at this limit is returned to the system. Lowering the limit returns
+ *  storage to the system until the cache is within it.
+ *  \param bytes The new limit in bytes. A limit of zero disables caching.
+ */
+inline void set_temporary_buffer_cache_limit(std::size_t bytes);
+
+/*! Returns the storage held by the temporary storage cache to the system. Each thread
+ *  keeps a few small buffers of its own, and only the calling thread's are returned.
+ */
+inline void trim_temporary_buffer_cache();
+
 // XXX upon c++11
 // template<typename T> using allocator = thrust::detail::malloc_allocator<T,tag,pointer<T> >;
 
@@ -381,6 +440,62 @@ template<typename T>
   inline ~allocator() {}
 }; // end allocator
 
+/*! \p cpp::aligned_allocator allocates storage available to the \p cpp system which begins on a
+ *  multiple of \p Alignment bytes, so that the \p data() of a container which uses it, such as
+ *  <tt>cpp::vector<T, cpp::aligned_allocator<T> ></tt>, is aligned for cache lines and SIMD loads.
+ *
+ *  Allocations of 2 MB or more are aligned to 2 MB and padded to a multiple of it, and where the
+ *  system supports transparent huge pages, it is advised to back them with huge pages, which
+ *  spares random accesses to large arrays most of their TLB misses.
+ *
+ *  \tparam T The type of element to allocate.
+ *  \tparam Alignment The alignment in bytes, a power of two no smaller than <tt>sizeof(void*)</tt>.
+ *          Defaults to the size of a cache line, \c 64.
+ */
+template<typename T, std::size_t Alignment = 64>
+  struct aligned_allocator
+    : thrust::detail::aligned_malloc_allocator<
+        T,
+        tag,
+        pointer<T>,
+        Alignment
+      >
+{
+  /*! The \p rebind metafunction provides the type of an \p aligned_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p aligned_allocator.
+     */
+    typedef aligned_allocator<U,Alignment> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  __host__ __device__
+  inline aligned_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  __host__ __device__
+  inline aligned_allocator(const aligned_allocator &) {}
+
+  /*! Constructor from other \p aligned_allocator has no effect.
+   */
+  template<typename U>
+  __host__ __device__
+  inline aligned_allocator(const aligned_allocator<U,Alignment> &) {}
+
+  /*! Destructor has no effect.
+   */
+  __host__ __device__
+  inline ~aligned_allocator() {}
+}; // end aligned_allocator
+
 } // end cpp
 
 /*! \}
@@ -398,7 +513,14 @@ using thrust::system::cpp::pointer;
 using thrust::system::cpp::reference;
 using thrust::system::cpp::malloc;
 using thrust::system::cpp::free;
+using thrust::system::cpp::temporary_buffer_statistics;
+using thrust::system::cpp::get_temporary_buffer_statistics;
+using thrust::system::cpp::reset_temporary_buffer_statistics;
+using thrust::system::cpp::get_temporary_buffer_cache_limit;
+using thrust::system::cpp::set_temporary_buffer_cache_limit;
+using thrust::system::cpp::trim_temporary_buffer_cache;
 using thrust::system::cpp::allocator;
+using thrust::system::cpp::aligned_allocator;
 
 } // end cpp
 
@@ -25,6 +25,7 @@
 #include <thrust/system/cuda/memory.h>
 #include <thrust/detail/vector_base.h>
 #include <vector>
+#include <utility>
 
 namespace thrust
 {
@@ -85,11 +86,31 @@ template<typename T, typename Allocator = allocator<T> >
      */
     explicit vector(size_type n, const value_type &value = value_type());
 
+    /*! This constructor creates a \p cuda::vector with \p n default-initialized elements,
+     *  which are left uninitialized if their type has a trivial constructor.
+     *  \param n The size of the \p cuda::vector to create.
+     */
+    vector(size_type n, default_init_t);
+
+    /*! This constructor creates a \p cuda::vector with \p n default-initialized elements,
+     *  which are left uninitialized if their type has a trivial constructor.
+     *  \param n The size of the \p cuda::vector to create.
+     *  \see first_touch
+     */
+    vector(size_type n, first_touch_t);
+
     /*! Copy constructor copies from another \p cuda::vector.
      *  \param x The other \p cuda::vector to copy.
      */
     vector(const vector &x);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move constructor takes the elements of another \p cuda::vector, leaving it empty.
+     *  \param x The other \p cuda::vector to move from.
+     */
+    vector(vector &&x) noexcept;
+#endif
+
     /*! This constructor copies from another Thrust vector-like object.
      *  \param x The other object to copy from.
      */
@@ -110,6 +131,20 @@ template<typename T, typename Allocator = allocator<T> >
     vector(InputIterator first, InputIterator last);
 
     // XXX vector_base should take a Derived type so we don't have to define these superfluous assigns
+
+    /*! Assignment operator assigns from another \p cuda::vector.
+     *  \param x The other \p cuda::vector to assign from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(const vector &x);
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move assignment operator takes the elements of another \p cuda::vector, leaving it empty.
+     *  \param x The other \p cuda::vector to move from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(vector &&x) noexcept;
+#endif
     //
     /*! Assignment operator assigns from a \c std::vector.
      *  \param x The \c std::vector to assign from.
@@ -21,8 +21,7 @@
 
 #pragma once
 
-#include <thrust/detail/internal_functional.h>
-#include <thrust/generate.h>
+#include <thrust/detail/config.h>
 #include <thrust/system/detail/generic/tag.h>
 
 namespace thrust
@@ -39,19 +38,13 @@ template<typename OutputIterator, typename Size, typename T>
   OutputIterator fill_n(tag,
                         OutputIterator first,
                         Size n,
-                        const T &value)
-{
-  return thrust::generate_n(first, n, thrust::detail::fill_functor<T>(value));
-}
+                        const T &value);
 
 template<typename ForwardIterator, typename T>
   void fill(tag,
             ForwardIterator first,
             ForwardIterator last,
-            const T &value)
-{
-  thrust::generate(first, last, thrust::detail::fill_functor<T>(value));
-}
+            const T &value);
 
 
 } // end namespace generic
@@ -59,3 +52,5 @@ template<typename ForwardIterator, typename T>
 } // end namespace system
 } // end namespace thrust
 
+#include <thrust/system/detail/generic/fill.inl>
+
@@ -19,6 +19,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/generic/tag.h>
+#include <thrust/pair.h>
 
 namespace thrust
 {
@@ -55,6 +56,33 @@ template<typename InputIterator1,
                        OutputIterator result);
 
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator merge_n(tag,
+                         RangeIterator ranges,
+                         Size n,
+                         OutputIterator result,
+                         StrictWeakOrdering comp);
+
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp);
+
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
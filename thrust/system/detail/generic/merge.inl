@@ -22,6 +22,11 @@
 #include <thrust/system/detail/generic/merge.h>
 #include <thrust/merge.h>
 #include <thrust/functional.h>
+#include <thrust/copy.h>
+#include <thrust/sort.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
 
 namespace thrust
 {
@@ -65,6 +70,99 @@ template<typename InputIterator1,
 } // end merge()
 
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator merge_n(tag,
+                         RangeIterator ranges,
+                         Size n,
+                         OutputIterator result,
+                         StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type        range_type;
+  typedef typename range_type::first_type                            InputIterator;
+  typedef typename thrust::iterator_value<InputIterator>::type       value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type  difference_type;
+  typedef typename thrust::iterator_system<InputIterator>::type      System;
+
+  difference_type num_elements = 0;
+  for(Size i = 0; i < n; ++i)
+  {
+    range_type range = ranges[i];
+    num_elements += thrust::distance(range.first, range.second);
+  }
+
+  // systems without a multiway merge of their own concatenate the ranges in order and sort
+  // them stably, which orders equivalent elements of different ranges as a merge would
+  thrust::detail::temporary_array<value_type,System> temp(num_elements);
+
+  typename thrust::detail::temporary_array<value_type,System>::iterator end = temp.begin();
+  for(Size i = 0; i < n; ++i)
+  {
+    range_type range = ranges[i];
+    end = thrust::copy(range.first, range.second, end);
+  }
+
+  thrust::stable_sort(temp.begin(), temp.end(), comp);
+
+  return thrust::copy(temp.begin(), temp.end(), result);
+} // end merge_n()
+
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type         range_type;
+  typedef typename range_type::first_type                             InputIterator1;
+  typedef typename thrust::iterator_value<ValueIteratorIterator>::type InputIterator2;
+  typedef typename thrust::iterator_value<InputIterator1>::type        key_type;
+  typedef typename thrust::iterator_value<InputIterator2>::type        value_type;
+  typedef typename thrust::iterator_difference<InputIterator1>::type   difference_type;
+  typedef typename thrust::iterator_system<InputIterator1>::type       System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type       System2;
+
+  difference_type num_elements = 0;
+  for(Size i = 0; i < n; ++i)
+  {
+    range_type range = key_ranges[i];
+    num_elements += thrust::distance(range.first, range.second);
+  }
+
+  thrust::detail::temporary_array<key_type,System1>   temp_keys(num_elements);
+  thrust::detail::temporary_array<value_type,System2> temp_values(num_elements);
+
+  typename thrust::detail::temporary_array<key_type,System1>::iterator   keys_end   = temp_keys.begin();
+  typename thrust::detail::temporary_array<value_type,System2>::iterator values_end = temp_values.begin();
+  for(Size i = 0; i < n; ++i)
+  {
+    range_type     range = key_ranges[i];
+    InputIterator2 first = values[i];
+    difference_type size = thrust::distance(range.first, range.second);
+
+    keys_end   = thrust::copy(range.first, range.second, keys_end);
+    values_end = thrust::copy(first, first + size, values_end);
+  }
+
+  thrust::stable_sort_by_key(temp_keys.begin(), temp_keys.end(), temp_values.begin(), comp);
+
+  return thrust::make_pair(thrust::copy(temp_keys.begin(),   temp_keys.end(),   keys_result),
+                           thrust::copy(temp_values.begin(), temp_values.end(), values_result));
+} // end merge_n_by_key()
+
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
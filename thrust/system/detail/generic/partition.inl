@@ -26,8 +26,14 @@
 #include <thrust/sort.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/reverse.h>
+
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/system/detail/internal/low_memory.h>
 
 namespace thrust
 {
@@ -38,6 +44,71 @@ namespace detail
 namespace generic
 {
 
+namespace partition_detail
+{
+
+
+// exchanges [first, middle) and [middle, last) and returns the new position of first
+template<typename BidirectionalIterator>
+  BidirectionalIterator rotate(BidirectionalIterator first,
+                               BidirectionalIterator middle,
+                               BidirectionalIterator last)
+{
+  thrust::reverse(first, middle);
+  thrust::reverse(middle, last);
+  thrust::reverse(first, last);
+
+  BidirectionalIterator result = first;
+  thrust::advance(result, thrust::distance(middle, last));
+
+  return result;
+} // end rotate()
+
+
+// stably partitions the n elements of [first, last) with a temporary buffer of buffer_size
+// elements. larger ranges are halved, and the false elements of the left half exchanged
+// with the true elements of the right by rotation
+template<typename ForwardIterator,
+         typename Predicate,
+         typename Size,
+         typename TempIterator>
+  ForwardIterator stable_partition_with_buffer(ForwardIterator first,
+                                               ForwardIterator last,
+                                               Predicate pred,
+                                               Size n,
+                                               TempIterator temp,
+                                               Size buffer_size)
+{
+  if(n <= buffer_size)
+  {
+    // copy input to temp buffer
+    TempIterator temp_last = thrust::copy(first, last, temp);
+
+    // count the size of the true partition
+    Size num_true = thrust::count_if(temp, temp_last, pred);
+
+    // point to the beginning of the false partition
+    ForwardIterator out_false = first;
+    thrust::advance(out_false, num_true);
+
+    return thrust::stable_partition_copy(temp, temp_last, first, out_false, pred).first;
+  } // end if
+
+  const Size half = n / 2;
+
+  ForwardIterator middle = first;
+  thrust::advance(middle, half);
+
+  ForwardIterator left_middle  = stable_partition_with_buffer(first, middle, pred, half, temp, buffer_size);
+  ForwardIterator right_middle = stable_partition_with_buffer(middle, last, pred, n - half, temp, buffer_size);
+
+  return partition_detail::rotate(left_middle, middle, right_middle);
+} // end stable_partition_with_buffer()
+
+
+} // end partition_detail
+
+
 template<typename ForwardIterator,
          typename Predicate>
   ForwardIterator stable_partition(tag,
@@ -45,20 +116,27 @@ template<typename ForwardIterator,
                                    ForwardIterator last,
                                    Predicate pred)
 {
-  typedef typename thrust::iterator_traits<ForwardIterator>::value_type InputType;
+  typedef typename thrust::iterator_traits<ForwardIterator>::value_type      InputType;
+  typedef typename thrust::iterator_traits<ForwardIterator>::difference_type Size;
   typedef typename thrust::iterator_system<ForwardIterator>::type System;
 
-  // copy input to temp buffer
-  thrust::detail::temporary_array<InputType,System> temp(first, last);
+  Size n = thrust::distance(first, last);
+
+  // with too little memory to copy the whole input, it is partitioned in pieces
+  thrust::detail::temporary_array<InputType,System> temp(0);
+
+  thrust::low_memory_monitor::mode mode = thrust::system::detail::internal::allocate_at_most(temp, n);
+
+  if(mode == thrust::low_memory_monitor::no_buffer)
+  {
+    throw thrust::system::detail::bad_alloc("temporary_buffer::allocate: get_temporary_buffer failed");
+  } // end if
 
-  // count the size of the true partition
-  typename thrust::iterator_difference<ForwardIterator>::type num_true = thrust::count_if(first,last,pred);
+  ForwardIterator result = partition_detail::stable_partition_with_buffer(first, last, pred, n, temp.begin(), static_cast<Size>(temp.size()));
 
-  // point to the beginning of the false partition
-  ForwardIterator out_false = first;
-  thrust::advance(out_false, num_true);
+  thrust::system::detail::internal::record_low_memory_mode(mode);
 
-  return thrust::stable_partition_copy(temp.begin(), temp.end(), first, out_false, pred).first;
+  return result;
 } // end stable_partition()
 
 template<typename InputIterator,
@@ -34,6 +34,10 @@
 #include <thrust/detail/internal_functional.h>
 #include <thrust/scan.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/copy.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/system/detail/internal/low_memory.h>
 
 namespace thrust
 {
@@ -64,6 +68,67 @@ struct reduce_by_key_functor
     }
 };
 
+
+// reduces by key using flags, an array of 3 * n flags, and scanned_values, an array of n values
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename FlagIterator,
+         typename ValueIterator>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    reduce_by_key_with_storage(InputIterator1 keys_first, 
+                               InputIterator1 keys_last,
+                               InputIterator2 values_first,
+                               OutputIterator1 keys_output,
+                               OutputIterator2 values_output,
+                               BinaryPredicate binary_pred,
+                               BinaryFunction binary_op,
+                               FlagIterator flags,
+                               ValueIterator scanned_values)
+{
+    typedef typename thrust::iterator_traits<InputIterator1>::difference_type difference_type;
+    typedef typename thrust::iterator_value<FlagIterator>::type  FlagType;
+    typedef typename thrust::iterator_value<ValueIterator>::type ValueType;
+
+    // input size
+    difference_type n = keys_last - keys_first;
+
+    InputIterator2 values_last = values_first + n;
+
+    FlagIterator head_flags         = flags;
+    FlagIterator tail_flags         = flags + n;
+    FlagIterator scanned_tail_flags = flags + 2 * n;
+    
+    // compute head flags
+    thrust::transform(keys_first, keys_last - 1, keys_first + 1, head_flags + 1, thrust::detail::not2(binary_pred));
+    head_flags[0] = 1;
+
+    // compute tail flags
+    thrust::transform(keys_first, keys_last - 1, keys_first + 1, tail_flags, thrust::detail::not2(binary_pred));
+    tail_flags[n-1] = 1;
+
+    // scan the values by flag
+    thrust::inclusive_scan
+        (thrust::make_zip_iterator(thrust::make_tuple(values_first,   head_flags)),
+         thrust::make_zip_iterator(thrust::make_tuple(values_last,    head_flags + n)),
+         thrust::make_zip_iterator(thrust::make_tuple(scanned_values, scanned_tail_flags)),
+         detail::reduce_by_key_functor<ValueType, FlagType, BinaryFunction>(binary_op));
+
+    thrust::exclusive_scan(tail_flags, tail_flags + n, scanned_tail_flags, FlagType(0), thrust::plus<FlagType>());
+
+    // number of unique keys
+    FlagType N = scanned_tail_flags[n - 1] + 1;
+    
+    // scatter the keys and accumulated values    
+    thrust::scatter_if(keys_first,     keys_last,          scanned_tail_flags, head_flags, keys_output);
+    thrust::scatter_if(scanned_values, scanned_values + n, scanned_tail_flags, tail_flags, values_output);
+
+    return thrust::make_pair(keys_output + N, values_output + N); 
+} // end reduce_by_key_with_storage()
+
 } // end namespace detail
 
 
@@ -123,38 +188,90 @@ template<typename InputIterator1,
     // input size
     difference_type n = keys_last - keys_first;
 
-    InputIterator2 values_last = values_first + n;
-    
-    // compute head flags
-    thrust::detail::temporary_array<FlagType,System> head_flags(n);
-    thrust::transform(keys_first, keys_last - 1, keys_first + 1, head_flags.begin() + 1, thrust::detail::not2(binary_pred));
-    head_flags[0] = 1;
+    // the head, tail, and scanned tail flags share a single array. if there is too little
+    // memory for arrays as large as the input, the input is reduced in chunks into arrays
+    // of the keys and values of each chunk's segments, whose last is joined to the next chunk's
+    thrust::detail::temporary_array<FlagType,System>  flags(0);
+    thrust::detail::temporary_array<ValueType,System> scanned_values(0);
+    thrust::detail::temporary_array<KeyType,System>   keys_temp(0);
+    thrust::detail::temporary_array<ValueType,System> values_temp(0);
 
-    // compute tail flags
-    thrust::detail::temporary_array<FlagType,System> tail_flags(n); //COPY INSTEAD OF TRANSFORM
-    thrust::transform(keys_first, keys_last - 1, keys_first + 1, tail_flags.begin(), thrust::detail::not2(binary_pred));
-    tail_flags[n-1] = 1;
+    difference_type chunk = n;
+    for(; chunk > 0; chunk /= 2)
+    {
+        if(flags.try_allocate(3 * chunk))
+        {
+            if(scanned_values.try_allocate(chunk))
+            {
+                if(chunk == n) break;
 
-    // scan the values by flag
-    thrust::detail::temporary_array<ValueType,System> scanned_values(n);
-    thrust::detail::temporary_array<FlagType,System>  scanned_tail_flags(n);
-    
-    thrust::inclusive_scan
-        (thrust::make_zip_iterator(thrust::make_tuple(values_first,           head_flags.begin())),
-         thrust::make_zip_iterator(thrust::make_tuple(values_last,            head_flags.end())),
-         thrust::make_zip_iterator(thrust::make_tuple(scanned_values.begin(), scanned_tail_flags.begin())),
-         detail::reduce_by_key_functor<ValueType, FlagType, BinaryFunction>(binary_op));
+                if(keys_temp.try_allocate(chunk + 1))
+                {
+                    if(values_temp.try_allocate(chunk + 1)) break;
 
-    thrust::exclusive_scan(tail_flags.begin(), tail_flags.end(), scanned_tail_flags.begin(), FlagType(0), thrust::plus<FlagType>());
+                    keys_temp.deallocate();
+                }
 
-    // number of unique keys
-    FlagType N = scanned_tail_flags[n - 1] + 1;
-    
-    // scatter the keys and accumulated values    
-    thrust::scatter_if(keys_first,            keys_last,             scanned_tail_flags.begin(), head_flags.begin(), keys_output);
-    thrust::scatter_if(scanned_values.begin(), scanned_values.end(), scanned_tail_flags.begin(), tail_flags.begin(), values_output);
+                scanned_values.deallocate();
+            }
 
-    return thrust::make_pair(keys_output + N, values_output + N); 
+            flags.deallocate();
+        }
+    }
+
+    if(chunk == 0)
+    {
+        throw thrust::system::detail::bad_alloc("temporary_buffer::allocate: get_temporary_buffer failed");
+    }
+
+    if(chunk == n)
+    {
+        return detail::reduce_by_key_with_storage(keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op, flags.begin(), scanned_values.begin());
+    }
+
+    // the last segment of each chunk but the last is held back at the beginning of the temporary arrays
+    difference_type held = 0;
+
+    for(difference_type i = 0; i < n; i += chunk)
+    {
+        difference_type last = thrust::min(i + chunk, n);
+
+        // check whether the chunk's first segment continues the held segment
+        bool continues = false;
+        if(i > 0)
+        {
+            thrust::transform(keys_first + (i - 1), keys_first + i, keys_first + i, flags.begin(), binary_pred);
+            continues = flags[0] != 0;
+        }
+
+        difference_type num_segments =
+          detail::reduce_by_key_with_storage(keys_first + i, keys_first + last, values_first + i, keys_temp.begin() + held, values_temp.begin() + held, binary_pred, binary_op, flags.begin(), scanned_values.begin()).first - keys_temp.begin();
+
+        difference_type first_segment = 0;
+        if(continues)
+        {
+            // join the held segment to the first of this chunk
+            thrust::transform(values_temp.begin(), values_temp.begin() + 1, values_temp.begin() + 1, values_temp.begin() + 1, binary_op);
+            thrust::copy(keys_temp.begin(), keys_temp.begin() + 1, keys_temp.begin() + 1);
+            first_segment = 1;
+        }
+
+        difference_type last_segment = (last < n) ? num_segments - 1 : num_segments;
+
+        keys_output   = thrust::copy(keys_temp.begin()   + first_segment, keys_temp.begin()   + last_segment, keys_output);
+        values_output = thrust::copy(values_temp.begin() + first_segment, values_temp.begin() + last_segment, values_output);
+
+        if(last < n)
+        {
+            thrust::copy(keys_temp.begin()   + last_segment, keys_temp.begin()   + num_segments, keys_temp.begin());
+            thrust::copy(values_temp.begin() + last_segment, values_temp.begin() + num_segments, values_temp.begin());
+            held = 1;
+        }
+    }
+
+    thrust::system::detail::internal::record_low_memory_mode(thrust::low_memory_monitor::reduced_buffer);
+
+    return thrust::make_pair(keys_output, values_output);
 } // end reduce_by_key()
 
 
@@ -0,0 +1,199 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file bulk_memory.h
+ *  \brief Helpers for splitting copies and fills of plain-old-data among threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/detail/is_trivial_iterator.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/scalar/trivial_copy.h>
+#include <thrust/system/detail/internal/scalar/trivial_fill.h>
+#include <cstddef>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif // __linux__
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace bulk_memory_detail
+{
+
+// assumed when the platform does not report the size of its caches
+const std::size_t default_cache_size = 8 << 20;
+
+inline std::size_t query_last_level_cache_size()
+{
+  long result = 0;
+
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+  result = sysconf(_SC_LEVEL3_CACHE_SIZE);
+
+  if(result <= 0)
+  {
+    result = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  }
+#endif // __linux__
+
+  return (result > 0) ? static_cast<std::size_t>(result) : default_cache_size;
+} // end query_last_level_cache_size()
+
+} // end bulk_memory_detail
+
+
+// threads are handed whole pages, so that no two of them write to the same page
+const std::size_t page_size = 4096;
+
+// moving fewer bytes than this is not worth waking other threads for
+const std::size_t min_parallel_bytes = 1 << 18;
+
+
+inline std::size_t last_level_cache_size()
+{
+  static const std::size_t result = bulk_memory_detail::query_last_level_cache_size();
+  return result;
+} // end last_level_cache_size()
+
+
+// a destination larger than the cache would only evict everything else from
+// it before being evicted itself, so it is written around the cache instead
+inline bool use_streaming_stores(std::size_t num_bytes)
+{
+  return num_bytes > last_level_cache_size();
+} // end use_streaming_stores()
+
+
+// a trivial fill's iterator is a normal_iterator
+// and its value_type has_trivial_assign
+template<typename OutputIterator>
+  struct is_trivial_fill
+    : thrust::detail::integral_constant<
+        bool,
+        thrust::detail::is_trivial_iterator<OutputIterator>::value &&
+        thrust::detail::has_trivial_assign<typename thrust::iterator_value<OutputIterator>::type>::value
+      >
+{};
+
+
+template<typename T>
+  bool overlaps(const T *first1, const T *first2, std::ptrdiff_t n)
+{
+  return first1 < first2 + n && first2 < first1 + n;
+} // end overlaps()
+
+
+// describes the pages spanned by the array [ptr, ptr + n) and maps
+// the boundaries between pages to indices of the array's elements
+template<typename T>
+  class page_decomposition
+{
+  public:
+    typedef std::ptrdiff_t          index_type;
+    typedef index_range<index_type> range_type;
+
+    page_decomposition(const T *ptr, index_type n)
+      : m_n(n)
+    {
+      const thrust::detail::uintptr_t first = thrust::detail::uintptr_t(ptr);
+      const thrust::detail::uintptr_t last  = first + n * sizeof(T);
+
+      m_base      = first - first % page_size;
+      m_offset    = first - m_base;
+      m_num_pages = (last - m_base + page_size - 1) / page_size;
+    }
+
+    // the number of pages the array touches
+    index_type size(void) const
+    {
+      return m_num_pages;
+    }
+
+    // the index of the first element which begins on or after page i
+    index_type element(index_type i) const
+    {
+      if(i == 0) return 0;
+
+      const index_type bytes  = i * index_type(page_size) - index_type(m_offset);
+      const index_type result = (bytes + index_type(sizeof(T)) - 1) / index_type(sizeof(T));
+
+      return (result < m_n) ? result : m_n;
+    }
+
+    // the elements which begin within pages [begin, end)
+    range_type operator()(index_type begin, index_type end) const
+    {
+      return range_type(element(begin), element(end));
+    }
+
+  private:
+    index_type m_n;
+    index_type m_num_pages;
+    thrust::detail::uintptr_t m_base;
+    thrust::detail::uintptr_t m_offset;
+};
+
+
+template<typename T>
+  void copy_interval(const T *first,
+                     T *result,
+                     const index_range<std::ptrdiff_t> &interval,
+                     bool streaming)
+{
+  if(streaming)
+  {
+    thrust::system::detail::internal::scalar::streaming_copy_n(first + interval.begin(), interval.size(), result + interval.begin());
+  }
+  else
+  {
+    thrust::system::detail::internal::scalar::trivial_copy_n(first + interval.begin(), interval.size(), result + interval.begin());
+  }
+} // end copy_interval()
+
+
+template<typename T>
+  void fill_interval(T *first,
+                     const index_range<std::ptrdiff_t> &interval,
+                     const T &value,
+                     bool streaming)
+{
+  if(streaming)
+  {
+    thrust::system::detail::internal::scalar::streaming_fill_n(first + interval.begin(), interval.size(), value);
+  }
+  else
+  {
+    thrust::system::detail::internal::scalar::trivial_fill_n(first + interval.begin(), interval.size(), value);
+  }
+} // end fill_interval()
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
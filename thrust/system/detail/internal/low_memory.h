@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file low_memory.h
+ *  \brief Allocating as much temporary storage as is available, so that
+ *         algorithms may run with less than they would like.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/low_memory_monitor.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// allocates storage for n elements in the empty temporary_array buffer, halving the request
+// after each failure until it falls below min_n, and returns the mode the caller may run in
+template<typename T,
+         typename System,
+         typename Size>
+  thrust::low_memory_monitor::mode
+    allocate_at_most(thrust::detail::temporary_array<T,System> &buffer,
+                     Size n,
+                     Size min_n = 1)
+{
+  for(Size size = n; size > 0 && size >= min_n; size /= 2)
+  {
+    if(buffer.try_allocate(size))
+    {
+      return (size == n) ? thrust::low_memory_monitor::full_buffer : thrust::low_memory_monitor::reduced_buffer;
+    } // end if
+  } // end for
+
+  return (n > 0) ? thrust::low_memory_monitor::no_buffer : thrust::low_memory_monitor::full_buffer;
+} // end allocate_at_most()
+
+
+// allocates storage for the same number of elements, at most n, in both empty temporary_arrays
+template<typename T1,
+         typename System1,
+         typename T2,
+         typename System2,
+         typename Size>
+  thrust::low_memory_monitor::mode
+    allocate_at_most(thrust::detail::temporary_array<T1,System1> &buffer1,
+                     thrust::detail::temporary_array<T2,System2> &buffer2,
+                     Size n,
+                     Size min_n = 1)
+{
+  for(Size size = n; size > 0 && size >= min_n; size /= 2)
+  {
+    if(buffer1.try_allocate(size))
+    {
+      if(buffer2.try_allocate(size))
+      {
+        return (size == n) ? thrust::low_memory_monitor::full_buffer : thrust::low_memory_monitor::reduced_buffer;
+      } // end if
+
+      buffer1.deallocate();
+    } // end if
+  } // end for
+
+  return (n > 0) ? thrust::low_memory_monitor::no_buffer : thrust::low_memory_monitor::full_buffer;
+} // end allocate_at_most()
+
+
+// records the mode an algorithm ran in with the calling thread's low_memory_monitors
+inline void record_low_memory_mode(thrust::low_memory_monitor::mode mode)
+{
+  thrust::detail::low_memory_monitor_access::record(mode);
+} // end record_low_memory_mode()
+
+
+// the fallbacks of the threads of a parallel algorithm, which each observe their own with
+// a detached low_memory_monitor, to be recorded by the thread which dispatched it
+class parallel_low_memory_record
+{
+  public:
+    parallel_low_memory_record()
+      : m_worst_mode(thrust::low_memory_monitor::full_buffer),
+        m_num_fallbacks(0)
+    {}
+
+    // the caller serializes the calls to add
+    void add(const thrust::low_memory_monitor &monitor)
+    {
+      if(monitor.worst_mode() > m_worst_mode)
+      {
+        m_worst_mode = monitor.worst_mode();
+      } // end if
+
+      m_num_fallbacks += monitor.num_fallbacks();
+    }
+
+    void record() const
+    {
+      if(m_num_fallbacks > 0)
+      {
+        thrust::detail::low_memory_monitor_access::record(m_worst_mode, m_num_fallbacks);
+      } // end if
+    }
+
+  private:
+    thrust::low_memory_monitor::mode m_worst_mode;
+    std::size_t m_num_fallbacks;
+}; // end parallel_low_memory_record
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file multisequence_partition.h
+ *  \brief Splitting the merge of many sorted ranges among threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/pair.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/scalar/binary_search.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// finds how many elements of each of n sorted ranges are among the first rank elements of
+// their stable merge, in which equivalent elements of earlier ranges come first, so that
+// the merge may be divided into independent merges of the pieces of the ranges on either
+// side of the splits
+// splits and scratch point to storage for n and 2 * n positions, respectively
+//
+// the splits are narrowed to an interval of each range by repeatedly bisecting the widest
+// interval: the position of the element at its middle in every other range bounds their
+// splits from below if the element is among the first rank, and from above otherwise
+template<typename InputIterator,
+         typename Size,
+         typename Difference,
+         typename StrictWeakOrdering>
+  void multisequence_partition(const thrust::pair<InputIterator,InputIterator> *ranges,
+                               Size n,
+                               Difference rank,
+                               Difference *splits,
+                               Difference *scratch,
+                               StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+
+  Difference *lower    = splits;
+  Difference *upper    = scratch;
+  Difference *position = scratch + n;
+
+  Difference sum_lower = 0;
+  Difference sum_upper = 0;
+
+  for(Size i = 0; i < n; ++i)
+  {
+    lower[i] = 0;
+    upper[i] = ranges[i].second - ranges[i].first;
+    sum_upper += upper[i];
+  } // end for
+
+  while(sum_lower < rank && rank < sum_upper)
+  {
+    // the widest interval is not empty, since the sums differ
+    Size j = 0;
+    for(Size i = 1; i < n; ++i)
+    {
+      if(upper[i] - lower[i] > upper[j] - lower[j]) j = i;
+    } // end for
+
+    Difference middle = lower[j] + (upper[j] - lower[j]) / 2;
+
+    const value_type pivot = ranges[j].first[middle];
+
+    // the number of elements of each range which precede the pivot in the merge,
+    // clamped to the interval of that range
+    Difference sum = 0;
+
+    for(Size i = 0; i < n; ++i)
+    {
+      InputIterator first = ranges[i].first;
+
+      if(i < j)
+      {
+        position[i] = thrust::system::detail::internal::scalar::upper_bound(first + lower[i], first + upper[i], pivot, comp) - first;
+      } // end if
+      else if(i > j)
+      {
+        position[i] = thrust::system::detail::internal::scalar::lower_bound(first + lower[i], first + upper[i], pivot, comp) - first;
+      } // end else if
+      else
+      {
+        position[i] = middle;
+      } // end else
+
+      sum += position[i];
+    } // end for
+
+    if(sum < rank)
+    {
+      // the pivot and everything before it are among the first rank elements
+      for(Size i = 0; i < n; ++i) lower[i] = position[i];
+      lower[j] = middle + 1;
+    } // end if
+    else
+    {
+      // the pivot and everything after it are not
+      for(Size i = 0; i < n; ++i) upper[i] = position[i];
+      upper[j] = middle;
+    } // end else
+
+    sum_lower = 0;
+    sum_upper = 0;
+
+    for(Size i = 0; i < n; ++i)
+    {
+      sum_lower += lower[i];
+      sum_upper += upper[i];
+    } // end for
+  } // end while
+
+  if(sum_lower != rank)
+  {
+    for(Size i = 0; i < n; ++i) splits[i] = upper[i];
+  } // end if
+} // end multisequence_partition()
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
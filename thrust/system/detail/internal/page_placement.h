@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file page_placement.h
+ *  \brief Helpers for placing the pages of host memory on the
+ *         memory nodes of the machine.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/util/align.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <cstddef>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif // __linux__
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace page_placement_detail
+{
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+
+// from <linux/mempolicy.h>, which is not always installed
+const int mpol_interleave       = 3;
+const int mpol_f_mems_allowed   = 1 << 2;
+
+// enough for the largest number of nodes the kernel may be configured with
+const unsigned long max_nodes   = 1024;
+const std::size_t   mask_length = max_nodes / (8 * sizeof(unsigned long));
+
+// the nodes the calling thread may allocate memory from
+inline bool get_allowed_nodes(unsigned long *mask)
+{
+  int mode = 0;
+
+  return syscall(SYS_get_mempolicy, &mode, mask, max_nodes, 0, mpol_f_mems_allowed) == 0;
+} // end get_allowed_nodes()
+
+#endif // __linux__
+
+} // end page_placement_detail
+
+
+// faults in the pages spanned by the elements of interval on behalf of the calling
+// thread by writing a zero to the first byte of each which belongs to those elements
+// the array must be uninitialized, since those bytes are lost
+template<typename T>
+  void touch_pages(T *first, const index_range<std::ptrdiff_t> &interval)
+{
+  volatile char *begin = reinterpret_cast<volatile char*>(first + interval.begin());
+  volatile char *end   = reinterpret_cast<volatile char*>(first + interval.end());
+
+  if(begin >= end) return;
+
+  *begin = 0;
+
+  for(volatile char *page = thrust::detail::util::align_up(begin + 1, page_size);
+      page < end;
+      page += page_size)
+  {
+    *page = 0;
+  } // end for
+} // end touch_pages()
+
+
+// asks the system to place the pages of [ptr, ptr + num_bytes) which are not yet
+// faulted in round-robin across the memory nodes the calling thread may use
+// returns false if the system does not support it, in which case nothing is done
+// pages shared with neighboring allocations are left alone
+inline bool interleave_pages(void *ptr, std::size_t num_bytes)
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+  namespace placement = page_placement_detail;
+
+  char *begin = thrust::detail::util::align_up(static_cast<char*>(ptr), page_size);
+  char *end   = thrust::detail::util::align_down(static_cast<char*>(ptr) + num_bytes, page_size);
+
+  if(begin >= end) return true;
+
+  unsigned long mask[placement::mask_length] = {0};
+
+  if(!placement::get_allowed_nodes(mask)) return false;
+
+  return syscall(SYS_mbind, begin, end - begin, placement::mpol_interleave, mask, placement::max_nodes, 0) == 0;
+#else
+  return false;
+#endif // __linux__
+} // end interleave_pages()
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
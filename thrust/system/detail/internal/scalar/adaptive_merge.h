@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file adaptive_merge.h
+ *  \brief Sequential merge of adjacent sorted ranges in place, with as
+ *         much temporary storage as is available.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/low_memory.h>
+#include <thrust/system/detail/internal/scalar/binary_search.h>
+#include <thrust/system/detail/internal/scalar/copy.h>
+#include <thrust/system/detail/internal/scalar/merge.h>
+#include <thrust/system/detail/internal/scalar/rotate.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace adaptive_merge_detail
+{
+
+
+// merges the adjacent sorted ranges [first, middle) and [middle, last) with a buffer of
+// buffer_size elements, which may be empty. when the left range fits in the buffer, it is
+// moved there and merged back. otherwise, the ranges are cut at the middle of the longer
+// and the corresponding position in the shorter, the pieces between the cuts are exchanged
+// by rotation, and the ranges on either side of the cuts are merged separately
+template<typename RandomAccessIterator,
+         typename BufferIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+void merge_with_buffer(RandomAccessIterator first,
+                       RandomAccessIterator middle,
+                       RandomAccessIterator last,
+                       BufferIterator buffer,
+                       Size buffer_size,
+                       StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  while(first != middle && middle != last)
+  {
+    const difference_type n1 = middle - first;
+    const difference_type n2 = last - middle;
+
+    if(n1 <= static_cast<difference_type>(buffer_size))
+    {
+      // the output never overtakes the unmerged part of the right range
+      BufferIterator buffer_last = thrust::system::detail::internal::scalar::copy(first, middle, buffer);
+
+      thrust::system::detail::internal::scalar::merge(buffer, buffer_last, middle, last, first, comp);
+
+      return;
+    } // end if
+
+    if(n1 + n2 == 2)
+    {
+      if(comp(*middle, *first))
+      {
+        value_type temp = *first;
+        *first  = *middle;
+        *middle = temp;
+      } // end if
+
+      return;
+    } // end if
+
+    RandomAccessIterator cut1, cut2;
+
+    if(n1 > n2)
+    {
+      cut1 = first + n1 / 2;
+      value_type pivot = *cut1;
+      cut2 = thrust::system::detail::internal::scalar::lower_bound(middle, last, pivot, comp);
+    } // end if
+    else
+    {
+      cut2 = middle + n2 / 2;
+      value_type pivot = *cut2;
+      cut1 = thrust::system::detail::internal::scalar::upper_bound(first, middle, pivot, comp);
+    } // end else
+
+    RandomAccessIterator new_middle = thrust::system::detail::internal::scalar::rotate(cut1, middle, cut2);
+
+    // recurse into the shorter side and loop on the longer, to keep the recursion shallow
+    if(new_middle - first < last - new_middle)
+    {
+      merge_with_buffer(first, cut1, new_middle, buffer, buffer_size, comp);
+
+      first  = new_middle;
+      middle = cut2;
+    } // end if
+    else
+    {
+      merge_with_buffer(new_middle, cut2, last, buffer, buffer_size, comp);
+
+      middle = cut1;
+      last   = new_middle;
+    } // end else
+  } // end while
+} // end merge_with_buffer()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BufferIterator1,
+         typename BufferIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void merge_with_buffer_by_key(RandomAccessIterator1 first1,
+                              RandomAccessIterator1 middle1,
+                              RandomAccessIterator1 last1,
+                              RandomAccessIterator2 first2,
+                              BufferIterator1 buffer1,
+                              BufferIterator2 buffer2,
+                              Size buffer_size,
+                              StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      value_type1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      value_type2;
+
+  while(first1 != middle1 && middle1 != last1)
+  {
+    const difference_type n1 = middle1 - first1;
+    const difference_type n2 = last1 - middle1;
+
+    RandomAccessIterator2 middle2 = first2 + n1;
+
+    if(n1 <= static_cast<difference_type>(buffer_size))
+    {
+      // the output never overtakes the unmerged part of the right range
+      BufferIterator1 buffer1_last = thrust::system::detail::internal::scalar::copy(first1, middle1, buffer1);
+      thrust::system::detail::internal::scalar::copy(first2, middle2, buffer2);
+
+      thrust::system::detail::internal::scalar::merge_by_key
+        (buffer1, buffer1_last, middle1, last1,
+         buffer2, middle2,
+         first1, first2, comp);
+
+      return;
+    } // end if
+
+    if(n1 + n2 == 2)
+    {
+      if(comp(*middle1, *first1))
+      {
+        value_type1 temp1 = *first1;
+        *first1  = *middle1;
+        *middle1 = temp1;
+
+        value_type2 temp2 = *first2;
+        *first2  = *middle2;
+        *middle2 = temp2;
+      } // end if
+
+      return;
+    } // end if
+
+    RandomAccessIterator1 cut1, cut2;
+
+    if(n1 > n2)
+    {
+      cut1 = first1 + n1 / 2;
+      value_type1 pivot = *cut1;
+      cut2 = thrust::system::detail::internal::scalar::lower_bound(middle1, last1, pivot, comp);
+    } // end if
+    else
+    {
+      cut2 = middle1 + n2 / 2;
+      value_type1 pivot = *cut2;
+      cut1 = thrust::system::detail::internal::scalar::upper_bound(first1, middle1, pivot, comp);
+    } // end else
+
+    RandomAccessIterator1 new_middle1 = thrust::system::detail::internal::scalar::rotate(cut1, middle1, cut2);
+    thrust::system::detail::internal::scalar::rotate(first2 + (cut1 - first1), middle2, first2 + (cut2 - first1));
+
+    RandomAccessIterator2 new_middle2 = first2 + (new_middle1 - first1);
+
+    // recurse into the shorter side and loop on the longer, to keep the recursion shallow
+    if(new_middle1 - first1 < last1 - new_middle1)
+    {
+      merge_with_buffer_by_key(first1, cut1, new_middle1, first2, buffer1, buffer2, buffer_size, comp);
+
+      first1  = new_middle1;
+      middle1 = cut2;
+      first2  = new_middle2;
+    } // end if
+    else
+    {
+      merge_with_buffer_by_key(new_middle1, cut2, last1, new_middle2, buffer1, buffer2, buffer_size, comp);
+
+      middle1 = cut1;
+      last1   = new_middle1;
+    } // end else
+  } // end while
+} // end merge_with_buffer_by_key()
+
+
+} // end adaptive_merge_detail
+
+
+// merges the adjacent sorted ranges [first, middle) and [middle, last) in place, stably,
+// with a buffer for the left range if one can be allocated, or else with a smaller one,
+// or none, and records the mode it ran in
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void adaptive_merge(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering &comp)
+{
+  // XXX the type of system should be:
+  //     typedef decltype(select_system(first, middle, last)) system;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type  value_type;
+
+  thrust::detail::temporary_array<value_type, system> buffer(0);
+
+  thrust::low_memory_monitor::mode mode = thrust::system::detail::internal::allocate_at_most(buffer, middle - first);
+
+  adaptive_merge_detail::merge_with_buffer(first, middle, last, buffer.begin(), buffer.size(), comp);
+
+  thrust::system::detail::internal::record_low_memory_mode(mode);
+} // end adaptive_merge()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void adaptive_merge_by_key(RandomAccessIterator1 first1,
+                           RandomAccessIterator1 middle1,
+                           RandomAccessIterator1 last1,
+                           RandomAccessIterator2 first2,
+                           StrictWeakOrdering &comp)
+{
+  // XXX the type of system should be:
+  //     typedef decltype(select_system(first1, first2)) system;
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type system;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type  value_type1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type  value_type2;
+
+  thrust::detail::temporary_array<value_type1, system> buffer1(0);
+  thrust::detail::temporary_array<value_type2, system> buffer2(0);
+
+  thrust::low_memory_monitor::mode mode = thrust::system::detail::internal::allocate_at_most(buffer1, buffer2, middle1 - first1);
+
+  adaptive_merge_detail::merge_with_buffer_by_key(first1, middle1, last1, first2, buffer1.begin(), buffer2.begin(), buffer1.size(), comp);
+
+  thrust::system::detail::internal::record_low_memory_mode(mode);
+} // end adaptive_merge_by_key()
+
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
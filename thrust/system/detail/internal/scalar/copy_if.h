@@ -21,7 +21,12 @@
 #pragma once
 
 #include <thrust/detail/config.h>
-#include <thrust/detail/raw_apply.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/detail/dispatch/is_trivial_copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/scalar/trivial_copy_if.h>
 
 namespace thrust
 {
@@ -34,6 +39,32 @@ namespace internal
 namespace scalar
 {
 
+namespace copy_if_detail
+{
+
+
+// returns the raw pointer associated with a Pointer-like thing
+template<typename Pointer>
+  typename thrust::detail::pointer_traits<Pointer>::raw_pointer
+    get(Pointer ptr)
+{
+  return thrust::detail::pointer_traits<Pointer>::get(ptr);
+}
+
+
+// compaction of contiguous 4- and 8-byte plain-old-data goes through trivial_copy_if_n
+template<typename InputIterator,
+         typename OutputIterator>
+  struct is_trivial_copy_if :
+    thrust::detail::integral_constant<
+      bool,
+      thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::value
+      && (sizeof(typename thrust::iterator_value<InputIterator>::type) == 4 ||
+          sizeof(typename thrust::iterator_value<InputIterator>::type) == 8)
+    >
+{};
+
+
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
@@ -42,11 +73,38 @@ template<typename InputIterator1,
                          InputIterator1 last,
                          InputIterator2 stencil,
                          OutputIterator result,
-                         Predicate pred)
+                         Predicate pred,
+                         thrust::detail::true_type) // is_trivial_copy_if
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0)
+    return result;
+
+  typedef typename thrust::iterator_value<OutputIterator>::type OutputType;
+
+  OutputType *raw_result = get(&*result);
+
+  return result + (thrust::system::detail::internal::scalar::trivial_copy_if_n(get(&*first), n, stencil, raw_result, pred) - raw_result);
+} // end copy_if()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator copy_if(InputIterator1 first,
+                         InputIterator1 last,
+                         InputIterator2 stencil,
+                         OutputIterator result,
+                         Predicate pred,
+                         thrust::detail::false_type) // is_trivial_copy_if
 {
   while(first != last)
   {
-    if(thrust::detail::raw_apply<bool>(pred,*stencil))
+    if(pred(*stencil))
     {
       *result = *first;
       ++result;
@@ -59,6 +117,30 @@ template<typename InputIterator1,
   return result;
 } // end copy_if()
 
+
+} // end namespace copy_if_detail
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator copy_if(InputIterator1 first,
+                         InputIterator1 last,
+                         InputIterator2 stencil,
+                         OutputIterator result,
+                         Predicate pred)
+{
+  // wrap pred
+  thrust::detail::host_function<
+    Predicate,
+    bool
+  > wrapped_pred(pred);
+
+  return thrust::system::detail::internal::scalar::copy_if_detail::copy_if(first, last, stencil, result, wrapped_pred,
+    typename copy_if_detail::is_trivial_copy_if<InputIterator1,OutputIterator>::type());
+} // end copy_if()
+
 } // end namespace scalar
 } // end namespace internal
 } // end namespace detail
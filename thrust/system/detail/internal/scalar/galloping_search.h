@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file galloping_search.h
+ *  \brief Sequential exponential search for merging ranges of skewed sizes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace galloping_search_detail
+{
+
+// galloping costs about two comparisons per step of the shorter range for each
+// doubling of the distance skipped, so it only pays off once one range is
+// substantially longer than the other
+const int skew_ratio = 16;
+
+
+// bisects [first + lo, first + hi) for the first position at which
+// pred(first[i]) is false, given that it holds for every earlier position
+template<typename RandomAccessIterator,
+         typename Size,
+         typename Predicate>
+RandomAccessIterator partition_point(RandomAccessIterator first,
+                                     Size lo,
+                                     Size hi,
+                                     Predicate pred)
+{
+  while(lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+
+    if(pred(first[mid]))
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return first + lo;
+}
+
+
+template<typename T,
+         typename StrictWeakOrdering>
+  struct precedes
+{
+  const T &val;
+  StrictWeakOrdering &comp;
+
+  precedes(const T &val, StrictWeakOrdering &comp)
+    : val(val), comp(comp)
+  {}
+
+  template<typename Reference>
+  bool operator()(const Reference &x)
+  {
+    return comp(x, val);
+  }
+};
+
+
+template<typename T,
+         typename StrictWeakOrdering>
+  struct does_not_follow
+{
+  const T &val;
+  StrictWeakOrdering &comp;
+
+  does_not_follow(const T &val, StrictWeakOrdering &comp)
+    : val(val), comp(comp)
+  {}
+
+  template<typename Reference>
+  bool operator()(const Reference &x)
+  {
+    return !comp(val, x);
+  }
+};
+
+
+// probes first[0], first[2], first[6], first[14], ... until pred fails, then
+// bisects the last interval
+template<typename RandomAccessIterator,
+         typename Predicate>
+RandomAccessIterator gallop(RandomAccessIterator first,
+                            RandomAccessIterator last,
+                            Predicate pred)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // pred holds for [first, first + lo)
+  difference_type lo = 0;
+  difference_type hi = 1;
+
+  while(hi <= n && pred(first[hi - 1]))
+  {
+    lo = hi;
+    hi = 2 * hi + 1;
+  }
+
+  // the result lies in [first + lo, first + hi]
+  hi = (hi <= n) ? hi - 1 : n;
+
+  return partition_point(first, lo, hi, pred);
+}
+
+} // end namespace galloping_search_detail
+
+
+// galloping advances iterators by arbitrary distances
+template<typename InputIterator1,
+         typename InputIterator2>
+  struct use_galloping
+    : thrust::detail::integral_constant<
+        bool,
+        thrust::detail::is_convertible<
+          typename thrust::iterator_traversal<InputIterator1>::type,
+          thrust::random_access_traversal_tag
+        >::value &&
+        thrust::detail::is_convertible<
+          typename thrust::iterator_traversal<InputIterator2>::type,
+          thrust::random_access_traversal_tag
+        >::value
+      >
+{};
+
+
+// returns true when one of two ranges of lengths n1 and n2 is long enough,
+// relative to the other, that searching it beats walking it
+template<typename Size1,
+         typename Size2>
+  bool is_skewed(Size1 n1, Size2 n2)
+{
+  return n1 / galloping_search_detail::skew_ratio > n2 ||
+         n2 / galloping_search_detail::skew_ratio > n1;
+}
+
+
+// equivalent to lower_bound, but searches outward from first before bisecting,
+// so the cost is logarithmic in the distance of the result from first rather
+// than in the length of the range
+template<typename RandomAccessIterator,
+         typename T,
+         typename StrictWeakOrdering>
+RandomAccessIterator gallop_lower_bound(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T &val,
+                                        StrictWeakOrdering &comp)
+{
+  return galloping_search_detail::gallop(first, last, galloping_search_detail::precedes<T,StrictWeakOrdering>(val, comp));
+} // end gallop_lower_bound()
+
+
+// equivalent to upper_bound, with the cost of gallop_lower_bound
+template<typename RandomAccessIterator,
+         typename T,
+         typename StrictWeakOrdering>
+RandomAccessIterator gallop_upper_bound(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T &val,
+                                        StrictWeakOrdering &comp)
+{
+  return galloping_search_detail::gallop(first, last, galloping_search_detail::does_not_follow<T,StrictWeakOrdering>(val, comp));
+} // end gallop_upper_bound()
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
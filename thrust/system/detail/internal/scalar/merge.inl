@@ -17,6 +17,9 @@
 #include <thrust/iterator/iterator_traits.h>
 
 #include <thrust/system/detail/internal/scalar/copy.h>
+#include <thrust/system/detail/internal/scalar/galloping_search.h>
+#include <thrust/iterator/detail/is_trivial_iterator.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/detail/function.h>
 
 namespace thrust
@@ -30,26 +33,63 @@ namespace internal
 namespace scalar
 {
 
+namespace merge_detail
+{
+
+
+// primitive keys read through raw pointers are merged without branching on
+// the comparison, which is mispredicted half the time on random input
+template<typename InputIterator1,
+         typename InputIterator2>
+  struct use_branchless_merge
+    : thrust::detail::integral_constant<
+        bool,
+        thrust::detail::is_trivial_iterator<InputIterator1>::value &&
+        thrust::detail::is_trivial_iterator<InputIterator2>::value &&
+        thrust::detail::is_arithmetic<typename thrust::iterator_value<InputIterator1>::type>::value &&
+        thrust::detail::is_same<
+          typename thrust::iterator_value<InputIterator1>::type,
+          typename thrust::iterator_value<InputIterator2>::type
+        >::value
+      >
+{};
+
+
+// the values are selected alongside the keys, so they must be cheap to load too
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4>
+  struct use_branchless_merge_by_key
+    : thrust::detail::integral_constant<
+        bool,
+        use_branchless_merge<InputIterator1,InputIterator2>::value &&
+        thrust::detail::is_trivial_iterator<InputIterator3>::value &&
+        thrust::detail::is_trivial_iterator<InputIterator4>::value &&
+        thrust::detail::is_pod<typename thrust::iterator_value<InputIterator3>::type>::value &&
+        thrust::detail::is_same<
+          typename thrust::iterator_value<InputIterator3>::type,
+          typename thrust::iterator_value<InputIterator4>::type
+        >::value
+      >
+{};
+
+
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-OutputIterator merge(InputIterator1 first1,
-                     InputIterator1 last1,
-                     InputIterator2 first2,
-                     InputIterator2 last2,
-                     OutputIterator result,
-                     StrictWeakOrdering comp)
+OutputIterator linear_merge(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering &comp,
+                            thrust::detail::false_type) // use_branchless_merge
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first2, *first1))
+    if(comp(*first2, *first1))
     {
       *result = *first2;
       ++first2;
@@ -64,7 +104,39 @@ OutputIterator merge(InputIterator1 first1,
   } // end while
 
   return thrust::system::detail::internal::scalar::copy(first2, last2, thrust::system::detail::internal::scalar::copy(first1, last1, result));
-} // end merge()
+} // end linear_merge()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator linear_merge(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering &comp,
+                            thrust::detail::true_type) // use_branchless_merge
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type value_type;
+
+  while(first1 != last1 && first2 != last2)
+  {
+    const value_type a = *first1;
+    const value_type b = *first2;
+
+    const bool take_b = comp(b, a);
+
+    *result = take_b ? b : a;
+
+    first1 += !take_b;
+    first2 +=  take_b;
+    ++result;
+  } // end while
+
+  return thrust::system::detail::internal::scalar::copy(first2, last2, thrust::system::detail::internal::scalar::copy(first1, last1, result));
+} // end linear_merge()
 
 
 template <typename InputIterator1,
@@ -75,25 +147,20 @@ template <typename InputIterator1,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 thrust::pair<OutputIterator1,OutputIterator2>
-    merge_by_key(InputIterator1 first1,
-                 InputIterator1 last1,
-                 InputIterator2 first2,
-                 InputIterator2 last2,
-                 InputIterator3 first3,
-                 InputIterator4 first4,
-                 OutputIterator1 output1,
-                 OutputIterator2 output2,
-                 StrictWeakOrdering comp)
+    linear_merge_by_key(InputIterator1 first1,
+                        InputIterator1 last1,
+                        InputIterator2 first2,
+                        InputIterator2 last2,
+                        InputIterator3 first3,
+                        InputIterator4 first4,
+                        OutputIterator1 output1,
+                        OutputIterator2 output2,
+                        StrictWeakOrdering &comp,
+                        thrust::detail::false_type) // use_branchless_merge
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(!wrapped_comp(*first2, *first1))
+    if(!comp(*first2, *first1))
     {
       // *first1 <= *first2
       *output1 = *first1;
@@ -137,6 +204,327 @@ thrust::pair<OutputIterator1,OutputIterator2>
   return thrust::make_pair(output1, output2);
 }
 
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    linear_merge_by_key(InputIterator1 first1,
+                        InputIterator1 last1,
+                        InputIterator2 first2,
+                        InputIterator2 last2,
+                        InputIterator3 first3,
+                        InputIterator4 first4,
+                        OutputIterator1 output1,
+                        OutputIterator2 output2,
+                        StrictWeakOrdering &comp,
+                        thrust::detail::true_type) // use_branchless_merge
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type key_type;
+  typedef typename thrust::iterator_value<InputIterator3>::type value_type;
+
+  while(first1 != last1 && first2 != last2)
+  {
+    const key_type   a = *first1;
+    const key_type   b = *first2;
+    const value_type u = *first3;
+    const value_type v = *first4;
+
+    const bool take_b = comp(b, a);
+
+    *output1 = take_b ? b : a;
+    *output2 = take_b ? v : u;
+
+    first1 += !take_b;
+    first3 += !take_b;
+    first2 +=  take_b;
+    first4 +=  take_b;
+
+    ++output1;
+    ++output2;
+  }
+
+  while(first1 != last1)
+  {
+    *output1 = *first1;
+    *output2 = *first3;
+    ++first1;
+    ++first3;
+    ++output1;
+    ++output2;
+  }
+
+  while(first2 != last2)
+  {
+    *output1 = *first2;
+    *output2 = *first4;
+    ++first2;
+    ++first4;
+    ++output1;
+    ++output2;
+  }
+
+  return thrust::make_pair(output1, output2);
+}
+
+
+// steps through the shorter range and copies the run of the longer range which
+// precedes each of its elements, found by galloping. elements of the first range
+// precede equivalent elements of the second
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator galloping_merge(RandomAccessIterator1 first1,
+                               RandomAccessIterator1 last1,
+                               RandomAccessIterator2 first2,
+                               RandomAccessIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    for(; first1 != last1; ++first1, ++result)
+    {
+      RandomAccessIterator2 mid2 = gallop_lower_bound(first2, last2, *first1, comp);
+      result = thrust::system::detail::internal::scalar::copy(first2, mid2, result);
+      first2 = mid2;
+
+      *result = *first1;
+    } // end for
+  } // end if
+  else
+  {
+    for(; first2 != last2; ++first2, ++result)
+    {
+      RandomAccessIterator1 mid1 = gallop_upper_bound(first1, last1, *first2, comp);
+      result = thrust::system::detail::internal::scalar::copy(first1, mid1, result);
+      first1 = mid1;
+
+      *result = *first2;
+    } // end for
+  } // end else
+
+  return thrust::system::detail::internal::scalar::copy(first2, last2, thrust::system::detail::internal::scalar::copy(first1, last1, result));
+} // end galloping_merge()
+
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    galloping_merge_by_key(RandomAccessIterator1 first1,
+                           RandomAccessIterator1 last1,
+                           RandomAccessIterator2 first2,
+                           RandomAccessIterator2 last2,
+                           RandomAccessIterator3 first3,
+                           RandomAccessIterator4 first4,
+                           OutputIterator1 output1,
+                           OutputIterator2 output2,
+                           StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    for(; first1 != last1; ++first1, ++first3, ++output1, ++output2)
+    {
+      RandomAccessIterator2 mid2 = gallop_lower_bound(first2, last2, *first1, comp);
+      RandomAccessIterator4 mid4 = first4 + (mid2 - first2);
+      output1 = thrust::system::detail::internal::scalar::copy(first2, mid2, output1);
+      output2 = thrust::system::detail::internal::scalar::copy(first4, mid4, output2);
+      first2 = mid2;
+      first4 = mid4;
+
+      *output1 = *first1;
+      *output2 = *first3;
+    } // end for
+  } // end if
+  else
+  {
+    for(; first2 != last2; ++first2, ++first4, ++output1, ++output2)
+    {
+      RandomAccessIterator1 mid1 = gallop_upper_bound(first1, last1, *first2, comp);
+      RandomAccessIterator3 mid3 = first3 + (mid1 - first1);
+      output1 = thrust::system::detail::internal::scalar::copy(first1, mid1, output1);
+      output2 = thrust::system::detail::internal::scalar::copy(first3, mid3, output2);
+      first1 = mid1;
+      first3 = mid3;
+
+      *output1 = *first2;
+      *output2 = *first4;
+    } // end for
+  } // end else
+
+  output1 = thrust::system::detail::internal::scalar::copy(first1, last1, output1);
+  output2 = thrust::system::detail::internal::scalar::copy(first3, first3 + (last1 - first1), output2);
+  output1 = thrust::system::detail::internal::scalar::copy(first2, last2, output1);
+  output2 = thrust::system::detail::internal::scalar::copy(first4, first4 + (last2 - first2), output2);
+
+  return thrust::make_pair(output1, output2);
+} // end galloping_merge_by_key()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering &comp,
+                     thrust::detail::false_type) // use_galloping
+{
+  return linear_merge(first1, last1, first2, last2, result, comp,
+                      typename use_branchless_merge<InputIterator1,InputIterator2>::type());
+} // end merge()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering &comp,
+                     thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_merge(first1, last1, first2, last2, result, comp);
+  } // end if
+
+  return linear_merge(first1, last1, first2, last2, result, comp,
+                      typename use_branchless_merge<InputIterator1,InputIterator2>::type());
+} // end merge()
+
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_by_key(InputIterator1 first1,
+                 InputIterator1 last1,
+                 InputIterator2 first2,
+                 InputIterator2 last2,
+                 InputIterator3 first3,
+                 InputIterator4 first4,
+                 OutputIterator1 output1,
+                 OutputIterator2 output2,
+                 StrictWeakOrdering &comp,
+                 thrust::detail::false_type) // use_galloping
+{
+  return linear_merge_by_key(first1, last1, first2, last2, first3, first4, output1, output2, comp,
+                             typename use_branchless_merge_by_key<InputIterator1,InputIterator2,InputIterator3,InputIterator4>::type());
+} // end merge_by_key()
+
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_by_key(InputIterator1 first1,
+                 InputIterator1 last1,
+                 InputIterator2 first2,
+                 InputIterator2 last2,
+                 InputIterator3 first3,
+                 InputIterator4 first4,
+                 OutputIterator1 output1,
+                 OutputIterator2 output2,
+                 StrictWeakOrdering &comp,
+                 thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_merge_by_key(first1, last1, first2, last2, first3, first4, output1, output2, comp);
+  } // end if
+
+  return linear_merge_by_key(first1, last1, first2, last2, first3, first4, output1, output2, comp,
+                             typename use_branchless_merge_by_key<InputIterator1,InputIterator2,InputIterator3,InputIterator4>::type());
+} // end merge_by_key()
+
+
+} // end namespace merge_detail
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  return thrust::system::detail::internal::scalar::merge_detail::merge
+    (first1, last1, first2, last2, result, wrapped_comp,
+     typename use_galloping<InputIterator1,InputIterator2>::type());
+} // end merge()
+
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_by_key(InputIterator1 first1,
+                 InputIterator1 last1,
+                 InputIterator2 first2,
+                 InputIterator2 last2,
+                 InputIterator3 first3,
+                 InputIterator4 first4,
+                 OutputIterator1 output1,
+                 OutputIterator2 output2,
+                 StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  // the values are advanced alongside the keys, so they must be searchable too
+  typedef thrust::detail::integral_constant<
+    bool,
+    use_galloping<InputIterator1,InputIterator2>::value &&
+    use_galloping<InputIterator3,InputIterator4>::value
+  > use_galloping_by_key;
+
+  return thrust::system::detail::internal::scalar::merge_detail::merge_by_key
+    (first1, last1, first2, last2, first3, first4, output1, output2, wrapped_comp,
+     use_galloping_by_key());
+}
+
 } // end namespace scalar
 } // end namespace internal
 } // end namespace detail
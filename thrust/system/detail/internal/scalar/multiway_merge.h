@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file multiway_merge.h
+ *  \brief Sequential implementation of merging many sorted ranges at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/pair.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+
+// the iterators of ranges may be advanced
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator multiway_merge(thrust::pair<InputIterator,InputIterator> *ranges,
+                              Size n,
+                              OutputIterator result,
+                              StrictWeakOrdering comp);
+
+// the iterators of key_ranges and values may be advanced
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::pair<InputIterator1,InputIterator1> *key_ranges,
+                          InputIterator2 *values,
+                          Size n,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp);
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
+#include <thrust/system/detail/internal/scalar/multiway_merge.inl>
+
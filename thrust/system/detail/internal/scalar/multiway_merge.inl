@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/scalar/multiway_merge.h>
+#include <thrust/system/detail/internal/scalar/merge.h>
+#include <thrust/system/detail/internal/scalar/copy.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <cstddef>
+#include <algorithm>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace multiway_merge_detail
+{
+
+
+// a tournament among the next elements of n ranges. each internal node of the tree
+// remembers the loser of the match played there, so that when the winner's range is
+// advanced, only the log2(n) matches on the path from its leaf to the root are replayed,
+// each against a single stored opponent
+template<typename InputIterator,
+         typename StrictWeakOrdering>
+  class loser_tree
+{
+  public:
+    typedef thrust::pair<InputIterator,InputIterator> range_type;
+
+    // losers points to storage for num_leaves(n) indices
+    loser_tree(range_type *ranges, std::size_t n, std::size_t *losers, StrictWeakOrdering &comp)
+      : m_ranges(ranges),
+        m_num_ranges(n),
+        m_num_leaves(num_leaves(n)),
+        m_losers(losers),
+        m_comp(comp)
+    {
+      m_winner = play(1);
+    }
+
+    // the tree is complete, with empty ranges at the leaves beyond the nth
+    static std::size_t num_leaves(std::size_t n)
+    {
+      std::size_t result = 1;
+
+      while(result < n) result *= 2;
+
+      return result;
+    }
+
+    bool empty() const
+    {
+      return exhausted(m_winner);
+    }
+
+    // the index of the range whose next element is the next of the merge
+    std::size_t winner() const
+    {
+      return m_winner;
+    }
+
+    // replays the winner's matches after its range has been advanced
+    void replay()
+    {
+      std::size_t winner = m_winner;
+
+      for(std::size_t node = (m_num_leaves + winner) / 2; node > 0; node /= 2)
+      {
+        if(beats(m_losers[node], winner))
+        {
+          std::swap(m_losers[node], winner);
+        } // end if
+      } // end for
+
+      m_winner = winner;
+    }
+
+  private:
+    // plays the matches of the subtree rooted at node and returns its winner
+    std::size_t play(std::size_t node)
+    {
+      if(node >= m_num_leaves) return node - m_num_leaves;
+
+      std::size_t a = play(2 * node);
+      std::size_t b = play(2 * node + 1);
+
+      if(beats(a, b))
+      {
+        m_losers[node] = b;
+        return a;
+      } // end if
+
+      m_losers[node] = a;
+      return b;
+    }
+
+    bool exhausted(std::size_t i) const
+    {
+      return i >= m_num_ranges || m_ranges[i].first == m_ranges[i].second;
+    }
+
+    // whether the next element of range i precedes that of range j in the merge,
+    // which takes equivalent elements from the earlier range first
+    bool beats(std::size_t i, std::size_t j) const
+    {
+      if(exhausted(i)) return false;
+      if(exhausted(j)) return true;
+
+      if(i < j)
+      {
+        return !m_comp(*m_ranges[j].first, *m_ranges[i].first);
+      } // end if
+
+      return m_comp(*m_ranges[i].first, *m_ranges[j].first);
+    }
+
+    range_type         *m_ranges;
+    std::size_t         m_num_ranges;
+    std::size_t         m_num_leaves;
+    std::size_t        *m_losers;
+    std::size_t         m_winner;
+    StrictWeakOrdering &m_comp;
+}; // end loser_tree
+
+
+} // end namespace multiway_merge_detail
+
+
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator multiway_merge(thrust::pair<InputIterator,InputIterator> *ranges,
+                              Size n,
+                              OutputIterator result,
+                              StrictWeakOrdering comp)
+{
+  // one or two ranges need no tournament
+  if(n <= 0)
+  {
+    return result;
+  } // end if
+  else if(n == 1)
+  {
+    return thrust::system::detail::internal::scalar::copy(ranges[0].first, ranges[0].second, result);
+  } // end else if
+  else if(n == 2)
+  {
+    return thrust::system::detail::internal::scalar::merge(ranges[0].first, ranges[0].second,
+                                                           ranges[1].first, ranges[1].second,
+                                                           result, comp);
+  } // end else if
+
+  // wrap comp
+  typedef thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp_type;
+
+  wrapped_comp_type wrapped_comp(comp);
+
+  typedef multiway_merge_detail::loser_tree<InputIterator,wrapped_comp_type> loser_tree;
+
+  thrust::detail::temporary_array<std::size_t, thrust::system::cpp::tag> losers(loser_tree::num_leaves(n));
+
+  loser_tree tree(ranges, n, thrust::raw_pointer_cast(losers.begin().base()), wrapped_comp);
+
+  for(; !tree.empty(); ++result)
+  {
+    InputIterator &next = ranges[tree.winner()].first;
+
+    *result = *next;
+    ++next;
+
+    tree.replay();
+  } // end for
+
+  return result;
+} // end multiway_merge()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::pair<InputIterator1,InputIterator1> *key_ranges,
+                          InputIterator2 *values,
+                          Size n,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp)
+{
+  // one or two ranges need no tournament
+  if(n <= 0)
+  {
+    return thrust::make_pair(keys_result, values_result);
+  } // end if
+  else if(n == 1)
+  {
+    values_result = thrust::system::detail::internal::scalar::copy(values[0], values[0] + (key_ranges[0].second - key_ranges[0].first), values_result);
+    keys_result   = thrust::system::detail::internal::scalar::copy(key_ranges[0].first, key_ranges[0].second, keys_result);
+
+    return thrust::make_pair(keys_result, values_result);
+  } // end else if
+  else if(n == 2)
+  {
+    return thrust::system::detail::internal::scalar::merge_by_key(key_ranges[0].first, key_ranges[0].second,
+                                                                  key_ranges[1].first, key_ranges[1].second,
+                                                                  values[0], values[1],
+                                                                  keys_result, values_result,
+                                                                  comp);
+  } // end else if
+
+  // wrap comp
+  typedef thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp_type;
+
+  wrapped_comp_type wrapped_comp(comp);
+
+  typedef multiway_merge_detail::loser_tree<InputIterator1,wrapped_comp_type> loser_tree;
+
+  thrust::detail::temporary_array<std::size_t, thrust::system::cpp::tag> losers(loser_tree::num_leaves(n));
+
+  loser_tree tree(key_ranges, n, thrust::raw_pointer_cast(losers.begin().base()), wrapped_comp);
+
+  for(; !tree.empty(); ++keys_result, ++values_result)
+  {
+    std::size_t winner = tree.winner();
+
+    InputIterator1 &next_key   = key_ranges[winner].first;
+    InputIterator2 &next_value = values[winner];
+
+    *keys_result   = *next_key;
+    *values_result = *next_value;
+    ++next_key;
+    ++next_value;
+
+    tree.replay();
+  } // end for
+
+  return thrust::make_pair(keys_result, values_result);
+} // end multiway_merge_by_key()
+
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,398 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file natural_merge_sort.h
+ *  \brief Sequential stable merge sort which merges the runs already present in its input.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/scalar/adaptive_merge.h>
+#include <thrust/system/detail/internal/scalar/galloping_search.h>
+#include <thrust/system/detail/internal/scalar/stable_merge_sort.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace natural_merge_sort_detail
+{
+
+
+// returns the end of the run beginning at first, which is either
+// nondescending or strictly descending
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+RandomAccessIterator find_run(RandomAccessIterator first,
+                              RandomAccessIterator last,
+                              StrictWeakOrdering &comp,
+                              bool &descending)
+{
+  RandomAccessIterator run_last = first + 1;
+
+  descending = false;
+
+  if(run_last == last) return last;
+
+  if(comp(*run_last, *first))
+  {
+    descending = true;
+
+    for(++run_last; run_last != last && comp(*run_last, *(run_last - 1)); ++run_last);
+  }
+  else
+  {
+    for(++run_last; run_last != last && !comp(*run_last, *(run_last - 1)); ++run_last);
+  }
+
+  return run_last;
+}
+
+
+template <typename RandomAccessIterator>
+void reverse(RandomAccessIterator first,
+             RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for(; first < --last; ++first)
+  {
+    value_type temp = *first;
+    *first = *last;
+    *last  = temp;
+  }
+}
+
+
+// the power of the boundary between the adjacent runs [begin, mid) and [mid, end)
+// of a range of length n is the depth at which the boundary would fall in a
+// perfectly balanced merge tree. merging the runs on either side of boundaries in
+// decreasing order of power keeps the merges balanced (Munro & Wild's powersort)
+template <typename Size>
+int node_power(Size begin,
+               Size mid,
+               Size end,
+               Size n)
+{
+  // twice the midpoints of the two runs, as fractions of 2n
+  Size a = begin + mid;
+  Size b = mid + end;
+
+  for(int power = 1; ; ++power)
+  {
+    a *= 2;
+    b *= 2;
+
+    const bool bit_a = a >= 2 * n;
+    const bool bit_b = b >= 2 * n;
+
+    if(bit_a != bit_b) return power;
+
+    if(bit_a)
+    {
+      a -= 2 * n;
+      b -= 2 * n;
+    }
+  }
+}
+
+
+// merges the runs found by Sorter::next_run with Sorter::merge. Sorter::next_run(begin)
+// sorts a run beginning at begin and returns its end; Sorter::merge(begin, mid, end)
+// merges the adjacent sorted runs [begin, mid) and [mid, end)
+template <typename Size,
+          typename Sorter>
+void merge_runs(Size n,
+                Sorter &sorter)
+{
+  // the powers of the boundaries on the stack increase from bottom to top,
+  // so the stack never holds more runs than there are bits in 2n
+  const int max_depth = 2 * 8 * sizeof(Size);
+
+  Size stack_begin[max_depth];
+  int  stack_power[max_depth];
+  int  depth = 0;
+
+  Size begin = 0;
+  Size end   = sorter.next_run(begin);
+
+  while(end < n)
+  {
+    const Size next_end = sorter.next_run(end);
+    const int  power    = node_power(begin, end, next_end, n);
+
+    // merge the runs before boundaries which lie deeper in the tree than this one
+    for(; depth > 0 && stack_power[depth - 1] > power; --depth)
+    {
+      sorter.merge(stack_begin[depth - 1], begin, end);
+      begin = stack_begin[depth - 1];
+    }
+
+    stack_begin[depth] = begin;
+    stack_power[depth] = power;
+    ++depth;
+
+    begin = end;
+    end   = next_end;
+  }
+
+  for(; depth > 0; --depth)
+  {
+    sorter.merge(stack_begin[depth - 1], begin, end);
+    begin = stack_begin[depth - 1];
+  }
+}
+
+
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+struct key_sorter
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  // runs shorter than a leaf are extended to a leaf and sorted directly
+  static const difference_type min_run = thrust::system::detail::internal::scalar::detail::leaf_size<RandomAccessIterator>::value;
+
+  RandomAccessIterator first, last;
+  StrictWeakOrdering &comp;
+
+  key_sorter(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering &comp)
+    : first(first), last(last), comp(comp)
+  {}
+
+  difference_type next_run(difference_type begin)
+  {
+    bool descending;
+    RandomAccessIterator run_last = find_run(first + begin, last, comp, descending);
+
+    // a strictly descending run holds no equivalent elements to reorder
+    if(descending)
+      natural_merge_sort_detail::reverse(first + begin, run_last);
+
+    if(run_last - (first + begin) < min_run)
+    {
+      run_last = (last - (first + begin) < min_run) ? last : first + begin + min_run;
+
+      thrust::system::detail::internal::scalar::detail::leaf_sort(first + begin, run_last, comp,
+        typename use_sorting_network<RandomAccessIterator>::type());
+    }
+
+    return run_last - first;
+  }
+
+  void merge(difference_type begin, difference_type mid, difference_type end)
+  {
+    RandomAccessIterator lo = first + begin;
+    RandomAccessIterator m  = first + mid;
+    RandomAccessIterator hi = first + end;
+
+    // the runs are already in order
+    if(!comp(*m, *(m - 1))) return;
+
+    // the left run's elements which precede the right run, and the right
+    // run's elements which follow the left run, are already in place
+    lo = gallop_upper_bound(lo, m, *m, comp);
+    hi = gallop_lower_bound(m, hi, *(m - 1), comp);
+
+    thrust::system::detail::internal::scalar::adaptive_merge(lo, m, hi, comp);
+  }
+};
+
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+struct key_value_sorter
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  // runs shorter than a leaf are extended to a leaf and sorted directly
+  static const difference_type min_run = thrust::system::detail::internal::scalar::detail::leaf_size_by_key<RandomAccessIterator1,RandomAccessIterator2>::value;
+
+  RandomAccessIterator1 first1, last1;
+  RandomAccessIterator2 first2;
+  StrictWeakOrdering &comp;
+
+  key_value_sorter(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, StrictWeakOrdering &comp)
+    : first1(first1), last1(last1), first2(first2), comp(comp)
+  {}
+
+  difference_type next_run(difference_type begin)
+  {
+    bool descending;
+    difference_type end = find_run(first1 + begin, last1, comp, descending) - first1;
+
+    // a strictly descending run holds no equivalent keys to reorder
+    if(descending)
+    {
+      natural_merge_sort_detail::reverse(first1 + begin, first1 + end);
+      natural_merge_sort_detail::reverse(first2 + begin, first2 + end);
+    }
+
+    if(end - begin < min_run)
+    {
+      end = (last1 - first1 - begin < min_run) ? last1 - first1 : begin + min_run;
+
+      thrust::system::detail::internal::scalar::detail::leaf_sort_by_key(first1 + begin, first1 + end, first2 + begin, comp,
+        typename use_sorting_network_by_key<RandomAccessIterator1,RandomAccessIterator2>::type());
+    }
+
+    return end;
+  }
+
+  void merge(difference_type begin, difference_type mid, difference_type end)
+  {
+    // the runs are already in order
+    if(!comp(first1[mid], first1[mid - 1])) return;
+
+    // the left run's keys which precede the right run, and the right
+    // run's keys which follow the left run, are already in place
+    begin = gallop_upper_bound(first1 + begin, first1 + mid, first1[mid], comp) - first1;
+    end   = gallop_lower_bound(first1 + mid, first1 + end, first1[mid - 1], comp) - first1;
+
+    thrust::system::detail::internal::scalar::adaptive_merge_by_key(first1 + begin, first1 + mid, first1 + end, first2 + begin, comp);
+  }
+};
+
+
+} // end namespace natural_merge_sort_detail
+
+
+// sorts [first, last) and returns true when it consists of a single
+// nondescending or strictly descending run, in one pass
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+bool sort_single_run(RandomAccessIterator first,
+                     RandomAccessIterator last,
+                     StrictWeakOrdering comp)
+{
+  if(first == last) return true;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  bool descending;
+  if(natural_merge_sort_detail::find_run(first, last, wrapped_comp, descending) != last) return false;
+
+  if(descending)
+    natural_merge_sort_detail::reverse(first, last);
+
+  return true;
+}
+
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+bool sort_single_run_by_key(RandomAccessIterator1 first1,
+                            RandomAccessIterator1 last1,
+                            RandomAccessIterator2 first2,
+                            StrictWeakOrdering comp)
+{
+  if(first1 == last1) return true;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  bool descending;
+  if(natural_merge_sort_detail::find_run(first1, last1, wrapped_comp, descending) != last1) return false;
+
+  if(descending)
+  {
+    natural_merge_sort_detail::reverse(first1, last1);
+    natural_merge_sort_detail::reverse(first2, first2 + (last1 - first1));
+  }
+
+  return true;
+}
+
+
+// a stable merge sort whose leaves are the ascending and strictly descending
+// runs of the input, so that presorted input is sorted in a single pass
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+void natural_merge_sort(RandomAccessIterator first,
+                        RandomAccessIterator last,
+                        StrictWeakOrdering comp)
+{
+  if(first == last) return;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  typedef natural_merge_sort_detail::key_sorter<
+    RandomAccessIterator,
+    thrust::detail::host_function<StrictWeakOrdering,bool>
+  > sorter_type;
+
+  sorter_type sorter(first, last, wrapped_comp);
+
+  natural_merge_sort_detail::merge_runs(last - first, sorter);
+}
+
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void natural_merge_sort_by_key(RandomAccessIterator1 first1,
+                               RandomAccessIterator1 last1,
+                               RandomAccessIterator2 first2,
+                               StrictWeakOrdering comp)
+{
+  if(first1 == last1) return;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  typedef natural_merge_sort_detail::key_value_sorter<
+    RandomAccessIterator1,
+    RandomAccessIterator2,
+    thrust::detail::host_function<StrictWeakOrdering,bool>
+  > sorter_type;
+
+  sorter_type sorter(first1, last1, first2, wrapped_comp);
+
+  natural_merge_sort_detail::merge_runs(last1 - first1, sorter);
+}
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
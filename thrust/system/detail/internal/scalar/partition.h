@@ -25,6 +25,10 @@
 #include <thrust/pair.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/function.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/low_memory.h>
+#include <thrust/system/detail/internal/scalar/rotate.h>
 
 namespace thrust
 {
@@ -86,6 +90,78 @@ template<typename ForwardIterator,
   return first;
 }
 
+namespace partition_detail
+{
+
+
+// stably partitions the n elements of [first, last) with a buffer of buffer_size elements,
+// which may be empty. pieces which fit in the buffer are partitioned in a single pass;
+// larger ones are halved, and the false elements of the left half exchanged with the true
+// elements of the right by rotation
+template<typename ForwardIterator,
+         typename Predicate,
+         typename Size,
+         typename BufferIterator>
+  ForwardIterator stable_partition_with_buffer(ForwardIterator first,
+                                               ForwardIterator last,
+                                               Predicate &pred,
+                                               Size n,
+                                               BufferIterator buffer,
+                                               Size buffer_size)
+{
+  if (n <= buffer_size)
+  {
+    BufferIterator buffer_last = buffer;
+
+    ForwardIterator middle = first;
+
+    for(; first != last; ++first)
+    {
+      if (pred(*first))
+      {
+        *middle = *first;
+        ++middle;
+      }
+      else
+      {
+        *buffer_last = *first;
+        ++buffer_last;
+      }
+    }
+
+    for(ForwardIterator out = middle; buffer != buffer_last; ++buffer, ++out)
+    {
+      *out = *buffer;
+    }
+
+    return middle;
+  }
+
+  if (n == 1)
+  {
+    if (pred(*first))
+      ++first;
+
+    return first;
+  }
+
+  const Size half = n / 2;
+
+  ForwardIterator middle = first;
+  thrust::advance(middle, half);
+
+  ForwardIterator left_middle  = stable_partition_with_buffer(first, middle, pred, half, buffer, buffer_size);
+  ForwardIterator right_middle = stable_partition_with_buffer(middle, last, pred, n - half, buffer, buffer_size);
+
+  return thrust::system::detail::internal::scalar::rotate(left_middle, middle, right_middle);
+}
+
+
+} // end partition_detail
+
+
+// partitions with a buffer for the whole range if one can be allocated,
+// or else with a smaller one, or none, and records the mode it ran in
 template<typename ForwardIterator,
          typename Predicate>
   ForwardIterator stable_partition(ForwardIterator first,
@@ -100,33 +176,19 @@ template<typename ForwardIterator,
 
   // XXX the type of system should be:
   //     typedef decltype(select_system(first, last)) system;
-  typedef typename thrust::iterator_system<ForwardIterator>::type System;
-  typedef typename thrust::iterator_value<ForwardIterator>::type T;
+  typedef typename thrust::iterator_system<ForwardIterator>::type     System;
+  typedef typename thrust::iterator_value<ForwardIterator>::type      T;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type Size;
 
-  typedef thrust::detail::temporary_array<T,System> TempRange;
-  typedef typename TempRange::iterator             TempIterator;
+  Size n = thrust::distance(first, last);
 
-  TempRange temp(first, last);
+  thrust::detail::temporary_array<T,System> buffer(0);
 
-  for(TempIterator iter = temp.begin(); iter != temp.end(); ++iter)
-  {
-    if (wrapped_pred(*iter))
-    {
-      *first = *iter;
-      ++first;
-    }
-  }
+  thrust::low_memory_monitor::mode mode = thrust::system::detail::internal::allocate_at_most(buffer, n);
 
-  ForwardIterator middle = first;
+  ForwardIterator middle = partition_detail::stable_partition_with_buffer(first, last, wrapped_pred, n, buffer.begin(), static_cast<Size>(buffer.size()));
 
-  for(TempIterator iter = temp.begin(); iter != temp.end(); ++iter)
-  {
-    if (!wrapped_pred(*iter))
-    {
-      *first = *iter;
-      ++first;
-    }
-  }
+  thrust::system::detail::internal::record_low_memory_mode(mode);
 
   return middle;
 }
@@ -23,6 +23,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/system/detail/internal/scalar/copy_if.h>
 
 namespace thrust
 {
@@ -59,17 +61,8 @@ template<typename ForwardIterator,
 
   ++first;
 
-  while(first != last)
-  {
-    if(!wrapped_pred(*first))
-    {
-      *result = *first;
-      ++result;
-    }
-    ++first;
-  }
-
-  return result;
+  // compact the remainder behind result
+  return thrust::system::detail::internal::scalar::copy_if(first, last, first, result, thrust::detail::not1(pred));
 }
 
 
@@ -103,18 +96,8 @@ template<typename ForwardIterator,
   ++first;
   ++stencil;
 
-  while(first != last)
-  {
-    if(!wrapped_pred(*stencil))
-    {
-      *result = *first;
-      ++result;
-    }
-    ++first;
-    ++stencil;
-  }
-
-  return result;
+  // compact the remainder behind result
+  return thrust::system::detail::internal::scalar::copy_if(first, last, stencil, result, thrust::detail::not1(pred));
 }
 
 
@@ -126,24 +109,7 @@ template<typename InputIterator,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // wrap pred
-  thrust::detail::host_function<
-    Predicate,
-    bool
-  > wrapped_pred(pred);
-
-  while (first != last)
-  {
-    if (!wrapped_pred(*first))
-    {
-      *result = *first;
-      ++result;
-    }
-
-    ++first;
-  }
-
-  return result;
+  return thrust::system::detail::internal::scalar::copy_if(first, last, first, result, thrust::detail::not1(pred));
 }
 
 template<typename InputIterator1,
@@ -156,25 +122,7 @@ template<typename InputIterator1,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // wrap pred
-  thrust::detail::host_function<
-    Predicate,
-    bool
-  > wrapped_pred(pred);
-
-  while (first != last)
-  {
-    if (!wrapped_pred(*stencil))
-    {
-      *result = *first;
-      ++result;
-    }
-
-    ++first;
-    ++stencil;
-  }
-
-  return result;
+  return thrust::system::detail::internal::scalar::copy_if(first, last, stencil, result, thrust::detail::not1(pred));
 }
 
 } // end namespace scalar
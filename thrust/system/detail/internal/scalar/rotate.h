@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file rotate.h
+ *  \brief Sequential rotation of a range, in place.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+
+
+// exchanges [first, middle) and [middle, last) in place and
+// returns the new position of the element at first
+template<typename ForwardIterator>
+  ForwardIterator rotate(ForwardIterator first,
+                         ForwardIterator middle,
+                         ForwardIterator last)
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type value_type;
+
+  if(first == middle) return last;
+  if(middle == last) return first;
+
+  ForwardIterator result = first;
+  thrust::advance(result, thrust::distance(middle, last));
+
+  // swap the elements of the left range one by one into place, beginning again
+  // with the remainder of the right range whenever either range runs out
+  ForwardIterator next = middle;
+
+  while(first != next)
+  {
+    value_type temp = *first;
+    *first = *next;
+    *next  = temp;
+
+    ++first;
+    ++next;
+
+    if(next == last)
+    {
+      next = middle;
+    } // end if
+    else if(first == middle)
+    {
+      middle = next;
+    } // end else if
+  } // end while
+
+  return result;
+} // end rotate()
+
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
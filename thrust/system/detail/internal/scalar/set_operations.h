@@ -23,6 +23,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/internal/scalar/copy.h>
+#include <thrust/system/detail/internal/scalar/galloping_search.h>
 #include <thrust/detail/function.h>
 
 namespace thrust
@@ -35,33 +36,30 @@ namespace internal
 {
 namespace scalar
 {
+namespace set_operations_detail
+{
+
 
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-  OutputIterator set_difference(InputIterator1 first1,
-                                InputIterator1 last1,
-                                InputIterator2 first2,
-                                InputIterator2 last2,
-                                OutputIterator result,
-                                StrictWeakOrdering comp)
+  OutputIterator linear_set_difference(InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       InputIterator2 last2,
+                                       OutputIterator result,
+                                       StrictWeakOrdering &comp)
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first1,*first2))
+    if(comp(*first1,*first2))
     {
       *result = *first1;
       ++first1;
       ++result;
     } // end if
-    else if(wrapped_comp(*first2,*first1))
+    else if(comp(*first2,*first1))
     {
       ++first2;
     } // end else if
@@ -73,33 +71,27 @@ template<typename InputIterator1,
   } // end while
 
   return scalar::copy(first1, last1, result);
-} // end set_difference()
+} // end linear_set_difference()
 
 
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-  OutputIterator set_intersection(InputIterator1 first1,
-                                  InputIterator1 last1,
-                                  InputIterator2 first2,
-                                  InputIterator2 last2,
-                                  OutputIterator result,
-                                  StrictWeakOrdering comp)
+  OutputIterator linear_set_intersection(InputIterator1 first1,
+                                         InputIterator1 last1,
+                                         InputIterator2 first2,
+                                         InputIterator2 last2,
+                                         OutputIterator result,
+                                         StrictWeakOrdering &comp)
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first1,*first2))
+    if(comp(*first1,*first2))
     {
       ++first1;
     } // end if
-    else if(wrapped_comp(*first2,*first1))
+    else if(comp(*first2,*first1))
     {
       ++first2;
     } // end else if
@@ -113,35 +105,29 @@ template<typename InputIterator1,
   } // end while
 
   return result;
-} // end set_intersection()
+} // end linear_set_intersection()
 
 
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-  OutputIterator set_symmetric_difference(InputIterator1 first1,
-                                          InputIterator1 last1,
-                                          InputIterator2 first2,
-                                          InputIterator2 last2,
-                                          OutputIterator result,
-                                          StrictWeakOrdering comp)
+  OutputIterator linear_set_symmetric_difference(InputIterator1 first1,
+                                                 InputIterator1 last1,
+                                                 InputIterator2 first2,
+                                                 InputIterator2 last2,
+                                                 OutputIterator result,
+                                                 StrictWeakOrdering &comp)
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first1,*first2))
+    if(comp(*first1,*first2))
     {
       *result = *first1;
       ++first1;
       ++result;
     } // end if
-    else if(wrapped_comp(*first2,*first1))
+    else if(comp(*first2,*first1))
     {
       *result = *first2;
       ++first2;
@@ -155,34 +141,28 @@ template<typename InputIterator1,
   } // end while
 
   return scalar::copy(first2, last2, scalar::copy(first1, last1, result));
-} // end set_symmetric_difference()
+} // end linear_set_symmetric_difference()
 
 
 template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-  OutputIterator set_union(InputIterator1 first1,
-                           InputIterator1 last1,
-                           InputIterator2 first2,
-                           InputIterator2 last2,
-                           OutputIterator result,
-                           StrictWeakOrdering comp)
+  OutputIterator linear_set_union(InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering &comp)
 {
-  // wrap comp
-  thrust::detail::host_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first1,*first2))
+    if(comp(*first1,*first2))
     {
       *result = *first1;
       ++first1;
     } // end if
-    else if(wrapped_comp(*first2,*first1))
+    else if(comp(*first2,*first1))
     {
       *result = *first2;
       ++first2;
@@ -198,6 +178,481 @@ template<typename InputIterator1,
   } // end while
 
   return scalar::copy(first2, last2, scalar::copy(first1, last1, result));
+} // end linear_set_union()
+
+
+// the galloping variants step through the shorter range one element at a time
+// and search the longer range for each, so they perform O(m log(n/m))
+// comparisons for ranges of lengths m <= n rather than O(m + n)
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator galloping_set_difference(RandomAccessIterator1 first1,
+                                          RandomAccessIterator1 last1,
+                                          RandomAccessIterator2 first2,
+                                          RandomAccessIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    while(first1 != last1)
+    {
+      first2 = gallop_lower_bound(first2, last2, *first1, comp);
+
+      if(first2 == last2) break;
+
+      if(comp(*first1,*first2))
+      {
+        *result = *first1;
+        ++result;
+      } // end if
+      else
+      {
+        ++first2;
+      } // end else
+
+      ++first1;
+    } // end while
+  } // end if
+  else
+  {
+    while(first2 != last2)
+    {
+      // the elements of the first range which precede *first2 are unmatched
+      RandomAccessIterator1 mid1 = gallop_lower_bound(first1, last1, *first2, comp);
+      result = scalar::copy(first1, mid1, result);
+      first1 = mid1;
+
+      if(first1 == last1) break;
+
+      if(!comp(*first2,*first1))
+      {
+        ++first1;
+      } // end if
+
+      ++first2;
+    } // end while
+  } // end else
+
+  return scalar::copy(first1, last1, result);
+} // end galloping_set_difference()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator galloping_set_intersection(RandomAccessIterator1 first1,
+                                            RandomAccessIterator1 last1,
+                                            RandomAccessIterator2 first2,
+                                            RandomAccessIterator2 last2,
+                                            OutputIterator result,
+                                            StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    while(first1 != last1)
+    {
+      first2 = gallop_lower_bound(first2, last2, *first1, comp);
+
+      if(first2 == last2) break;
+
+      if(!comp(*first1,*first2))
+      {
+        *result = *first1;
+        ++first2;
+        ++result;
+      } // end if
+
+      ++first1;
+    } // end while
+  } // end if
+  else
+  {
+    while(first2 != last2)
+    {
+      first1 = gallop_lower_bound(first1, last1, *first2, comp);
+
+      if(first1 == last1) break;
+
+      if(!comp(*first2,*first1))
+      {
+        *result = *first1;
+        ++first1;
+        ++result;
+      } // end if
+
+      ++first2;
+    } // end while
+  } // end else
+
+  return result;
+} // end galloping_set_intersection()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator galloping_set_symmetric_difference(RandomAccessIterator1 first1,
+                                                    RandomAccessIterator1 last1,
+                                                    RandomAccessIterator2 first2,
+                                                    RandomAccessIterator2 last2,
+                                                    OutputIterator result,
+                                                    StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    while(first1 != last1)
+    {
+      RandomAccessIterator2 mid2 = gallop_lower_bound(first2, last2, *first1, comp);
+      result = scalar::copy(first2, mid2, result);
+      first2 = mid2;
+
+      if(first2 == last2) break;
+
+      if(comp(*first1,*first2))
+      {
+        *result = *first1;
+        ++result;
+      } // end if
+      else
+      {
+        ++first2;
+      } // end else
+
+      ++first1;
+    } // end while
+  } // end if
+  else
+  {
+    while(first2 != last2)
+    {
+      RandomAccessIterator1 mid1 = gallop_lower_bound(first1, last1, *first2, comp);
+      result = scalar::copy(first1, mid1, result);
+      first1 = mid1;
+
+      if(first1 == last1) break;
+
+      if(comp(*first2,*first1))
+      {
+        *result = *first2;
+        ++result;
+      } // end if
+      else
+      {
+        ++first1;
+      } // end else
+
+      ++first2;
+    } // end while
+  } // end else
+
+  return scalar::copy(first2, last2, scalar::copy(first1, last1, result));
+} // end galloping_set_symmetric_difference()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator galloping_set_union(RandomAccessIterator1 first1,
+                                     RandomAccessIterator1 last1,
+                                     RandomAccessIterator2 first2,
+                                     RandomAccessIterator2 last2,
+                                     OutputIterator result,
+                                     StrictWeakOrdering &comp)
+{
+  if(last1 - first1 < last2 - first2)
+  {
+    while(first1 != last1)
+    {
+      RandomAccessIterator2 mid2 = gallop_lower_bound(first2, last2, *first1, comp);
+      result = scalar::copy(first2, mid2, result);
+      first2 = mid2;
+
+      if(first2 == last2) break;
+
+      // *first1 stands in for an equivalent *first2
+      if(!comp(*first1,*first2))
+      {
+        ++first2;
+      } // end if
+
+      *result = *first1;
+      ++first1;
+      ++result;
+    } // end while
+  } // end if
+  else
+  {
+    while(first2 != last2)
+    {
+      RandomAccessIterator1 mid1 = gallop_lower_bound(first1, last1, *first2, comp);
+      result = scalar::copy(first1, mid1, result);
+      first1 = mid1;
+
+      if(first1 == last1) break;
+
+      if(comp(*first2,*first1))
+      {
+        *result = *first2;
+      } // end if
+      else
+      {
+        *result = *first1;
+        ++first1;
+      } // end else
+
+      ++first2;
+      ++result;
+    } // end while
+  } // end else
+
+  return scalar::copy(first2, last2, scalar::copy(first1, last1, result));
+} // end galloping_set_union()
+
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_difference(InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering &comp,
+                                thrust::detail::false_type) // use_galloping
+{
+  return linear_set_difference(first1, last1, first2, last2, result, comp);
+} // end set_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_difference(InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering &comp,
+                                thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_set_difference(first1, last1, first2, last2, result, comp);
+  } // end if
+
+  return linear_set_difference(first1, last1, first2, last2, result, comp);
+} // end set_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_intersection(InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering &comp,
+                                  thrust::detail::false_type) // use_galloping
+{
+  return linear_set_intersection(first1, last1, first2, last2, result, comp);
+} // end set_intersection()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_intersection(InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering &comp,
+                                  thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_set_intersection(first1, last1, first2, last2, result, comp);
+  } // end if
+
+  return linear_set_intersection(first1, last1, first2, last2, result, comp);
+} // end set_intersection()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_symmetric_difference(InputIterator1 first1,
+                                          InputIterator1 last1,
+                                          InputIterator2 first2,
+                                          InputIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering &comp,
+                                          thrust::detail::false_type) // use_galloping
+{
+  return linear_set_symmetric_difference(first1, last1, first2, last2, result, comp);
+} // end set_symmetric_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_symmetric_difference(InputIterator1 first1,
+                                          InputIterator1 last1,
+                                          InputIterator2 first2,
+                                          InputIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering &comp,
+                                          thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_set_symmetric_difference(first1, last1, first2, last2, result, comp);
+  } // end if
+
+  return linear_set_symmetric_difference(first1, last1, first2, last2, result, comp);
+} // end set_symmetric_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_union(InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           InputIterator2 last2,
+                           OutputIterator result,
+                           StrictWeakOrdering &comp,
+                           thrust::detail::false_type) // use_galloping
+{
+  return linear_set_union(first1, last1, first2, last2, result, comp);
+} // end set_union()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_union(InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           InputIterator2 last2,
+                           OutputIterator result,
+                           StrictWeakOrdering &comp,
+                           thrust::detail::true_type) // use_galloping
+{
+  if(is_skewed(last1 - first1, last2 - first2))
+  {
+    return galloping_set_union(first1, last1, first2, last2, result, comp);
+  } // end if
+
+  return linear_set_union(first1, last1, first2, last2, result, comp);
+} // end set_union()
+
+
+} // end namespace set_operations_detail
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_difference(InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  return set_operations_detail::set_difference(first1, last1, first2, last2, result, wrapped_comp,
+                                                 typename use_galloping<InputIterator1,InputIterator2>::type());
+} // end set_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_intersection(InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  return set_operations_detail::set_intersection(first1, last1, first2, last2, result, wrapped_comp,
+                                                   typename use_galloping<InputIterator1,InputIterator2>::type());
+} // end set_intersection()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_symmetric_difference(InputIterator1 first1,
+                                          InputIterator1 last1,
+                                          InputIterator2 first2,
+                                          InputIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  return set_operations_detail::set_symmetric_difference(first1, last1, first2, last2, result, wrapped_comp,
+                                                           typename use_galloping<InputIterator1,InputIterator2>::type());
+} // end set_symmetric_difference()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_union(InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           InputIterator2 last2,
+                           OutputIterator result,
+                           StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  return set_operations_detail::set_union(first1, last1, first2, last2, result, wrapped_comp,
+                                            typename use_galloping<InputIterator1,InputIterator2>::type());
 } // end set_union()
 
 } // end namespace scalar
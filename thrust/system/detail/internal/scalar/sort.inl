@@ -18,8 +18,9 @@
 #include <thrust/reverse.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/detail/internal/scalar/stable_merge_sort.h>
+#include <thrust/system/detail/internal/scalar/natural_merge_sort.h>
 #include <thrust/system/detail/internal/scalar/stable_radix_sort.h>
+#include <thrust/system/detail/internal/low_memory.h>
 
 namespace thrust
 {
@@ -45,7 +46,17 @@ void stable_sort(RandomAccessIterator first,
                  StrictWeakOrdering comp,
                  thrust::detail::true_type)
 {
-  thrust::system::detail::internal::scalar::stable_radix_sort(first, last);
+  // presorted input is finished in a single pass
+  if (thrust::system::detail::internal::scalar::sort_single_run(first, last, comp))
+    return;
+
+  // without room for the radix sort's temporary storage, the merge sort makes do with less
+  if (!thrust::system::detail::internal::scalar::stable_radix_sort(first, last))
+  {
+    thrust::system::detail::internal::record_low_memory_mode(thrust::low_memory_monitor::reduced_buffer);
+    thrust::system::detail::internal::scalar::natural_merge_sort(first, last, comp);
+    return;
+  }
         
   // if comp is greater<T> then reverse the keys
   typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
@@ -64,6 +75,10 @@ void stable_sort_by_key(RandomAccessIterator1 first1,
                         StrictWeakOrdering comp,
                         thrust::detail::true_type)
 {
+  // presorted input is finished in a single pass
+  if (thrust::system::detail::internal::scalar::sort_single_run_by_key(first1, last1, first2, comp))
+    return;
+
   // if comp is greater<T> then reverse the keys and values
   typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
   const static bool reverse = thrust::detail::is_same<StrictWeakOrdering, typename thrust::greater<KeyType> >::value;
@@ -75,13 +90,20 @@ void stable_sort_by_key(RandomAccessIterator1 first1,
     thrust::reverse(first2, first2 + (last1 - first1));
   }
 
-  thrust::system::detail::internal::scalar::stable_radix_sort_by_key(first1, last1, first2);
+  const bool sorted = thrust::system::detail::internal::scalar::stable_radix_sort_by_key(first1, last1, first2);
 
   if (reverse)
   {
     thrust::reverse(first1,  last1);
     thrust::reverse(first2, first2 + (last1 - first1));
   }
+
+  // without room for the radix sort's temporary storage, the merge sort makes do with less
+  if (!sorted)
+  {
+    thrust::system::detail::internal::record_low_memory_mode(thrust::low_memory_monitor::reduced_buffer);
+    thrust::system::detail::internal::scalar::natural_merge_sort_by_key(first1, last1, first2, comp);
+  }
 }
 
 ////////////////
@@ -95,7 +117,7 @@ void stable_sort(RandomAccessIterator first,
                  StrictWeakOrdering comp,
                  thrust::detail::false_type)
 {
-  thrust::system::detail::internal::scalar::stable_merge_sort(first, last, comp);
+  thrust::system::detail::internal::scalar::natural_merge_sort(first, last, comp);
 }
 
 template<typename RandomAccessIterator1,
@@ -107,7 +129,7 @@ void stable_sort_by_key(RandomAccessIterator1 first1,
                         StrictWeakOrdering comp,
                         thrust::detail::false_type)
 {
-  thrust::system::detail::internal::scalar::stable_merge_sort_by_key(first1, last1, first2, comp);
+  thrust::system::detail::internal::scalar::natural_merge_sort_by_key(first1, last1, first2, comp);
 }
 
 
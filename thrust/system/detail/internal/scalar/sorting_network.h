@@ -0,0 +1,272 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file sorting_network.h
+ *  \brief Branch-free stable sorting of small blocks of primitive keys.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace sorting_network_detail
+{
+
+// the largest block sorting_network_sort and sorting_network_sort_by_key accept
+const int max_size = 16;
+
+
+// orders key_a before key_b. the comparison and exchange are written without
+// branches so that primitive keys compile to conditional moves. only strictly
+// out-of-order keys are exchanged, so equivalent keys keep their order
+template <typename Key,
+          typename StrictWeakOrdering>
+inline void compare_exchange(Key &key_a,
+                             Key &key_b,
+                             StrictWeakOrdering &comp)
+{
+  const bool swap = comp(key_b, key_a);
+
+  const Key lo = swap ? key_b : key_a;
+  const Key hi = swap ? key_a : key_b;
+
+  key_a = lo;
+  key_b = hi;
+}
+
+
+template <typename Key,
+          typename Value,
+          typename StrictWeakOrdering>
+inline void compare_exchange(Key &key_a,
+                             Key &key_b,
+                             Value &value_a,
+                             Value &value_b,
+                             StrictWeakOrdering &comp)
+{
+  const bool swap = comp(key_b, key_a);
+
+  const Key   lo_key   = swap ? key_b   : key_a;
+  const Key   hi_key   = swap ? key_a   : key_b;
+  const Value lo_value = swap ? value_b : value_a;
+  const Value hi_value = swap ? value_a : value_b;
+
+  key_a   = lo_key;
+  key_b   = hi_key;
+  value_a = lo_value;
+  value_b = hi_value;
+}
+
+
+// odd-even transposition network for N elements. networks which exchange
+// non-adjacent elements (e.g. Batcher's) are smaller, but cannot be made
+// stable without carrying each element's rank through every exchange, which
+// costs more than the comparators saved. N is a constant so that the
+// network is fully unrolled and the keys stay in registers
+template <int N>
+  struct transposition_network
+{
+  template <typename Key,
+            typename StrictWeakOrdering>
+  static void sort(Key *keys,
+                   StrictWeakOrdering &comp)
+  {
+    for(int round = 0; round < N; ++round)
+    {
+      for(int i = round & 1; i + 1 < N; i += 2)
+      {
+        compare_exchange(keys[i], keys[i + 1], comp);
+      }
+    }
+  }
+
+  template <typename Key,
+            typename Value,
+            typename StrictWeakOrdering>
+  static void sort_by_key(Key *keys,
+                          Value *values,
+                          StrictWeakOrdering &comp)
+  {
+    for(int round = 0; round < N; ++round)
+    {
+      for(int i = round & 1; i + 1 < N; i += 2)
+      {
+        compare_exchange(keys[i], keys[i + 1], values[i], values[i + 1], comp);
+      }
+    }
+  }
+};
+
+
+// selects the network for a block of n <= N elements
+template <int N>
+  struct network_dispatch
+{
+  template <typename Key,
+            typename StrictWeakOrdering>
+  static void sort(int n,
+                   Key *keys,
+                   StrictWeakOrdering &comp)
+  {
+    if(n == N)
+      transposition_network<N>::sort(keys, comp);
+    else
+      network_dispatch<N-1>::sort(n, keys, comp);
+  }
+
+  template <typename Key,
+            typename Value,
+            typename StrictWeakOrdering>
+  static void sort_by_key(int n,
+                          Key *keys,
+                          Value *values,
+                          StrictWeakOrdering &comp)
+  {
+    if(n == N)
+      transposition_network<N>::sort_by_key(keys, values, comp);
+    else
+      network_dispatch<N-1>::sort_by_key(n, keys, values, comp);
+  }
+};
+
+// blocks of zero or one elements are already sorted
+template <>
+  struct network_dispatch<1>
+{
+  template <typename Key,
+            typename StrictWeakOrdering>
+  static void sort(int, Key *, StrictWeakOrdering &)
+  {}
+
+  template <typename Key,
+            typename Value,
+            typename StrictWeakOrdering>
+  static void sort_by_key(int, Key *, Value *, StrictWeakOrdering &)
+  {}
+};
+
+} // end namespace sorting_network_detail
+
+
+// networks are used for primitive keys, which are cheap to hold in registers
+template <typename RandomAccessIterator>
+  struct use_sorting_network
+    : thrust::detail::is_arithmetic<
+        typename thrust::iterator_value<RandomAccessIterator>::type
+      >
+{};
+
+// values ride along with primitive keys when they are plain-old-data
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+  struct use_sorting_network_by_key
+    : thrust::detail::integral_constant<
+        bool,
+        use_sorting_network<RandomAccessIterator1>::value &&
+        thrust::detail::is_pod<typename thrust::iterator_value<RandomAccessIterator2>::type>::value
+      >
+{};
+
+
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+void sorting_network_sort(RandomAccessIterator first,
+                          RandomAccessIterator last,
+                          StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  const int n = static_cast<int>(last - first);
+
+  key_type keys[sorting_network_detail::max_size];
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = first[i];
+  }
+
+  sorting_network_detail::network_dispatch<sorting_network_detail::max_size>::sort(n, keys, wrapped_comp);
+
+  for(int i = 0; i < n; ++i)
+  {
+    first[i] = keys[i];
+  }
+}
+
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sorting_network_sort_by_key(RandomAccessIterator1 first1,
+                                 RandomAccessIterator1 last1,
+                                 RandomAccessIterator2 first2,
+                                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type;
+
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  const int n = static_cast<int>(last1 - first1);
+
+  key_type     keys[sorting_network_detail::max_size];
+  value_type values[sorting_network_detail::max_size];
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i]   = first1[i];
+    values[i] = first2[i];
+  }
+
+  sorting_network_detail::network_dispatch<sorting_network_detail::max_size>::sort_by_key(n, keys, values, wrapped_comp);
+
+  for(int i = 0; i < n; ++i)
+  {
+    first1[i] = keys[i];
+    first2[i] = values[i];
+  }
+}
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -19,6 +19,8 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/system/detail/internal/scalar/merge.h>
 #include <thrust/system/detail/internal/scalar/insertion_sort.h>
+#include <thrust/system/detail/internal/scalar/sorting_network.h>
+#include <thrust/detail/type_traits.h>
 
 namespace thrust
 {
@@ -80,6 +82,70 @@ void inplace_merge_by_key(RandomAccessIterator1 first1,
      first1, first2, comp);
 }
 
+
+// the largest block sorted directly rather than by recursion
+template <typename RandomAccessIterator>
+  struct leaf_size
+    : thrust::detail::integral_constant<
+        int,
+        use_sorting_network<RandomAccessIterator>::value ? sorting_network_detail::max_size : 32
+      >
+{};
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+  struct leaf_size_by_key
+    : thrust::detail::integral_constant<
+        int,
+        use_sorting_network_by_key<RandomAccessIterator1,RandomAccessIterator2>::value ? sorting_network_detail::max_size : 32
+      >
+{};
+
+
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+void leaf_sort(RandomAccessIterator first,
+               RandomAccessIterator last,
+               StrictWeakOrdering comp,
+               thrust::detail::true_type) // use_sorting_network
+{
+  thrust::system::detail::internal::scalar::sorting_network_sort(first, last, comp);
+}
+
+template <typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+void leaf_sort(RandomAccessIterator first,
+               RandomAccessIterator last,
+               StrictWeakOrdering comp,
+               thrust::detail::false_type) // use_sorting_network
+{
+  thrust::system::detail::internal::scalar::insertion_sort(first, last, comp);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void leaf_sort_by_key(RandomAccessIterator1 first1,
+                      RandomAccessIterator1 last1,
+                      RandomAccessIterator2 first2,
+                      StrictWeakOrdering comp,
+                      thrust::detail::true_type) // use_sorting_network_by_key
+{
+  thrust::system::detail::internal::scalar::sorting_network_sort_by_key(first1, last1, first2, comp);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void leaf_sort_by_key(RandomAccessIterator1 first1,
+                      RandomAccessIterator1 last1,
+                      RandomAccessIterator2 first2,
+                      StrictWeakOrdering comp,
+                      thrust::detail::false_type) // use_sorting_network_by_key
+{
+  thrust::system::detail::internal::scalar::insertion_sort_by_key(first1, last1, first2, comp);
+}
+
 } // end namespace detail
 
 //////////////
@@ -92,9 +158,10 @@ void stable_merge_sort(RandomAccessIterator first,
                        RandomAccessIterator last,
                        StrictWeakOrdering comp)
 {
-  if (last - first < 32)
+  if (last - first <= detail::leaf_size<RandomAccessIterator>::value)
   {
-    thrust::system::detail::internal::scalar::insertion_sort(first, last, comp);
+    detail::leaf_sort(first, last, comp,
+      typename use_sorting_network<RandomAccessIterator>::type());
   }
   else
   {
@@ -119,9 +186,10 @@ void stable_merge_sort_by_key(RandomAccessIterator1 first1,
                               RandomAccessIterator2 first2,
                               StrictWeakOrdering comp)
 {
-  if (last1 - first1 <= 32)
+  if (last1 - first1 <= detail::leaf_size_by_key<RandomAccessIterator1,RandomAccessIterator2>::value)
   {
-    thrust::system::detail::internal::scalar::insertion_sort_by_key(first1, last1, first2, comp);
+    detail::leaf_sort_by_key(first1, last1, first2, comp,
+      typename use_sorting_network_by_key<RandomAccessIterator1,RandomAccessIterator2>::type());
   }
   else
   {
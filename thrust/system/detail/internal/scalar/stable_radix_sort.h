@@ -34,13 +34,15 @@ namespace internal
 namespace scalar
 {
 
+// these return false, leaving their input unchanged, if
+// their temporary storage can't be allocated
 template<typename RandomAccessIterator>
-void stable_radix_sort(RandomAccessIterator begin,
+bool stable_radix_sort(RandomAccessIterator begin,
                        RandomAccessIterator end);
 
 template<typename RandomAccessIterator1,
          typename RandomAccessIterator2>
-void stable_radix_sort_by_key(RandomAccessIterator1 keys_begin,
+bool stable_radix_sort_by_key(RandomAccessIterator1 keys_begin,
                               RandomAccessIterator1 keys_end,
                               RandomAccessIterator2 values_begin);
 
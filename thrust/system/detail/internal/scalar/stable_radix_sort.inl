@@ -382,7 +382,7 @@ void radix_sort(RandomAccessIterator1 keys1,
 //////////////
 
 template <typename RandomAccessIterator>
-void stable_radix_sort(RandomAccessIterator first,
+bool stable_radix_sort(RandomAccessIterator first,
                        RandomAccessIterator last)
 {
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
@@ -390,9 +390,14 @@ void stable_radix_sort(RandomAccessIterator first,
 
   size_t N = last - first;
   
-  thrust::detail::temporary_array<KeyType, system> temp(N);
+  thrust::detail::temporary_array<KeyType, system> temp(0);
+
+  if(!temp.try_allocate(N))
+    return false;
   
   detail::radix_sort(first, temp.begin(), N);
+
+  return true;
 }
 
 
@@ -402,7 +407,7 @@ void stable_radix_sort(RandomAccessIterator first,
 
 template <typename RandomAccessIterator1,
           typename RandomAccessIterator2>
-void stable_radix_sort_by_key(RandomAccessIterator1 first1,
+bool stable_radix_sort_by_key(RandomAccessIterator1 first1,
                               RandomAccessIterator1 last1,
                               RandomAccessIterator2 first2)
 {
@@ -414,10 +419,15 @@ void stable_radix_sort_by_key(RandomAccessIterator1 first1,
 
   size_t N = last1 - first1;
   
-  thrust::detail::temporary_array<KeyType, system>   temp1(N);
-  thrust::detail::temporary_array<ValueType, system> temp2(N);
+  thrust::detail::temporary_array<KeyType, system>   temp1(0);
+  thrust::detail::temporary_array<ValueType, system> temp2(0);
+
+  if(!temp1.try_allocate(N) || !temp2.try_allocate(N))
+    return false;
 
   detail::radix_sort(first1, temp1.begin(), first2, temp2.begin(), N);
+
+  return true;
 }
 
 } // end namespace scalar
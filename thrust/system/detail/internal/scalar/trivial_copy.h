@@ -21,7 +21,13 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/detail/cstdint.h>
 #include <cstring>
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif // __SSE2__
 
 namespace thrust
 {
@@ -43,6 +49,53 @@ template<typename T>
   return result + n;
 } // end trivial_copy_n()
 
+
+// copies between buffers which do not overlap with stores which bypass the
+// cache where the target supports them, so that a copy larger than the cache
+// does not evict everything else from it before being evicted itself
+template<typename T>
+  T *streaming_copy_n(const T *first,
+                      std::ptrdiff_t n,
+                      T *result)
+{
+#if defined(__SSE2__)
+  const char *src = reinterpret_cast<const char*>(first);
+  char *dst       = reinterpret_cast<char*>(result);
+  std::size_t bytes = n * sizeof(T);
+
+  // copy normally up to the destination's first 16-byte boundary
+  std::size_t head = (16 - thrust::detail::uintptr_t(dst) % 16) % 16;
+  if(head > bytes) head = bytes;
+
+  std::memcpy(dst, src, head);
+  src += head;
+  dst += head;
+  bytes -= head;
+
+  for(; bytes >= 64; bytes -= 64, src += 64, dst += 64)
+  {
+    __m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst),      x0);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), x1);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), x2);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), x3);
+  }
+
+  std::memcpy(dst, src, bytes);
+
+  // order the streaming stores before any which follow
+  _mm_sfence();
+
+  return result + n;
+#else
+  return thrust::system::detail::internal::scalar::trivial_copy_n(first, n, result);
+#endif // __SSE2__
+} // end streaming_copy_n()
+
 } // end namespace scalar
 } // end namespace internal
 } // end namespace detail
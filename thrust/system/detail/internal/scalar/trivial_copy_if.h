@@ -0,0 +1,262 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file trivial_copy_if.h
+ *  \brief Sequential stream compaction for plain-old-data.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif // __AVX2__
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace trivial_copy_if_detail
+{
+
+
+// the number of elements staged on the stack before they are flushed to the output
+const std::ptrdiff_t tile_size = 256;
+
+// the widest vector used by compact_tile, in elements
+const std::ptrdiff_t max_lanes = 8;
+
+
+#if defined(__AVX2__)
+
+// a permutation_table maps the predicate mask of one vector of ElementSize-byte
+// lanes to the 32-bit lane indices which move the selected lanes to the front
+template<unsigned int ElementSize> struct permutation_table;
+
+template<>
+  struct permutation_table<4>
+{
+  static const int num_lanes = 8;
+
+  int indices[256][8];
+  int counts[256];
+
+  permutation_table()
+  {
+    for(int mask = 0; mask < 256; ++mask)
+    {
+      int k = 0;
+
+      for(int lane = 0; lane < num_lanes; ++lane)
+      {
+        if(mask & (1 << lane))
+        {
+          indices[mask][k] = lane;
+          ++k;
+        }
+      }
+
+      counts[mask] = k;
+
+      for(; k < num_lanes; ++k)
+        indices[mask][k] = 0;
+    }
+  }
+};
+
+template<>
+  struct permutation_table<8>
+{
+  static const int num_lanes = 4;
+
+  // each 64-bit lane is moved as a pair of 32-bit lanes
+  int indices[16][8];
+  int counts[16];
+
+  permutation_table()
+  {
+    for(int mask = 0; mask < 16; ++mask)
+    {
+      int k = 0;
+
+      for(int lane = 0; lane < num_lanes; ++lane)
+      {
+        if(mask & (1 << lane))
+        {
+          indices[mask][2 * k]     = 2 * lane;
+          indices[mask][2 * k + 1] = 2 * lane + 1;
+          ++k;
+        }
+      }
+
+      counts[mask] = k;
+
+      for(; k < num_lanes; ++k)
+      {
+        indices[mask][2 * k]     = 0;
+        indices[mask][2 * k + 1] = 0;
+      }
+    }
+  }
+};
+
+template<unsigned int ElementSize>
+  const permutation_table<ElementSize> &get_permutation_table()
+{
+  static const permutation_table<ElementSize> table;
+  return table;
+}
+
+
+template<typename T>
+  struct use_permutation
+    : thrust::detail::integral_constant<bool, sizeof(T) == 4 || sizeof(T) == 8>
+{};
+
+#else
+
+template<typename T>
+  struct use_permutation
+    : thrust::detail::false_type
+{};
+
+#endif // __AVX2__
+
+
+// branch-free store-and-advance: every element is written to the buffer,
+// but the output position only advances past the selected ones
+template<typename T,
+         typename InputIterator,
+         typename Predicate>
+  std::ptrdiff_t compact_tile(const T *first,
+                              std::ptrdiff_t n,
+                              InputIterator &stencil,
+                              T *buffer,
+                              Predicate &pred,
+                              thrust::detail::false_type) // use_permutation
+{
+  std::ptrdiff_t k = 0;
+
+  for(std::ptrdiff_t i = 0; i < n; ++i, ++stencil)
+  {
+    buffer[k] = first[i];
+    k += static_cast<bool>(pred(*stencil));
+  }
+
+  return k;
+} // end compact_tile()
+
+
+#if defined(__AVX2__)
+template<typename T,
+         typename InputIterator,
+         typename Predicate>
+  std::ptrdiff_t compact_tile(const T *first,
+                              std::ptrdiff_t n,
+                              InputIterator &stencil,
+                              T *buffer,
+                              Predicate &pred,
+                              thrust::detail::true_type) // use_permutation
+{
+  typedef permutation_table<sizeof(T)> table_type;
+
+  const table_type &table = get_permutation_table<sizeof(T)>();
+  const std::ptrdiff_t num_lanes = table_type::num_lanes;
+
+  std::ptrdiff_t i = 0;
+  std::ptrdiff_t k = 0;
+
+  for(; i + num_lanes <= n; i += num_lanes)
+  {
+    unsigned int mask = 0;
+
+    for(std::ptrdiff_t lane = 0; lane < num_lanes; ++lane, ++stencil)
+    {
+      mask |= static_cast<unsigned int>(static_cast<bool>(pred(*stencil))) << lane;
+    }
+
+    __m256i values  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+    __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.indices[mask]));
+
+    // the full vector is stored, but only counts[mask] lanes of it are kept
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + k), _mm256_permutevar8x32_epi32(values, indices));
+
+    k += table.counts[mask];
+  }
+
+  // finish the ragged end one element at a time
+  k += compact_tile(first + i, n - i, stencil, buffer + k, pred, thrust::detail::false_type());
+
+  return k;
+} // end compact_tile()
+#endif // __AVX2__
+
+
+} // end trivial_copy_if_detail
+
+
+// copies the elements of [first, first + n) whose corresponding stencil
+// element satisfies pred to result, preserving their relative order.
+// result may alias first so long as result <= first.
+template<typename T,
+         typename InputIterator,
+         typename Predicate>
+  T *trivial_copy_if_n(const T *first,
+                       std::ptrdiff_t n,
+                       InputIterator stencil,
+                       T *result,
+                       Predicate pred)
+{
+  using namespace trivial_copy_if_detail;
+
+  // the selected elements of each tile are staged here, with room
+  // for a vector store beginning at the last element of the tile
+  T buffer[tile_size + max_lanes];
+
+  while(n > 0)
+  {
+    const std::ptrdiff_t m = (n < tile_size) ? n : tile_size;
+
+    const std::ptrdiff_t k =
+      compact_tile(first, m, stencil, buffer, pred, typename use_permutation<T>::type());
+
+    // the tile has been consumed before it is overwritten, so result may trail first
+    std::memmove(result, buffer, k * sizeof(T));
+
+    first  += m;
+    result += k;
+    n      -= m;
+  } // end while
+
+  return result;
+} // end trivial_copy_if_n()
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
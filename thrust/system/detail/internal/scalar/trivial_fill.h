@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file trivial_fill.h
+ *  \brief Sequential fill algorithms for plain-old-data.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+#include <cstring>
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif // __SSE2__
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scalar
+{
+namespace trivial_fill_detail
+{
+
+// returns true when every byte of value is the same, in which case
+// a range of copies of value is a range of copies of that byte
+template<typename T>
+  bool is_byte_pattern(const T &value)
+{
+  const unsigned char *bytes = reinterpret_cast<const unsigned char*>(&value);
+
+  for(std::size_t i = 1; i < sizeof(T); ++i)
+  {
+    if(bytes[i] != bytes[0]) return false;
+  }
+
+  return true;
+} // end is_byte_pattern()
+
+} // end trivial_fill_detail
+
+
+template<typename T>
+  T *trivial_fill_n(T *first,
+                    std::ptrdiff_t n,
+                    const T &value)
+{
+  if(trivial_fill_detail::is_byte_pattern(value))
+  {
+    std::memset(first, *reinterpret_cast<const unsigned char*>(&value), n * sizeof(T));
+  }
+  else
+  {
+    for(std::ptrdiff_t i = 0; i < n; ++i)
+    {
+      first[i] = value;
+    }
+  }
+
+  return first + n;
+} // end trivial_fill_n()
+
+
+namespace trivial_fill_detail
+{
+
+// elements which do not tile 16-byte vectors are filled with ordinary stores
+template<typename T>
+  T *streaming_fill_n(T *first,
+                      std::ptrdiff_t n,
+                      const T &value,
+                      thrust::detail::false_type) // tiles_vectors
+{
+  return thrust::system::detail::internal::scalar::trivial_fill_n(first, n, value);
+} // end streaming_fill_n()
+
+
+template<typename T>
+  T *streaming_fill_n(T *first,
+                      std::ptrdiff_t n,
+                      const T &value,
+                      thrust::detail::true_type) // tiles_vectors
+{
+#if defined(__SSE2__)
+  // the vectors must begin at a 16-byte boundary
+  const std::size_t head = (16 - thrust::detail::uintptr_t(first) % 16) % 16;
+
+  if(head % sizeof(T) != 0)
+  {
+    return thrust::system::detail::internal::scalar::trivial_fill_n(first, n, value);
+  }
+
+  const std::ptrdiff_t num_head = head / sizeof(T);
+
+  if(n <= num_head)
+  {
+    return thrust::system::detail::internal::scalar::trivial_fill_n(first, n, value);
+  }
+
+  T *dst = thrust::system::detail::internal::scalar::trivial_fill_n(first, num_head, value);
+
+  T pattern[16 / sizeof(T)];
+  thrust::system::detail::internal::scalar::trivial_fill_n(pattern, 16 / sizeof(T), value);
+
+  const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+
+  char *bytes = reinterpret_cast<char*>(dst);
+  char *bytes_last = bytes + (n - num_head) * sizeof(T);
+
+  for(; bytes_last - bytes >= 16; bytes += 16)
+  {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(bytes), x);
+  }
+
+  thrust::system::detail::internal::scalar::trivial_fill_n(reinterpret_cast<T*>(bytes), (bytes_last - bytes) / sizeof(T), value);
+
+  // order the streaming stores before any which follow
+  _mm_sfence();
+
+  return first + n;
+#else
+  return thrust::system::detail::internal::scalar::trivial_fill_n(first, n, value);
+#endif // __SSE2__
+} // end streaming_fill_n()
+
+} // end trivial_fill_detail
+
+
+// fills with stores which bypass the cache where the target supports them,
+// so that a fill larger than the cache does not evict everything else from it
+template<typename T>
+  T *streaming_fill_n(T *first,
+                      std::ptrdiff_t n,
+                      const T &value)
+{
+  // only elements whose size divides 16 tile 16-byte vectors
+  return trivial_fill_detail::streaming_fill_n(first, n, value,
+    thrust::detail::integral_constant<bool, (16 % sizeof(T) == 0)>());
+} // end streaming_fill_n()
+
+} // end namespace scalar
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
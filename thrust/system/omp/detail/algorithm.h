@@ -25,15 +25,20 @@
 #include <thrust/system/omp/detail/binary_search.h>
 #include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/fill.h>
 #include <thrust/system/omp/detail/extrema.h>
 #include <thrust/system/omp/detail/find.h>
 #include <thrust/system/omp/detail/for_each.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/malloc_and_free.h>
+#include <thrust/system/omp/detail/page_placement.h>
 #include <thrust/system/omp/detail/partition.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/omp/detail/sort.h>
+#include <thrust/system/omp/detail/temporary_buffer.h>
 #include <thrust/system/omp/detail/unique.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 
@@ -21,6 +21,12 @@
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/cpp/detail/copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/detail/dispatch/is_trivial_copy.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/detail/static_assert.h>
+#include <cstddef>
 
 namespace thrust
 {
@@ -30,6 +36,69 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// returns the raw pointer associated with a Pointer-like thing
+template<typename Pointer>
+  typename thrust::detail::pointer_traits<Pointer>::raw_pointer
+    get(Pointer ptr)
+{
+  return thrust::detail::pointer_traits<Pointer>::get(ptr);
+}
+
+
+// copies [first, first + n) to result with one memcpy per thread,
+// each of which writes only to whole pages of result
+template<typename T>
+  T *trivial_copy_n(const T *first,
+                    std::ptrdiff_t n,
+                    T *result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<T,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace internal = thrust::system::detail::internal;
+
+  const std::size_t num_bytes = n * sizeof(T);
+
+  // overlapping ranges must be copied in order
+  if(num_bytes < internal::min_parallel_bytes || internal::overlaps(first, result, n))
+  {
+    return internal::scalar::trivial_copy_n(first, n, result);
+  }
+
+  const bool streaming = internal::use_streaming_stores(num_bytes);
+
+  internal::page_decomposition<T> pages(result, n);
+
+  internal::uniform_decomposition<std::ptrdiff_t> decomp = default_decomposition(pages.size());
+
+  const std::ptrdiff_t num_intervals = decomp.size();
+
+#pragma omp parallel for
+  for(std::ptrdiff_t i = 0; i < num_intervals; ++i)
+  {
+    internal::copy_interval(first, result, pages(decomp[i].begin(), decomp[i].end()), streaming);
+  }
+
+  return result + n;
+#else
+  return thrust::system::detail::internal::scalar::trivial_copy_n(first, n, result);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end trivial_copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -92,15 +161,34 @@ template<typename InputIterator,
   return thrust::system::detail::generic::copy_n(tag(), thrust::reinterpret_tag<tag>(first), n, retagged_result).base();
 } // end copy_n()
 
-} // end dispatch
 
 
 template<typename InputIterator,
          typename OutputIterator>
-OutputIterator copy(tag,
-                    InputIterator first,
-                    InputIterator last,
-                    OutputIterator result)
+  OutputIterator copy(InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::true_type) // is_trivial_copy
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n > 0)
+  {
+    copy_detail::trivial_copy_n(copy_detail::get(&*first), n, copy_detail::get(&*result));
+  }
+
+  return result + n;
+} // end copy()
+
+
+template<typename InputIterator,
+         typename OutputIterator>
+  OutputIterator copy(InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::false_type) // is_trivial_copy
 {
   typedef typename thrust::iterator_traversal<InputIterator>::type  traversal1;
   typedef typename thrust::iterator_traversal<OutputIterator>::type traversal2;
@@ -112,14 +200,30 @@ OutputIterator copy(tag,
 } // end copy()
 
 
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_trivial_copy
+{
+  if(n > 0)
+  {
+    copy_detail::trivial_copy_n(copy_detail::get(&*first), n, copy_detail::get(&*result));
+  }
+
+  return result + n;
+} // end copy_n()
+
 
 template<typename InputIterator,
          typename Size,
          typename OutputIterator>
-OutputIterator copy_n(tag,
-                      InputIterator first,
-                      Size n,
-                      OutputIterator result)
+  OutputIterator copy_n(InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_trivial_copy
 {
   typedef typename thrust::iterator_traversal<InputIterator>::type  traversal1;
   typedef typename thrust::iterator_traversal<OutputIterator>::type traversal2;
@@ -130,6 +234,34 @@ OutputIterator copy_n(tag,
   return thrust::system::omp::detail::dispatch::copy_n(first,n,result,traversal());
 } // end copy_n()
 
+} // end dispatch
+
+
+template<typename InputIterator,
+         typename OutputIterator>
+OutputIterator copy(tag,
+                    InputIterator first,
+                    InputIterator last,
+                    OutputIterator result)
+{
+  return thrust::system::omp::detail::dispatch::copy(first,last,result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
+} // end copy()
+
+
+
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+OutputIterator copy_n(tag,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result)
+{
+  return thrust::system::omp::detail::dispatch::copy_n(first,n,result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
+} // end copy_n()
+
 
 } // end namespace detail
 } // end namespace omp
@@ -18,7 +18,13 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/copy_if.h>
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/scalar/copy_if.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
 
 namespace thrust
 {
@@ -41,8 +47,77 @@ template<typename InputIterator1,
                          OutputIterator result,
                          Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(tag(), first, last, stencil, result, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  IndexType n = thrust::distance(first, last);
+
+  if (n == 0)
+    return result;
+
+  // wrap pred
+  thrust::detail::host_function<Predicate,bool> wrapped_pred(pred);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n);
+
+  IndexType num_tiles = decomp.size();
+
+  // offsets[i] is the position in the output of the first element selected from tile i
+  thrust::detail::temporary_array<IndexType, tag> offsets(num_tiles + 1);
+
+  offsets[0] = 0;
+
+  // count the selected elements of each tile
+#pragma omp parallel for
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    InputIterator2 iter = stencil + decomp[i].begin();
+    InputIterator2 end  = stencil + decomp[i].end();
+
+    IndexType count = 0;
+
+    for(; iter != end; ++iter)
+    {
+      count += wrapped_pred(*iter);
+    }
+
+    offsets[i + 1] = count;
+  }
+
+  // scan the counts into offsets
+  IndexType sum = 0;
+
+  for(IndexType i = 0; i <= num_tiles; ++i)
+  {
+    sum += offsets[i];
+    offsets[i] = sum;
+  }
+
+  // every thread compacts its own tile into place
+#pragma omp parallel for
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    IndexType offset = offsets[i];
+
+    thrust::system::detail::internal::scalar::copy_if(first   + decomp[i].begin(),
+                                                      first   + decomp[i].end(),
+                                                      stencil + decomp[i].begin(),
+                                                      result  + offset,
+                                                      pred);
+  }
+
+  return result + sum;
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 } // end copy_if()
 
 
@@ -50,4 +125,3 @@ template<typename InputIterator1,
 } // end omp
 } // end system
 } // end thrust
-
@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file fill.inl
+ *  \brief Inline file for fill.h.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/fill.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace fill_detail
+{
+
+
+// returns the raw pointer associated with a Pointer-like thing
+template<typename Pointer>
+  typename thrust::detail::pointer_traits<Pointer>::raw_pointer
+    get(Pointer ptr)
+{
+  return thrust::detail::pointer_traits<Pointer>::get(ptr);
+}
+
+
+// fills [first, first + n) with one memset per thread,
+// each of which writes only to whole pages
+template<typename T>
+  T *trivial_fill_n(T *first,
+                    std::ptrdiff_t n,
+                    const T &value)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<T,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace internal = thrust::system::detail::internal;
+
+  const std::size_t num_bytes = n * sizeof(T);
+
+  if(num_bytes < internal::min_parallel_bytes)
+  {
+    return internal::scalar::trivial_fill_n(first, n, value);
+  }
+
+  const bool streaming = internal::use_streaming_stores(num_bytes);
+
+  internal::page_decomposition<T> pages(first, n);
+
+  internal::uniform_decomposition<std::ptrdiff_t> decomp = default_decomposition(pages.size());
+
+  const std::ptrdiff_t num_intervals = decomp.size();
+
+#pragma omp parallel for
+  for(std::ptrdiff_t i = 0; i < num_intervals; ++i)
+  {
+    internal::fill_interval(first, pages(decomp[i].begin(), decomp[i].end()), value, streaming);
+  }
+
+  return first + n;
+#else
+  return thrust::system::detail::internal::scalar::trivial_fill_n(first, n, value);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end trivial_fill_n()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(OutputIterator first,
+                        Size n,
+                        const T &value,
+                        thrust::detail::true_type) // is_trivial_fill
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type OutputType;
+
+  if(n > 0)
+  {
+    fill_detail::trivial_fill_n(get(&*first), n, static_cast<OutputType>(value));
+  }
+
+  return first + n;
+} // end fill_n()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(OutputIterator first,
+                        Size n,
+                        const T &value,
+                        thrust::detail::false_type) // is_trivial_fill
+{
+  return thrust::system::detail::generic::fill_n(tag(), first, n, value);
+} // end fill_n()
+
+
+template<typename ForwardIterator, typename T>
+  void fill(ForwardIterator first,
+            ForwardIterator last,
+            const T &value,
+            thrust::detail::true_type) // is_trivial_fill
+{
+  fill_detail::fill_n(first, last - first, value, thrust::detail::true_type());
+} // end fill()
+
+
+template<typename ForwardIterator, typename T>
+  void fill(ForwardIterator first,
+            ForwardIterator last,
+            const T &value,
+            thrust::detail::false_type) // is_trivial_fill
+{
+  thrust::system::detail::generic::fill(tag(), first, last, value);
+} // end fill()
+
+
+} // end fill_detail
+
+
+template<typename ForwardIterator, typename T>
+  void fill(tag,
+            ForwardIterator first,
+            ForwardIterator last,
+            const T &value)
+{
+  fill_detail::fill(first, last, value,
+    typename thrust::system::detail::internal::is_trivial_fill<ForwardIterator>::type());
+} // end fill()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(tag,
+                        OutputIterator first,
+                        Size n,
+                        const T &value)
+{
+  return fill_detail::fill_n(first, n, value,
+    typename thrust::system::detail::internal::is_trivial_fill<OutputIterator>::type());
+} // end fill_n()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/tag.h>
+#include <thrust/system/omp/detail/page_placement.h>
+#include <thrust/system/cpp/detail/malloc_and_free.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/system/detail/internal/page_placement.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// omp shares cpp's free, but asks for its large allocations to be interleaved
+// across the memory nodes when get_page_placement() directs
+inline void *malloc(tag, std::size_t n)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  void *result = thrust::system::cpp::detail::malloc(thrust::system::cpp::tag(), n);
+
+  if(result && n >= internal::min_parallel_bytes && get_page_placement() == interleaved_placement)
+  {
+    internal::interleave_pages(result, n);
+  } // end if
+
+  return result;
+} // end malloc()
+
+
+// omp shares cpp's aligned_free
+inline void *aligned_malloc(tag, std::size_t n, std::size_t alignment)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  void *result = thrust::system::cpp::detail::aligned_malloc(thrust::system::cpp::tag(), n, alignment);
+
+  if(result && n >= internal::min_parallel_bytes && get_page_placement() == interleaved_placement)
+  {
+    internal::interleave_pages(result, n);
+  } // end if
+
+  return result;
+} // end aligned_malloc()
+
+
+} // end detail
+} // end omp
+} // end system
+} // end thrust
+
@@ -0,0 +1,229 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/multisequence_partition.h>
+#include <thrust/system/detail/internal/scalar/multiway_merge.h>
+#include <thrust/system/cpp/detail/tag.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// the output is divided into as many parts as there are processors. the splits of the
+// ranges at the beginning of each part are found independently, and then each part is
+// merged from the pieces of the ranges between its splits and those of the next part
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge_n(tag,
+                       RangeIterator ranges,
+                       Size n,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RangeIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_value<RangeIterator>::type      range_type;
+  typedef typename range_type::first_type                          InputIterator;
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  namespace internal = thrust::system::detail::internal;
+
+  thrust::detail::temporary_array<range_type, thrust::system::cpp::tag> temp(ranges, ranges + n);
+
+  range_type *all = thrust::raw_pointer_cast(temp.begin().base());
+
+  IndexType num_elements = 0;
+
+  for(Size i = 0; i < n; ++i)
+  {
+    num_elements += all[i].second - all[i].first;
+  }
+
+  internal::uniform_decomposition<IndexType> decomp = default_decomposition(num_elements);
+
+  IndexType num_parts = decomp.size();
+
+  if(num_parts <= 1 || n <= 1)
+  {
+    return internal::scalar::multiway_merge(all, n, result, comp);
+  }
+
+  // splits[p * n + i] is the position in range i of its first element in part p
+  thrust::detail::temporary_array<IndexType, thrust::system::cpp::tag> splits_storage((num_parts + 1) * n);
+  thrust::detail::temporary_array<IndexType, thrust::system::cpp::tag> scratch_storage(num_parts * 2 * n);
+  thrust::detail::temporary_array<range_type, thrust::system::cpp::tag> pieces_storage(num_parts * n);
+
+  IndexType  *splits  = thrust::raw_pointer_cast(splits_storage.begin().base());
+  IndexType  *scratch = thrust::raw_pointer_cast(scratch_storage.begin().base());
+  range_type *pieces  = thrust::raw_pointer_cast(pieces_storage.begin().base());
+
+  for(Size i = 0; i < n; ++i)
+  {
+    splits[i]                 = 0;
+    splits[num_parts * n + i] = all[i].second - all[i].first;
+  }
+
+#pragma omp parallel for
+  for(IndexType p = 1; p < num_parts; ++p)
+  {
+    internal::multisequence_partition(all, n, decomp[p].begin(), splits + p * n, scratch + p * 2 * n, comp);
+  }
+
+#pragma omp parallel for
+  for(IndexType p = 0; p < num_parts; ++p)
+  {
+    range_type *part = pieces + p * n;
+
+    for(Size i = 0; i < n; ++i)
+    {
+      part[i] = range_type(all[i].first + splits[p * n + i], all[i].first + splits[(p + 1) * n + i]);
+    }
+
+    internal::scalar::multiway_merge(part, n, result + decomp[p].begin(), comp);
+  }
+
+  return result + num_elements;
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end merge_n()
+
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RangeIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_value<RangeIterator>::type         range_type;
+  typedef typename range_type::first_type                             InputIterator1;
+  typedef typename thrust::iterator_value<ValueIteratorIterator>::type InputIterator2;
+  typedef typename thrust::iterator_difference<InputIterator1>::type   IndexType;
+
+  namespace internal = thrust::system::detail::internal;
+
+  thrust::detail::temporary_array<range_type, thrust::system::cpp::tag>     temp_key_ranges(key_ranges, key_ranges + n);
+  thrust::detail::temporary_array<InputIterator2, thrust::system::cpp::tag> temp_values(values, values + n);
+
+  range_type     *all_keys   = thrust::raw_pointer_cast(temp_key_ranges.begin().base());
+  InputIterator2 *all_values = thrust::raw_pointer_cast(temp_values.begin().base());
+
+  IndexType num_elements = 0;
+
+  for(Size i = 0; i < n; ++i)
+  {
+    num_elements += all_keys[i].second - all_keys[i].first;
+  }
+
+  internal::uniform_decomposition<IndexType> decomp = default_decomposition(num_elements);
+
+  IndexType num_parts = decomp.size();
+
+  if(num_parts <= 1 || n <= 1)
+  {
+    return internal::scalar::multiway_merge_by_key(all_keys, all_values, n, keys_result, values_result, comp);
+  }
+
+  // splits[p * n + i] is the position in range i of its first element in part p
+  thrust::detail::temporary_array<IndexType, thrust::system::cpp::tag>      splits_storage((num_parts + 1) * n);
+  thrust::detail::temporary_array<IndexType, thrust::system::cpp::tag>      scratch_storage(num_parts * 2 * n);
+  thrust::detail::temporary_array<range_type, thrust::system::cpp::tag>     key_pieces_storage(num_parts * n);
+  thrust::detail::temporary_array<InputIterator2, thrust::system::cpp::tag> value_pieces_storage(num_parts * n);
+
+  IndexType      *splits       = thrust::raw_pointer_cast(splits_storage.begin().base());
+  IndexType      *scratch      = thrust::raw_pointer_cast(scratch_storage.begin().base());
+  range_type     *key_pieces   = thrust::raw_pointer_cast(key_pieces_storage.begin().base());
+  InputIterator2 *value_pieces = thrust::raw_pointer_cast(value_pieces_storage.begin().base());
+
+  for(Size i = 0; i < n; ++i)
+  {
+    splits[i]                 = 0;
+    splits[num_parts * n + i] = all_keys[i].second - all_keys[i].first;
+  }
+
+#pragma omp parallel for
+  for(IndexType p = 1; p < num_parts; ++p)
+  {
+    internal::multisequence_partition(all_keys, n, decomp[p].begin(), splits + p * n, scratch + p * 2 * n, comp);
+  }
+
+#pragma omp parallel for
+  for(IndexType p = 0; p < num_parts; ++p)
+  {
+    range_type     *key_part   = key_pieces   + p * n;
+    InputIterator2 *value_part = value_pieces + p * n;
+
+    for(Size i = 0; i < n; ++i)
+    {
+      key_part[i]   = range_type(all_keys[i].first + splits[p * n + i], all_keys[i].first + splits[(p + 1) * n + i]);
+      value_part[i] = all_values[i] + splits[p * n + i];
+    }
+
+    internal::scalar::multiway_merge_by_key(key_part, value_part, n, keys_result + decomp[p].begin(), values_result + decomp[p].begin(), comp);
+  }
+
+  return thrust::make_pair(keys_result + num_elements, values_result + num_elements);
+#else
+  return thrust::make_pair(keys_result, values_result);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end merge_n_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -25,9 +25,10 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/cpp/detail/sort.h>
-#include <thrust/system/cpp/detail/merge.h>
 #include <thrust/system/cpp/detail/tag.h>
-#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/scalar/adaptive_merge.h>
+#include <thrust/system/detail/internal/low_memory.h>
+#include <thrust/detail/function.h>
 
 namespace thrust
 {
@@ -49,14 +50,17 @@ void inplace_merge(Tag,
                    RandomAccessIterator last,
                    StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
-
-  thrust::detail::temporary_array<value_type,Tag> a( first, middle);
-  thrust::detail::temporary_array<value_type,Tag> b(middle,   last);
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  // the tiles are already in order
+  if(!wrapped_comp(*middle, *(middle - 1)))
+    return;
 
-  thrust::system::cpp::detail::merge
-    (thrust::cpp::tag(),
-     a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  thrust::system::detail::internal::scalar::adaptive_merge(first, middle, last, wrapped_comp);
 }
 
 template <typename Tag,
@@ -70,22 +74,17 @@ void inplace_merge_by_key(Tag,
                           RandomAccessIterator2 first2,
                           StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type1;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type2;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
-
-  thrust::detail::temporary_array<value_type1,Tag> lhs1( first1, middle1);
-  thrust::detail::temporary_array<value_type1,Tag> rhs1(middle1,   last1);
-  thrust::detail::temporary_array<value_type2,Tag> lhs2( first2, middle2);
-  thrust::detail::temporary_array<value_type2,Tag> rhs2(middle2,   last2);
-
-  thrust::system::cpp::detail::merge_by_key
-    (thrust::cpp::tag(),
-     lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(),
-     lhs2.begin(), rhs2.begin(),
-     first1, first2, comp);
+  // wrap comp
+  thrust::detail::host_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  // the tiles are already in order
+  if(!wrapped_comp(*middle1, *(middle1 - 1)))
+    return;
+
+  thrust::system::detail::internal::scalar::adaptive_merge_by_key(first1, middle1, last1, first2, wrapped_comp);
 }
 
 
@@ -111,14 +110,20 @@ void stable_sort(Tag,
   if (first == last)
     return;
 
+  thrust::system::detail::internal::parallel_low_memory_record low_memory_record;
+
   #pragma omp parallel
   {
+    // observe this thread's fallbacks apart from those of the others
+    thrust::low_memory_monitor thread_monitor;
+    thrust::detail::low_memory_monitor_access::detach(thread_monitor);
+
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
 
-    // every thread sorts its own tile
+    // every thread sorts its own tile, merging the runs already present in it
     if (p_i < decomp.size())
     {
       // call cpp's sort directly so RandomAccessIterator's tag isn't lost in a retag
@@ -158,7 +163,12 @@ void stable_sort(Tag,
 
         #pragma omp barrier
     }
+
+    #pragma omp critical
+    low_memory_record.add(thread_monitor);
   }
+
+  low_memory_record.record();
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -186,14 +196,20 @@ void stable_sort_by_key(Tag,
   if (keys_first == keys_last)
     return;
 
+  thrust::system::detail::internal::parallel_low_memory_record low_memory_record;
+
   #pragma omp parallel
   {
+    // observe this thread's fallbacks apart from those of the others
+    thrust::low_memory_monitor thread_monitor;
+    thrust::detail::low_memory_monitor_access::detach(thread_monitor);
+
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
 
-    // every thread sorts its own tile
+    // every thread sorts its own tile, merging the runs already present in it
     if (p_i < decomp.size())
     {
       // call cpp's stable_sort_by_key directly so iterators' tag isn't lost in a retag
@@ -235,7 +251,12 @@ void stable_sort_by_key(Tag,
 
         #pragma omp barrier
     }
+
+    #pragma omp critical
+    low_memory_record.add(thread_monitor);
   }
+
+  low_memory_record.record();
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file temporary_buffer.h
+ *  \brief Temporary buffers of the omp system, which share cpp's
+ *         but place the pages of those fresh from the system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/tag.h>
+#include <thrust/system/omp/detail/page_placement.h>
+#include <thrust/system/cpp/detail/temporary_buffer.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/pair.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// return_temporary_buffer is cpp's
+template<typename T>
+  thrust::pair<T*, std::ptrdiff_t>
+    get_temporary_buffer(tag, std::ptrdiff_t n)
+{
+  bool is_new = false;
+
+  T *result = static_cast<T*>(thrust::system::cpp::detail::temporary_buffer_detail::allocate(sizeof(T) * n, &is_new));
+
+  // recycled buffers were placed when they were new
+  if(is_new && sizeof(T) * n >= thrust::system::detail::internal::min_parallel_bytes)
+  {
+    place_pages(tag(), result, n);
+  } // end if
+
+  return thrust::make_pair(result, result ? n : std::ptrdiff_t(0));
+} // end get_temporary_buffer()
+
+
+} // end detail
+} // end omp
+} // end system
+} // end thrust
+
@@ -25,6 +25,7 @@
 #include <thrust/system/omp/memory.h>
 #include <thrust/detail/vector_base.h>
 #include <vector>
+#include <utility>
 
 namespace thrust
 {
@@ -86,11 +87,31 @@ template<typename T, typename Allocator = allocator<T> >
      */
     explicit vector(size_type n, const value_type &value = value_type());
 
+    /*! This constructor creates a \p omp::vector with \p n default-initialized elements,
+     *  which are left uninitialized if their type has a trivial constructor.
+     *  \param n The size of the \p omp::vector to create.
+     */
+    vector(size_type n, default_init_t);
+
+    /*! This constructor creates a \p omp::vector with \p n default-initialized elements,
+     *  whose memory is placed as \p omp::get_page_placement directs.
+     *  \param n The size of the \p omp::vector to create.
+     *  \see first_touch
+     */
+    vector(size_type n, first_touch_t);
+
     /*! Copy constructor copies from another \p omp::vector.
      *  \param x The other \p omp::vector to copy.
      */
     vector(const vector &x);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move constructor takes the elements of another \p omp::vector, leaving it empty.
+     *  \param x The other \p omp::vector to move from.
+     */
+    vector(vector &&x) noexcept;
+#endif
+
     /*! This constructor copies from another Thrust vector-like object.
      *  \param x The other object to copy from.
      */
@@ -112,6 +133,20 @@ template<typename T, typename Allocator = allocator<T> >
 
     // XXX vector_base should take a Derived type so we don't have to define these superfluous assigns
 
+    /*! Assignment operator assigns from another \p omp::vector.
+     *  \param x The other \p omp::vector to assign from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(const vector &x);
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move assignment operator takes the elements of another \p omp::vector, leaving it empty.
+     *  \param x The other \p omp::vector to move from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(vector &&x) noexcept;
+#endif
+
     /*! Assignment operator assigns from a \c std::vector.
      *  \param x The \c std::vector to assign from.
      *  \return <tt>*this</tt>
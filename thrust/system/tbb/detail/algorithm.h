@@ -23,9 +23,13 @@
 
 #include <thrust/system/tbb/detail/copy.h>
 #include <thrust/system/tbb/detail/copy_if.h>
+#include <thrust/system/tbb/detail/fill.h>
 #include <thrust/system/tbb/detail/for_each.h>
+#include <thrust/system/tbb/detail/malloc_and_free.h>
 #include <thrust/system/tbb/detail/merge.h>
+#include <thrust/system/tbb/detail/page_placement.h>
 #include <thrust/system/tbb/detail/reduce.h>
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/system/tbb/detail/sort.h>
+#include <thrust/system/tbb/detail/temporary_buffer.h>
 
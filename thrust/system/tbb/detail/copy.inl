@@ -21,6 +21,12 @@
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/cpp/detail/copy.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/detail/dispatch/is_trivial_copy.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <cstddef>
 
 namespace thrust
 {
@@ -30,6 +36,70 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// returns the raw pointer associated with a Pointer-like thing
+template<typename Pointer>
+  typename thrust::detail::pointer_traits<Pointer>::raw_pointer
+    get(Pointer ptr)
+{
+  return thrust::detail::pointer_traits<Pointer>::get(ptr);
+}
+
+
+template<typename T>
+  struct trivial_copy_body
+{
+  const T *m_first;
+  T *m_result;
+  thrust::system::detail::internal::page_decomposition<T> m_pages;
+  bool m_streaming;
+
+  trivial_copy_body(const T *first, T *result, const thrust::system::detail::internal::page_decomposition<T> &pages, bool streaming)
+    : m_first(first), m_result(result), m_pages(pages), m_streaming(streaming)
+  {}
+
+  // r is a range of pages of the result
+  void operator()(const ::tbb::blocked_range<std::ptrdiff_t> &r) const
+  {
+    thrust::system::detail::internal::copy_interval(m_first, m_result, m_pages(r.begin(), r.end()), m_streaming);
+  } // end operator()()
+}; // end trivial_copy_body
+
+
+// copies [first, first + n) to result with one memcpy per task,
+// each of which writes only to whole pages of result
+template<typename T>
+  T *trivial_copy_n(const T *first,
+                    std::ptrdiff_t n,
+                    T *result)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  const std::size_t num_bytes = n * sizeof(T);
+
+  // overlapping ranges must be copied in order
+  if(num_bytes < internal::min_parallel_bytes || internal::overlaps(first, result, n))
+  {
+    return internal::scalar::trivial_copy_n(first, n, result);
+  }
+
+  internal::page_decomposition<T> pages(result, n);
+
+  const std::ptrdiff_t grain_size = internal::min_parallel_bytes / internal::page_size;
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, pages.size(), grain_size),
+                      trivial_copy_body<T>(first, result, pages, internal::use_streaming_stores(num_bytes)));
+
+  return result + n;
+} // end trivial_copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -78,15 +148,34 @@ template<typename InputIterator,
   return thrust::system::detail::generic::copy_n(tag(), first, n, result);
 } // end copy_n()
 
-} // end dispatch
 
 
 template<typename InputIterator,
          typename OutputIterator>
-OutputIterator copy(tag,
-                    InputIterator first,
-                    InputIterator last,
-                    OutputIterator result)
+  OutputIterator copy(InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::true_type) // is_trivial_copy
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n > 0)
+  {
+    copy_detail::trivial_copy_n(copy_detail::get(&*first), n, copy_detail::get(&*result));
+  }
+
+  return result + n;
+} // end copy()
+
+
+template<typename InputIterator,
+         typename OutputIterator>
+  OutputIterator copy(InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::false_type) // is_trivial_copy
 {
   typedef typename thrust::iterator_traversal<InputIterator>::type  traversal1;
   typedef typename thrust::iterator_traversal<OutputIterator>::type traversal2;
@@ -98,14 +187,30 @@ OutputIterator copy(tag,
 } // end copy()
 
 
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_trivial_copy
+{
+  if(n > 0)
+  {
+    copy_detail::trivial_copy_n(copy_detail::get(&*first), n, copy_detail::get(&*result));
+  }
+
+  return result + n;
+} // end copy_n()
+
 
 template<typename InputIterator,
          typename Size,
          typename OutputIterator>
-OutputIterator copy_n(tag,
-                      InputIterator first,
-                      Size n,
-                      OutputIterator result)
+  OutputIterator copy_n(InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_trivial_copy
 {
   typedef typename thrust::iterator_traversal<InputIterator>::type  traversal1;
   typedef typename thrust::iterator_traversal<OutputIterator>::type traversal2;
@@ -116,6 +221,34 @@ OutputIterator copy_n(tag,
   return thrust::system::tbb::detail::dispatch::copy_n(first,n,result,traversal());
 } // end copy_n()
 
+} // end dispatch
+
+
+template<typename InputIterator,
+         typename OutputIterator>
+OutputIterator copy(tag,
+                    InputIterator first,
+                    InputIterator last,
+                    OutputIterator result)
+{
+  return thrust::system::tbb::detail::dispatch::copy(first,last,result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
+} // end copy()
+
+
+
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+OutputIterator copy_n(tag,
+                      InputIterator first,
+                      Size n,
+                      OutputIterator result)
+{
+  return thrust::system::tbb::detail::dispatch::copy_n(first,n,result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
+} // end copy_n()
+
 
 } // end namespace detail
 } // end namespace tbb
@@ -21,6 +21,7 @@
 #include <thrust/system/tbb/detail/copy_if.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
+#include <thrust/system/detail/internal/scalar/copy_if.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
 
@@ -70,19 +71,17 @@ struct body
   
   void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
   {
-    InputIterator1  iter1 = first   + r.begin();
-    InputIterator2  iter2 = stencil + r.begin();
-    OutputIterator  iter3 = result  + sum;
-      
-    for (Size i = r.begin(); i != r.end(); ++i, ++iter1, ++iter2)
-    {
-      if (pred(*iter2))
-      {
-        *iter3 = *iter1;
-        ++sum;
-        ++iter3;
-      }
-    }
+    OutputIterator begin = result + sum;
+
+    // compact this tile into place
+    OutputIterator end =
+      thrust::system::detail::internal::scalar::copy_if(first   + r.begin(),
+                                                        first   + r.end(),
+                                                        stencil + r.begin(),
+                                                        begin,
+                                                        pred);
+
+    sum += thrust::distance(begin, end);
   }
 
   void reverse_join(body& b)
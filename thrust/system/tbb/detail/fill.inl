@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file fill.inl
+ *  \brief Inline file for fill.h.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/fill.h>
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace fill_detail
+{
+
+
+// returns the raw pointer associated with a Pointer-like thing
+template<typename Pointer>
+  typename thrust::detail::pointer_traits<Pointer>::raw_pointer
+    get(Pointer ptr)
+{
+  return thrust::detail::pointer_traits<Pointer>::get(ptr);
+}
+
+
+template<typename T>
+  struct trivial_fill_body
+{
+  T *m_first;
+  thrust::system::detail::internal::page_decomposition<T> m_pages;
+  T m_value;
+  bool m_streaming;
+
+  trivial_fill_body(T *first, const thrust::system::detail::internal::page_decomposition<T> &pages, const T &value, bool streaming)
+    : m_first(first), m_pages(pages), m_value(value), m_streaming(streaming)
+  {}
+
+  // r is a range of pages
+  void operator()(const ::tbb::blocked_range<std::ptrdiff_t> &r) const
+  {
+    thrust::system::detail::internal::fill_interval(m_first, m_pages(r.begin(), r.end()), m_value, m_streaming);
+  } // end operator()()
+}; // end trivial_fill_body
+
+
+// fills [first, first + n) with one memset per task,
+// each of which writes only to whole pages
+template<typename T>
+  T *trivial_fill_n(T *first,
+                    std::ptrdiff_t n,
+                    const T &value)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  const std::size_t num_bytes = n * sizeof(T);
+
+  if(num_bytes < internal::min_parallel_bytes)
+  {
+    return internal::scalar::trivial_fill_n(first, n, value);
+  }
+
+  internal::page_decomposition<T> pages(first, n);
+
+  const std::ptrdiff_t grain_size = internal::min_parallel_bytes / internal::page_size;
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, pages.size(), grain_size),
+                      trivial_fill_body<T>(first, pages, value, internal::use_streaming_stores(num_bytes)));
+
+  return first + n;
+} // end trivial_fill_n()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(OutputIterator first,
+                        Size n,
+                        const T &value,
+                        thrust::detail::true_type) // is_trivial_fill
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type OutputType;
+
+  if(n > 0)
+  {
+    fill_detail::trivial_fill_n(get(&*first), n, static_cast<OutputType>(value));
+  }
+
+  return first + n;
+} // end fill_n()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(OutputIterator first,
+                        Size n,
+                        const T &value,
+                        thrust::detail::false_type) // is_trivial_fill
+{
+  return thrust::system::detail::generic::fill_n(tag(), first, n, value);
+} // end fill_n()
+
+
+template<typename ForwardIterator, typename T>
+  void fill(ForwardIterator first,
+            ForwardIterator last,
+            const T &value,
+            thrust::detail::true_type) // is_trivial_fill
+{
+  fill_detail::fill_n(first, last - first, value, thrust::detail::true_type());
+} // end fill()
+
+
+template<typename ForwardIterator, typename T>
+  void fill(ForwardIterator first,
+            ForwardIterator last,
+            const T &value,
+            thrust::detail::false_type) // is_trivial_fill
+{
+  thrust::system::detail::generic::fill(tag(), first, last, value);
+} // end fill()
+
+
+} // end fill_detail
+
+
+template<typename ForwardIterator, typename T>
+  void fill(tag,
+            ForwardIterator first,
+            ForwardIterator last,
+            const T &value)
+{
+  fill_detail::fill(first, last, value,
+    typename thrust::system::detail::internal::is_trivial_fill<ForwardIterator>::type());
+} // end fill()
+
+
+template<typename OutputIterator, typename Size, typename T>
+  OutputIterator fill_n(tag,
+                        OutputIterator first,
+                        Size n,
+                        const T &value)
+{
+  return fill_detail::fill_n(first, n, value,
+    typename thrust::system::detail::internal::is_trivial_fill<OutputIterator>::type());
+} // end fill_n()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
@@ -18,6 +18,7 @@
 #include <thrust/system/cpp/detail/tag.h>
 #include <thrust/system/tbb/memory.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/tbb/detail/malloc_and_free.h>
 #include <limits>
 
 namespace thrust
@@ -84,7 +85,8 @@ inline pointer<void> malloc(std::size_t n)
   //
   // return pointer<void>(thrust::system::cpp::malloc(n))
   //
-  return detail::malloc_workaround(cpp::tag(), n);
+  // dispatch on our own tag to place the pages of large allocations
+  return detail::malloc_workaround(tag(), n);
 } // end malloc()
 
 inline void free(pointer<void> ptr)
@@ -59,6 +59,31 @@ thrust::pair<OutputIterator1,OutputIterator2>
                  OutputIterator2 output2,
                  StrictWeakOrdering comp);
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge_n(tag,
+                       RangeIterator ranges,
+                       Size n,
+                       OutputIterator result,
+                       StrictWeakOrdering comp);
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp);
+
 } // end detail
 } // end tbb
 } // end system
@@ -19,7 +19,10 @@
 #include <thrust/system/tbb/detail/tag.h>
 #include <thrust/system/detail/internal/scalar/merge.h>
 #include <thrust/system/detail/internal/scalar/binary_search.h>
+#include <thrust/system/detail/internal/scalar/multiway_merge.h>
+#include <thrust/system/detail/internal/multisequence_partition.h>
 #include <tbb/parallel_for.h>
+#include <vector>
 
 namespace thrust
 {
@@ -218,6 +221,117 @@ struct body
 
 } // end namespace merge_by_key_detail
 
+namespace merge_n_detail
+{
+
+// a range is split by partitioning its output in half with multisequence_partition,
+// which divides each of its input ranges between the two halves
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+struct range
+{
+  typedef thrust::pair<InputIterator1,InputIterator1>                 range_type;
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  std::vector<range_type> key_ranges;
+  std::vector<InputIterator2> values;
+  OutputIterator1 output1;
+  OutputIterator2 output2;
+  StrictWeakOrdering comp;
+  size_t grain_size;
+
+  range(const std::vector<range_type> &key_ranges,
+        const std::vector<InputIterator2> &values,
+        OutputIterator1 output1,
+        OutputIterator2 output2,
+        StrictWeakOrdering comp,
+        size_t grain_size = 1 << 15)
+    : key_ranges(key_ranges), values(values),
+      output1(output1), output2(output2),
+      comp(comp), grain_size(grain_size)
+  {}
+
+  range(range& r, ::tbb::split)
+    : key_ranges(r.key_ranges), values(r.values),
+      output1(r.output1), output2(r.output2),
+      comp(r.comp), grain_size(r.grain_size)
+  {
+    const size_t n = key_ranges.size();
+
+    difference_type rank = size() / 2;
+
+    std::vector<difference_type> splits(n), scratch(2 * n);
+
+    thrust::system::detail::internal::multisequence_partition(&key_ranges[0], n, rank, &splits[0], &scratch[0], comp);
+
+    // set first range to the first splits[i] elements of each range
+    // set second range to the rest, output1 + rank, output2 + rank
+    for(size_t i = 0; i < n; ++i)
+    {
+      r.key_ranges[i].second = key_ranges[i].first + splits[i];
+      key_ranges[i].first    = r.key_ranges[i].second;
+
+      if(!values.empty())
+      {
+        values[i] += splits[i];
+      }
+    }
+
+    output1 += rank;
+    output2 += rank;
+  }
+
+  size_t size(void) const
+  {
+    difference_type result = 0;
+
+    for(size_t i = 0; i < key_ranges.size(); ++i)
+    {
+      result += key_ranges[i].second - key_ranges[i].first;
+    }
+
+    return result;
+  }
+
+  bool empty(void) const
+  {
+    return size() == 0;
+  }
+
+  bool is_divisible(void) const
+  {
+    return size() > grain_size;
+  }
+};
+
+struct body
+{
+  template <typename Range>
+  void operator()(Range& r) const
+  {
+    if(r.values.empty())
+    {
+      thrust::system::detail::internal::scalar::multiway_merge
+        (&r.key_ranges[0], r.key_ranges.size(),
+         r.output1,
+         r.comp);
+    }
+    else
+    {
+      thrust::system::detail::internal::scalar::multiway_merge_by_key
+        (&r.key_ranges[0], &r.values[0], r.key_ranges.size(),
+         r.output1,
+         r.output2,
+         r.comp);
+    }
+  }
+};
+
+} // end namespace merge_n_detail
+
 
 template<typename InputIterator1,
          typename InputIterator2,
@@ -276,6 +390,70 @@ thrust::pair<OutputIterator1,OutputIterator2>
   return thrust::make_pair(output1,output2);
 }
 
+template<typename RangeIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge_n(tag,
+                       RangeIterator ranges,
+                       Size n,
+                       OutputIterator result,
+                       StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type range_type;
+  typedef typename range_type::first_type                     InputIterator;
+
+  // the values are unused; result stands in for their output
+  typedef typename merge_n_detail::range<InputIterator,InputIterator,OutputIterator,OutputIterator,StrictWeakOrdering> Range;
+  typedef          merge_n_detail::body                                                                               Body;
+
+  if(n <= 0) return result;
+
+  Range range(std::vector<range_type>(ranges, ranges + n), std::vector<InputIterator>(), result, result, comp);
+  Body  body;
+
+  thrust::advance(result, range.size());
+
+  ::tbb::parallel_for(range, body);
+
+  return result;
+} // end merge_n()
+
+template<typename RangeIterator,
+         typename ValueIteratorIterator,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+    merge_n_by_key(tag,
+                   RangeIterator key_ranges,
+                   ValueIteratorIterator values,
+                   Size n,
+                   OutputIterator1 keys_result,
+                   OutputIterator2 values_result,
+                   StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RangeIterator>::type         range_type;
+  typedef typename range_type::first_type                             InputIterator1;
+  typedef typename thrust::iterator_value<ValueIteratorIterator>::type InputIterator2;
+
+  typedef typename merge_n_detail::range<InputIterator1,InputIterator2,OutputIterator1,OutputIterator2,StrictWeakOrdering> Range;
+  typedef          merge_n_detail::body                                                                                   Body;
+
+  if(n <= 0) return thrust::make_pair(keys_result, values_result);
+
+  Range range(std::vector<range_type>(key_ranges, key_ranges + n), std::vector<InputIterator2>(values, values + n), keys_result, values_result, comp);
+  Body  body;
+
+  thrust::advance(keys_result,   range.size());
+  thrust::advance(values_result, range.size());
+
+  ::tbb::parallel_for(range, body);
+
+  return thrust::make_pair(keys_result, values_result);
+} // end merge_n_by_key()
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
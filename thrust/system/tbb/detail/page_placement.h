@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file page_placement.h
+ *  \brief Placement of the pages of the tbb system's memory
+ *         on the memory nodes of the machine.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/tag.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/bulk_memory.h>
+#include <thrust/system/detail/internal/page_placement.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+// the policy set by set_page_placement
+template<typename Unused>
+  struct page_placement_holder
+{
+  static volatile int value;
+};
+
+
+} // end detail
+
+
+/*! \addtogroup memory_management Memory Management
+ *  \{
+ */
+
+/*! \p page_placement enumerates the policies by which the pages of large allocations of memory
+ *  available to the \p tbb system, such as the storage of a \p tbb::vector or an algorithm's
+ *  temporary buffers, are placed on the memory nodes of machines which have several.
+ */
+enum page_placement
+{
+  /*! Each page is placed on the node of the thread which first writes to it. The \p tbb system
+   *  first writes to its vectors and temporary buffers in parallel, each page from the thread
+   *  which its algorithms assign that page's elements to, so that those threads find their data
+   *  nearby. This is the default policy.
+   */
+  first_touch_placement,
+
+  /*! Pages are spread round-robin over the nodes the allocating thread may use, which balances
+   *  the traffic of algorithms whose threads do not keep to a fixed share of the data. Where the
+   *  operating system does not support interleaving, pages are placed by first touch instead.
+   */
+  interleaved_placement
+};
+
+/*! Selects the policy by which the pages of memory subsequently allocated for the \p tbb
+ *  system are placed.
+ *  \param placement The new policy.
+ *  \see get_page_placement
+ */
+inline void set_page_placement(page_placement placement)
+{
+  detail::page_placement_holder<void>::value = placement;
+} // end set_page_placement()
+
+/*! \return The policy by which the pages of memory allocated for the \p tbb system are placed.
+ *  \see set_page_placement
+ */
+inline page_placement get_page_placement()
+{
+  return static_cast<page_placement>(detail::page_placement_holder<void>::value);
+} // end get_page_placement()
+
+/*! \}
+ */
+
+
+namespace detail
+{
+
+
+template<typename Unused>
+  volatile int page_placement_holder<Unused>::value = first_touch_placement;
+
+namespace page_placement_detail
+{
+
+
+template<typename T>
+  struct touch_pages_body
+{
+  T *m_first;
+
+  touch_pages_body(T *first)
+    : m_first(first)
+  {}
+
+  // r is a range of elements
+  void operator()(const ::tbb::blocked_range<std::ptrdiff_t> &r) const
+  {
+    thrust::system::detail::internal::touch_pages(m_first, thrust::system::detail::internal::index_range<std::ptrdiff_t>(r.begin(), r.end()));
+  } // end operator()()
+}; // end touch_pages_body
+
+
+} // end page_placement_detail
+
+
+// places the pages of the uninitialized array [first, first + n) as get_page_placement() directs
+// under first_touch_placement, the tasks split the array as the tbb algorithms split their work
+template<typename T>
+  void place_pages(tag, T *first, std::ptrdiff_t n)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  if(get_page_placement() == interleaved_placement &&
+     internal::interleave_pages(first, n * sizeof(T)))
+  {
+    return;
+  } // end if
+
+  if(n * sizeof(T) < internal::min_parallel_bytes)
+  {
+    internal::touch_pages(first, internal::index_range<std::ptrdiff_t>(0, n));
+    return;
+  } // end if
+
+  const std::ptrdiff_t grain_size = internal::min_parallel_bytes / sizeof(T);
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, n, grain_size),
+                      page_placement_detail::touch_pages_body<T>(first));
+} // end place_pages()
+
+
+} // end detail
+} // end tbb
+} // end system
+} // end thrust
+
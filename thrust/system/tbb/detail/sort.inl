@@ -18,10 +18,15 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/copy.h>
 #include <thrust/system/detail/internal/scalar/sort.h>
+#include <thrust/system/detail/internal/scalar/adaptive_merge.h>
+#include <thrust/system/detail/internal/low_memory.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/merge.h>
+#include <thrust/detail/function.h>
+#include <tbb/blocked_range.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
 
 namespace thrust
 {
@@ -34,61 +39,158 @@ namespace detail
 namespace sort_detail
 {
 
+// checks whether each tile of a range is in order, including the
+// pair of elements which straddles the tile's left boundary
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct is_sorted_body
+{
+  RandomAccessIterator first;
+  thrust::detail::host_function<StrictWeakOrdering,bool> comp;
+  bool sorted;
+
+  is_sorted_body(RandomAccessIterator first, StrictWeakOrdering comp)
+    : first(first), comp(comp), sorted(true)
+  {}
+
+  is_sorted_body(is_sorted_body& b, ::tbb::split)
+    : first(b.first), comp(b.comp), sorted(true)
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r)
+  {
+    if (!sorted) return; // an earlier tile of this body is out of order
+
+    for (Size i = (r.begin() > 0) ? r.begin() : 1; i < r.end(); ++i)
+    {
+      if (comp(first[i], first[i - 1]))
+      {
+        sorted = false;
+        return;
+      }
+    }
+  }
+
+  void join(is_sorted_body& b)
+  {
+    sorted = sorted && b.sorted;
+  }
+};
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+bool is_sorted(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  is_sorted_body<RandomAccessIterator,StrictWeakOrdering> body(first, comp);
+  ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, last - first), body);
+
+  return body.sorted;
+}
+
+
 // TODO tune this based on data type and comp
 static int threshold = 128 * 1024;
-  
-template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
-void merge_sort(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace);
 
-template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
+// the recursion shared by the merge sorts below. A Sorter addresses the elements of the
+// sort by their offsets from its beginning, and provides the two steps which differ:
+//   sorter.sort(begin, end, inplace) sorts a range shorter than threshold, and
+//   sorter.merge(begin, mid, end, inplace) merges the two sorted halves of a longer one.
+// With a temporary array, inplace says whether the result belongs in the input rather than
+// the array, and flips at each level; sorters which merge in place ignore it.
+template <typename Sorter, typename Size>
+void merge_sort(const Sorter &sorter, Size begin, Size end, bool inplace);
+
+template <typename Sorter, typename Size>
 struct merge_sort_closure
 {
-  Iterator1 first1, last1;
-  Iterator2 first2;
-  StrictWeakOrdering comp;
+  const Sorter &sorter;
+  Size begin, end;
   bool inplace;
+  thrust::system::detail::internal::parallel_low_memory_record *record;
 
-  merge_sort_closure(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace)
-    : first1(first1), last1(last1), first2(first2), comp(comp), inplace(inplace)
+  merge_sort_closure(const Sorter &sorter, Size begin, Size end, bool inplace, thrust::system::detail::internal::parallel_low_memory_record *record)
+    : sorter(sorter), begin(begin), end(end), inplace(inplace), record(record)
   {}
 
   void operator()(void) const
   {
-    merge_sort(first1, last1, first2, comp, inplace);
+    // the closure may run on any thread, so its fallbacks are handed to its parent to record
+    thrust::low_memory_monitor monitor;
+    thrust::detail::low_memory_monitor_access::detach(monitor);
+
+    merge_sort(sorter, begin, end, inplace);
+
+    record->add(monitor);
   }
 };
 
 
+template <typename Sorter, typename Size>
+void merge_sort(const Sorter &sorter, Size begin, Size end, bool inplace)
+{
+  if (end - begin < threshold)
+  {
+    sorter.sort(begin, end, inplace);
+    return;
+  }
+
+  Size mid = begin + (end - begin) / 2;
+
+  typedef merge_sort_closure<Sorter,Size> Closure;
+
+  thrust::system::detail::internal::parallel_low_memory_record left_record, right_record;
+
+  Closure left (sorter, begin, mid, !inplace, &left_record);
+  Closure right(sorter, mid,   end, !inplace, &right_record);
+
+  ::tbb::parallel_invoke(left, right);
+
+  left_record.record();
+  right_record.record();
+
+  sorter.merge(begin, mid, end, inplace);
+}
+
+
+// sorts with a temporary array as large as the input, merging the halves into and out of it
 template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
-void merge_sort(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace)
+struct buffered_sorter
 {
-  typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
+  Iterator1 first1;
+  Iterator2 first2;
+  StrictWeakOrdering comp;
 
-  difference_type n = thrust::distance(first1, last1);
+  buffered_sorter(Iterator1 first1, Iterator2 first2, StrictWeakOrdering comp)
+    : first1(first1), first2(first2), comp(comp)
+  {}
 
-  if (n < threshold)
+  template <typename Size>
+  void sort(Size begin, Size end, bool inplace) const
   {
-    thrust::system::detail::internal::scalar::stable_sort(first1, last1, comp);
-    
+    thrust::system::detail::internal::scalar::stable_sort(first1 + begin, first1 + end, comp);
+
     if (!inplace)
-      thrust::system::detail::internal::scalar::copy(first1, last1, first2);
+      thrust::system::detail::internal::scalar::copy(first1 + begin, first1 + end, first2 + begin);
+  }
 
-    return;
+  template <typename Size>
+  void merge(Size begin, Size mid, Size end, bool inplace) const
+  {
+    if (inplace) thrust::merge(first2 + begin, first2 + mid, first2 + mid, first2 + end, first1 + begin, comp);
+    else         thrust::merge(first1 + begin, first1 + mid, first1 + mid, first1 + end, first2 + begin, comp);
   }
+};
 
-  Iterator1 mid1  = first1 + (n / 2);
-  Iterator2 mid2  = first2 + (n / 2);
-  Iterator2 last2 = first2 + n;
 
-  typedef merge_sort_closure<Iterator1,Iterator2,StrictWeakOrdering> Closure;
-  
-  Closure left (first1, mid1,  first2, comp, !inplace);
-  Closure right(mid1,   last1, mid2,   comp, !inplace);
+template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
+void merge_sort(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace)
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
 
-  ::tbb::parallel_invoke(left, right);
+  buffered_sorter<Iterator1,Iterator2,StrictWeakOrdering> sorter(first1, first2, comp);
 
-  if (inplace) thrust::merge(first2, mid2, mid2, last2, first1, comp);
-  else			   thrust::merge(first1, mid1, mid1, last1, first2, comp);
+  merge_sort(sorter, difference_type(0), thrust::distance(first1, last1), inplace);
 }
 
 } // end namespace sort_detail
@@ -97,49 +199,46 @@ void merge_sort(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakO
 namespace sort_by_key_detail
 {
 
-// TODO tune this based on data type and comp
-static int threshold = 128 * 1024;
-  
+// see sort_detail::buffered_sorter
 template <typename Iterator1,
           typename Iterator2,
           typename Iterator3,
           typename Iterator4,
           typename StrictWeakOrdering>
-void merge_sort_by_key(Iterator1 first1,
-                       Iterator1 last1,
-                       Iterator2 first2,
-                       Iterator3 first3,
-                       Iterator4 first4,
-                       StrictWeakOrdering comp,
-                       bool inplace);
-
-template <typename Iterator1,
-          typename Iterator2,
-          typename Iterator3,
-          typename Iterator4,
-          typename StrictWeakOrdering>
-struct merge_sort_by_key_closure
+struct buffered_sorter
 {
-  Iterator1 first1, last1;
+  Iterator1 first1;
   Iterator2 first2;
   Iterator3 first3;
   Iterator4 first4;
   StrictWeakOrdering comp;
-  bool inplace;
 
-  merge_sort_by_key_closure(Iterator1 first1,
-                            Iterator1 last1,
-                            Iterator2 first2,
-                            Iterator3 first3,
-                            Iterator4 first4,
-                            StrictWeakOrdering comp,
-                            bool inplace)
-    : first1(first1), last1(last1), first2(first2), first3(first3), first4(first4), comp(comp), inplace(inplace)
+  buffered_sorter(Iterator1 first1,
+                  Iterator2 first2,
+                  Iterator3 first3,
+                  Iterator4 first4,
+                  StrictWeakOrdering comp)
+    : first1(first1), first2(first2), first3(first3), first4(first4), comp(comp)
   {}
 
-  void operator()(void) const
+  template <typename Size>
+  void sort(Size begin, Size end, bool inplace) const
   {
-    merge_sort_by_key(first1, last1, first2, first3, first4, comp, inplace);
+    thrust::system::detail::internal::scalar::stable_sort_by_key(first1 + begin, first1 + end, first2 + begin, comp);
+
+    if (!inplace)
+    {
+      thrust::system::detail::internal::scalar::copy(first1 + begin, first1 + end, first3 + begin);
+      thrust::system::detail::internal::scalar::copy(first2 + begin, first2 + end, first4 + begin);
+    }
+  }
+
+  template <typename Size>
+  void merge(Size begin, Size mid, Size end, bool inplace) const
+  {
+    // TODO replace with thrust::merge_by_key
+    if (inplace) thrust::system::tbb::detail::merge_by_key(thrust::system::tbb::tag(), first3 + begin, first3 + mid, first3 + mid, first3 + end, first4 + begin, first4 + mid, first1 + begin, first2 + begin, comp);
+    else         thrust::system::tbb::detail::merge_by_key(thrust::system::tbb::tag(), first1 + begin, first1 + mid, first1 + mid, first1 + end, first2 + begin, first2 + mid, first3 + begin, first4 + begin, comp);
   }
 };
 
@@ -159,41 +258,92 @@ void merge_sort_by_key(Iterator1 first1,
 {
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
 
-  difference_type n = thrust::distance(first1, last1);
-  
-  Iterator1 mid1  = first1 + (n / 2);
-  Iterator2 mid2  = first2 + (n / 2);
-  Iterator3 mid3  = first3 + (n / 2);
-  Iterator4 mid4  = first4 + (n / 2);
-  Iterator2 last2 = first2 + n;
-  Iterator3 last3 = first3 + n;
+  buffered_sorter<Iterator1,Iterator2,Iterator3,Iterator4,StrictWeakOrdering> sorter(first1, first2, first3, first4, comp);
+
+  sort_detail::merge_sort(sorter, difference_type(0), thrust::distance(first1, last1), inplace);
+}
+
+} // end namespace sort_by_key_detail
 
-  if (n < threshold)
+
+// when there is no room for the temporary arrays, the halves are sorted in parallel and
+// merged in place with as much temporary storage as is available
+namespace low_memory_sort_detail
+{
+
+template <typename Iterator, typename StrictWeakOrdering>
+struct in_place_sorter
+{
+  Iterator first;
+  thrust::detail::host_function<StrictWeakOrdering,bool> comp;
+
+  in_place_sorter(Iterator first, StrictWeakOrdering comp)
+    : first(first), comp(comp)
+  {}
+
+  template <typename Size>
+  void sort(Size begin, Size end, bool) const
   {
-    thrust::system::detail::internal::scalar::stable_sort_by_key(first1, last1, first2, comp);
-    
-    if (!inplace)
-    {
-      thrust::system::detail::internal::scalar::copy(first1, last1, first3);
-      thrust::system::detail::internal::scalar::copy(first2, last2, first4);
-    }
+    thrust::system::detail::internal::scalar::stable_sort(first + begin, first + end, comp);
+  }
 
-    return;
+  template <typename Size>
+  void merge(Size begin, Size mid, Size end, bool) const
+  {
+    // unless the halves are already in order
+    if (comp(first[mid], first[mid - 1]))
+      thrust::system::detail::internal::scalar::adaptive_merge(first + begin, first + mid, first + end, comp);
   }
+};
 
-  typedef merge_sort_by_key_closure<Iterator1,Iterator2,Iterator3,Iterator4,StrictWeakOrdering> Closure;
-  
-  Closure left (first1, mid1,  first2, first3, first4, comp, !inplace);
-  Closure right(mid1,   last1, mid2,   mid3,   mid4,   comp, !inplace);
+template <typename Iterator, typename StrictWeakOrdering>
+void merge_sort(Iterator first, Iterator last, StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<Iterator>::type difference_type;
 
-  ::tbb::parallel_invoke(left, right);
+  in_place_sorter<Iterator,StrictWeakOrdering> sorter(first, comp);
 
-  // TODO replace with thrust::merge_by_key
-  if (inplace) thrust::system::tbb::detail::merge_by_key(thrust::system::tbb::tag(), first3, mid3, mid3, last3, first4, mid4, first1, first2, comp);
-  else			   thrust::system::tbb::detail::merge_by_key(thrust::system::tbb::tag(), first1, mid1, mid1, last1, first2, mid2, first3, first4, comp);
+  sort_detail::merge_sort(sorter, difference_type(0), thrust::distance(first, last), true);
 }
 
-} // end namespace sort_detail
+
+template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
+struct in_place_sorter_by_key
+{
+  Iterator1 first1;
+  Iterator2 first2;
+  thrust::detail::host_function<StrictWeakOrdering,bool> comp;
+
+  in_place_sorter_by_key(Iterator1 first1, Iterator2 first2, StrictWeakOrdering comp)
+    : first1(first1), first2(first2), comp(comp)
+  {}
+
+  template <typename Size>
+  void sort(Size begin, Size end, bool) const
+  {
+    thrust::system::detail::internal::scalar::stable_sort_by_key(first1 + begin, first1 + end, first2 + begin, comp);
+  }
+
+  template <typename Size>
+  void merge(Size begin, Size mid, Size end, bool) const
+  {
+    // unless the halves are already in order
+    if (comp(first1[mid], first1[mid - 1]))
+      thrust::system::detail::internal::scalar::adaptive_merge_by_key(first1 + begin, first1 + mid, first1 + end, first2 + begin, comp);
+  }
+};
+
+template <typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
+void merge_sort_by_key(Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
+
+  in_place_sorter_by_key<Iterator1,Iterator2,StrictWeakOrdering> sorter(first1, first2, comp);
+
+  sort_detail::merge_sort(sorter, difference_type(0), thrust::distance(first1, last1), true);
+}
+
+} // end namespace low_memory_sort_detail
 
 template<typename RandomAccessIterator,
          typename StrictWeakOrdering>
@@ -205,7 +355,19 @@ void stable_sort(tag,
   typedef typename thrust::iterator_system<RandomAccessIterator>::type system;
   typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
 
-  thrust::detail::temporary_array<key_type, system> temp(first, last);
+  // presorted input needs neither the temporary array nor the merges
+  if (sort_detail::is_sorted(first, last, comp))
+    return;
+
+  // the merge sort writes the temporary array before reading it
+  thrust::detail::temporary_array<key_type, system> temp(0);
+
+  if (!temp.try_allocate(thrust::distance(first, last)))
+  {
+    thrust::system::detail::internal::record_low_memory_mode(thrust::low_memory_monitor::reduced_buffer);
+    low_memory_sort_detail::merge_sort(first, last, comp);
+    return;
+  }
 
   sort_detail::merge_sort(first, last, temp.begin(), comp, true);
 }
@@ -225,8 +387,20 @@ template<typename RandomAccessIterator1,
 
   RandomAccessIterator2 last2 = first2 + thrust::distance(first1, last1);
 
-  thrust::detail::temporary_array<key_type, system> temp1(first1, last1);
-  thrust::detail::temporary_array<val_type, system> temp2(first2, last2);
+  // presorted input needs neither the temporary arrays nor the merges
+  if (sort_detail::is_sorted(first1, last1, comp))
+    return;
+
+  // the merge sort writes the temporary arrays before reading them
+  thrust::detail::temporary_array<key_type, system> temp1(0);
+  thrust::detail::temporary_array<val_type, system> temp2(0);
+
+  if (!temp1.try_allocate(thrust::distance(first1, last1)) || !temp2.try_allocate(thrust::distance(first2, last2)))
+  {
+    thrust::system::detail::internal::record_low_memory_mode(thrust::low_memory_monitor::reduced_buffer);
+    low_memory_sort_detail::merge_sort_by_key(first1, last1, first2, comp);
+    return;
+  }
 
   sort_by_key_detail::merge_sort_by_key(first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
@@ -38,12 +38,32 @@ template<typename T, typename Allocator>
       : super_t(n,value)
 {}
 
+template<typename T, typename Allocator>
+  vector<T,Allocator>
+    ::vector(size_type n, default_init_t)
+      : super_t(n,default_init)
+{}
+
+template<typename T, typename Allocator>
+  vector<T,Allocator>
+    ::vector(size_type n, first_touch_t)
+      : super_t(n,first_touch)
+{}
+
 template<typename T, typename Allocator>
   vector<T,Allocator>
     ::vector(const vector &x)
       : super_t(x)
 {}
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template<typename T, typename Allocator>
+  vector<T,Allocator>
+    ::vector(vector &&x) noexcept
+      : super_t(std::move(x))
+{}
+#endif
+
 template<typename T, typename Allocator>
   template<typename OtherT, typename OtherAllocator>
     vector<T,Allocator>
@@ -65,6 +85,26 @@ template<typename T, typename Allocator>
         : super_t(first,last)
 {}
 
+template<typename T, typename Allocator>
+  vector<T,Allocator> &
+    vector<T,Allocator>
+      ::operator=(const vector &x)
+{
+  super_t::operator=(x);
+  return *this;
+}
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+template<typename T, typename Allocator>
+  vector<T,Allocator> &
+    vector<T,Allocator>
+      ::operator=(vector &&x) noexcept
+{
+  super_t::operator=(std::move(x));
+  return *this;
+}
+#endif
+
 template<typename T, typename Allocator>
   template<typename OtherT, typename OtherAllocator>
     vector<T,Allocator> &
@@ -25,6 +25,8 @@
 #include <thrust/memory.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/allocator/malloc_allocator.h>
+#include <thrust/detail/allocator/aligned_malloc_allocator.h>
+#include <thrust/system/tbb/detail/page_placement.h>
 #include <ostream>
 
 namespace thrust
@@ -383,6 +385,62 @@ template<typename T>
   inline ~allocator() {}
 }; // end allocator
 
+/*! \p tbb::aligned_allocator allocates storage available to the \p tbb system which begins on a
+ *  multiple of \p Alignment bytes, so that the \p data() of a container which uses it, such as
+ *  <tt>tbb::vector<T, tbb::aligned_allocator<T> ></tt>, is aligned for cache lines and SIMD loads.
+ *
+ *  Allocations of 2 MB or more are aligned to 2 MB and padded to a multiple of it, and where the
+ *  system supports transparent huge pages, it is advised to back them with huge pages, which
+ *  spares random accesses to large arrays most of their TLB misses.
+ *
+ *  \tparam T The type of element to allocate.
+ *  \tparam Alignment The alignment in bytes, a power of two no smaller than <tt>sizeof(void*)</tt>.
+ *          Defaults to the size of a cache line, \c 64.
+ */
+template<typename T, std::size_t Alignment = 64>
+  struct aligned_allocator
+    : thrust::detail::aligned_malloc_allocator<
+        T,
+        tag,
+        pointer<T>,
+        Alignment
+      >
+{
+  /*! The \p rebind metafunction provides the type of an \p aligned_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p aligned_allocator.
+     */
+    typedef aligned_allocator<U,Alignment> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  __host__ __device__
+  inline aligned_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  __host__ __device__
+  inline aligned_allocator(const aligned_allocator &) {}
+
+  /*! Constructor from other \p aligned_allocator has no effect.
+   */
+  template<typename U>
+  __host__ __device__
+  inline aligned_allocator(const aligned_allocator<U,Alignment> &) {}
+
+  /*! Destructor has no effect.
+   */
+  __host__ __device__
+  inline ~aligned_allocator() {}
+}; // end aligned_allocator
+
 } // end tbb
 
 /*! \}
@@ -400,7 +458,13 @@ using thrust::system::tbb::pointer;
 using thrust::system::tbb::reference;
 using thrust::system::tbb::malloc;
 using thrust::system::tbb::free;
+using thrust::system::tbb::page_placement;
+using thrust::system::tbb::first_touch_placement;
+using thrust::system::tbb::interleaved_placement;
+using thrust::system::tbb::set_page_placement;
+using thrust::system::tbb::get_page_placement;
 using thrust::system::tbb::allocator;
+using thrust::system::tbb::aligned_allocator;
 
 } // end tbb
 
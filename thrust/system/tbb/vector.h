@@ -25,6 +25,7 @@
 #include <thrust/system/tbb/memory.h>
 #include <thrust/detail/vector_base.h>
 #include <vector>
+#include <utility>
 
 namespace thrust
 {
@@ -81,11 +82,31 @@ template<typename T, typename Allocator = allocator<T> >
      */
     explicit vector(size_type n, const value_type &value = value_type());
 
+    /*! This constructor creates a \p tbb::vector with \p n default-initialized elements,
+     *  which are left uninitialized if their type has a trivial constructor.
+     *  \param n The size of the \p tbb::vector to create.
+     */
+    vector(size_type n, default_init_t);
+
+    /*! This constructor creates a \p tbb::vector with \p n default-initialized elements,
+     *  whose memory is placed as \p tbb::get_page_placement directs.
+     *  \param n The size of the \p tbb::vector to create.
+     *  \see first_touch
+     */
+    vector(size_type n, first_touch_t);
+
     /*! Copy constructor copies from another \p tbb::vector.
      *  \param x The other \p tbb::vector to copy.
      */
     vector(const vector &x);
 
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move constructor takes the elements of another \p tbb::vector, leaving it empty.
+     *  \param x The other \p tbb::vector to move from.
+     */
+    vector(vector &&x) noexcept;
+#endif
+
     /*! This constructor copies from another Thrust vector-like object.
      *  \param x The other object to copy from.
      */
@@ -107,6 +128,20 @@ template<typename T, typename Allocator = allocator<T> >
 
     // XXX vector_base should take a Derived type so we don't have to define these superfluous assigns
 
+    /*! Assignment operator assigns from another \p tbb::vector.
+     *  \param x The other \p tbb::vector to assign from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(const vector &x);
+
+#if THRUST_HOST_COMPILER_IS_CXX11_CAPABLE == THRUST_TRUE
+    /*! Move assignment operator takes the elements of another \p tbb::vector, leaving it empty.
+     *  \param x The other \p tbb::vector to move from.
+     *  \return <tt>*this</tt>
+     */
+    vector &operator=(vector &&x) noexcept;
+#endif
+
     /*! Assignment operator assigns from a \c std::vector.
      *  \param x The \c std::vector to assign from.
      *  \return <tt>*this</tt>
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file temporary_memory_monitor.h
+ *  \brief Measures the temporary storage obtained by algorithms
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef> // for std::size_t, std::ptrdiff_t
+
+namespace thrust
+{
+
+namespace detail
+{
+
+struct temporary_memory_monitor_access;
+
+} // end detail
+
+/*! \addtogroup memory_management Memory Management
+ *  \addtogroup memory_management_classes Memory Management Classes
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! \p temporary_memory_monitor measures the temporary storage algorithms obtain while it exists.
+ *
+ *  Every algorithm of every system obtains its temporary storage through
+ *  \p get_temporary_buffer, usually by way of a \p temporary_array. While a
+ *  \p temporary_memory_monitor exists, it counts the bytes each such request asks for, on any
+ *  thread, including the worker threads of the \p omp and \p tbb systems. It reports the
+ *  greatest number of bytes in use at once and the number of bytes obtained altogether.
+ *
+ *  Bytes are counted as requested, before a system rounds them up to the blocks it manages,
+ *  so the measurements of an algorithm do not depend on the state of the system's allocator,
+ *  such as the \p cpp system's cache of released buffers.
+ *
+ *  The following code snippet demonstrates how to learn how much temporary storage a sort needs.
+ *
+ *  \code
+ *  #include <thrust/temporary_memory_monitor.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<int> keys = ...
+ *
+ *  thrust::temporary_memory_monitor monitor;
+ *
+ *  thrust::stable_sort(keys.begin(), keys.end());
+ *
+ *  // monitor.peak_bytes_in_use() bytes of temporary storage suffice for this sort
+ *  \endcode
+ *
+ *  \p temporary_memory_monitors may be nested or exist at once on several threads. Each counts
+ *  all the temporary storage obtained while it exists, so to measure a call exactly, no other
+ *  thread should call algorithms meanwhile. Counting serializes requests for temporary storage,
+ *  which algorithms make a few times per call.
+ *
+ *  \see low_memory_monitor
+ *  \see scratch_arena
+ */
+class temporary_memory_monitor
+{
+  public:
+    /*! This constructor begins counting temporary storage.
+     */
+    inline temporary_memory_monitor();
+
+    /*! The destructor stops counting.
+     */
+    inline ~temporary_memory_monitor();
+
+    /*! \return The number of bytes of temporary storage obtained and not yet released since
+     *          this \p temporary_memory_monitor was created or last reset, or zero if more
+     *          storage obtained before was released meanwhile.
+     */
+    inline std::size_t bytes_in_use() const;
+
+    /*! \return The greatest value of \p bytes_in_use since this \p temporary_memory_monitor
+     *          was created or last reset.
+     */
+    inline std::size_t peak_bytes_in_use() const;
+
+    /*! \return The number of bytes of temporary storage obtained since this
+     *          \p temporary_memory_monitor was created or last reset, whether or not
+     *          they have been released.
+     */
+    inline std::size_t total_bytes() const;
+
+    /*! \return The number of requests for temporary storage satisfied since this
+     *          \p temporary_memory_monitor was created or last reset.
+     */
+    inline std::size_t num_allocations() const;
+
+    /*! Sets all counts to zero, so that the storage obtained by another call may be measured.
+     */
+    inline void reset();
+
+  private:
+    friend struct thrust::detail::temporary_memory_monitor_access;
+
+    // temporary_memory_monitors are registered by address, so they may not be copied
+    temporary_memory_monitor(const temporary_memory_monitor &);
+    temporary_memory_monitor &operator=(const temporary_memory_monitor &);
+
+    std::ptrdiff_t m_bytes_in_use;
+    std::size_t m_peak_bytes_in_use;
+    std::size_t m_total_bytes;
+    std::size_t m_num_allocations;
+    temporary_memory_monitor *m_next;
+}; // end temporary_memory_monitor
+
+/*! \}
+ */
+
+} // end thrust
+
+#include <thrust/detail/temporary_memory_monitor.inl>
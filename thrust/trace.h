@@ -0,0 +1,227 @@
+/*
+ *  Copyright 2008-2012 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file trace.h
+ *  \brief Records the algorithms a program calls, for profiling
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef> // for std::size_t
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace thrust
+{
+
+/*! \addtogroup tracing Tracing
+ *  \{
+ */
+
+/*! \namespace thrust::trace
+ *  \brief \p thrust::trace records the algorithms a program calls.
+ *
+ *  When a program is compiled with \c THRUST_ENABLE_TRACING defined, every call of an algorithm
+ *  such as \p sort, \p reduce, or \p copy reports an \p event to the current \p sink, which may
+ *  aggregate them with \p counting_sink, or write them for viewing in chrome://tracing or
+ *  Perfetto with \p chrome_trace_sink. Without \c THRUST_ENABLE_TRACING, the algorithms are
+ *  compiled without any tracing code. \c THRUST_ENABLE_TRACING must be defined alike in every
+ *  translation unit of a program, usually on the compiler's command line.
+ *
+ *  The following code snippet demonstrates how to write a trace of a program's algorithms.
+ *
+ *  \code
+ *  #define THRUST_ENABLE_TRACING
+ *  #include <thrust/trace.h>
+ *  #include <thrust/sort.h>
+ *  #include <fstream>
+ *  ...
+ *  std::ofstream file("trace.json");
+ *  thrust::trace::chrome_trace_sink sink(file);
+ *  thrust::trace::set_sink(&sink);
+ *
+ *  thrust::sort(keys.begin(), keys.end());
+ *
+ *  thrust::trace::set_sink(0);
+ *  \endcode
+ */
+namespace trace
+{
+
+
+/*! \p event describes one call of an algorithm.
+ *
+ *  Algorithms which call other algorithms report those calls as events of their own,
+ *  which begin and end within their caller's.
+ */
+struct event
+{
+  /*! The name of the algorithm, e.g. \c "sort".
+   */
+  const char *algorithm;
+
+  /*! The name of the system which executed the algorithm: \c "cpp", \c "omp", \c "tbb",
+   *  \c "cuda", or \c "unknown" for other systems.
+   */
+  const char *system;
+
+  /*! The number of elements of the algorithm's first input range.
+   *  This is \c 0 unless the range is random access. For \p merge_n and \p merge_n_by_key,
+   *  whose first input is an array of ranges, it is the number of ranges.
+   */
+  std::size_t num_elements;
+
+  /*! The time the call began, in seconds since an arbitrary point of time.
+   */
+  double begin;
+
+  /*! The duration of the call, in seconds.
+   */
+  double duration;
+
+  /*! The number of bytes of temporary storage allocated during the call, including
+   *  allocations by the algorithms it called.
+   */
+  std::size_t temporary_bytes;
+
+  /*! A number identifying the calling thread, unique within the process.
+   */
+  std::size_t thread;
+
+  /*! The number of traced calls the call was nested within.
+   */
+  std::size_t depth;
+};
+
+
+/*! \p sink is the interface of the objects events are reported to.
+ *  Events may be reported by several threads at once.
+ */
+class sink
+{
+  public:
+    /*! The destructor does nothing.
+     */
+    virtual ~sink() {}
+
+    /*! This method is called when a traced call of an algorithm returns. It must not throw.
+     *  \param e The event describing the call.
+     */
+    virtual void record(const event &e) = 0;
+};
+
+
+/*! \p set_sink makes a \p sink the destination of the events of all threads.
+ *  \param s The \p sink, or \c 0 to discard events.
+ *  \return The previous \p sink.
+ */
+inline sink *set_sink(sink *s);
+
+
+/*! \return The current \p sink, or \c 0.
+ */
+inline sink *get_sink();
+
+
+/*! \p counting_sink aggregates events by algorithm name.
+ */
+class counting_sink
+  : public sink
+{
+  public:
+    /*! \p totals aggregates the events of one algorithm.
+     */
+    struct totals
+    {
+      std::size_t num_calls;
+      std::size_t num_elements;
+      double      seconds;
+      std::size_t temporary_bytes;
+
+      totals() : num_calls(0), num_elements(0), seconds(0), temporary_bytes(0) {}
+    };
+
+    /*! \p totals_map maps algorithm names to their \p totals.
+     */
+    typedef std::map<std::string, totals> totals_map;
+
+    /*! This constructor creates an empty \p counting_sink.
+     */
+    inline counting_sink();
+
+    /*! Adds an event to the totals of its algorithm.
+     */
+    inline void record(const event &e);
+
+    /*! \return The totals of each algorithm recorded so far.
+     */
+    inline totals_map get_totals() const;
+
+    /*! Writes a table of the totals of each algorithm.
+     *  \param os The stream to write to.
+     */
+    inline void write(std::ostream &os) const;
+
+  private:
+    mutable volatile long m_lock;
+    totals_map m_totals;
+};
+
+
+/*! \p chrome_trace_sink writes events in the JSON trace event format read by chrome://tracing
+ *  and Perfetto, as complete events named after their algorithm, with the system as their
+ *  category, and the number of elements and temporary bytes as their arguments.
+ */
+class chrome_trace_sink
+  : public sink
+{
+  public:
+    /*! This constructor begins a trace.
+     *  \param os The stream to write the trace to. It must outlive the \p chrome_trace_sink.
+     */
+    inline explicit chrome_trace_sink(std::ostream &os);
+
+    /*! The destructor ends the trace.
+     */
+    inline ~chrome_trace_sink();
+
+    /*! Writes an event to the trace.
+     */
+    inline void record(const event &e);
+
+  private:
+    volatile long m_lock;
+    std::ostream &m_os;
+    bool m_first;
+
+    // non-copyable
+    chrome_trace_sink(const chrome_trace_sink &);
+    chrome_trace_sink &operator=(const chrome_trace_sink &);
+};
+
+
+} // end trace
+
+/*! \} // tracing
+ */
+
+} // end thrust
+
+#include <thrust/detail/trace.inl>
+